@@ -0,0 +1,18 @@
+//
+//  MTLAutoreleasePoolChunking.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// The number of elements that loops over arbitrarily large arrays process
+// inside each of their own autorelease pools.
+//
+// Each element leaves autoreleased temporaries behind, like key path
+// components, boxed values, intermediate dictionaries and errors. Draining them
+// every chunk keeps them from piling up until the caller's pool drains, while
+// making the cost of the pools themselves negligible.
+static const NSUInteger MTLAutoreleasePoolChunkSize = 256;
@@ -0,0 +1,741 @@
+//
+//  MTLColumnarBatch.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLColumnarBatch.h"
+#import "MTLModel.h"
+#import "MTLPropertyAccessor.h"
+#import "NSError+MTLLazyDescription.h"
+
+NSString * const MTLColumnarBatchErrorDomain = @"MTLColumnarBatchErrorDomain";
+const NSInteger MTLColumnarBatchErrorInvalidData = 1;
+const NSInteger MTLColumnarBatchErrorUnknownModelClass = 2;
+const NSInteger MTLColumnarBatchErrorInvalidValue = 3;
+
+NSString * const MTLColumnarBatchPropertyKeyErrorKey = @"MTLColumnarBatchPropertyKey";
+
+// The first bytes of serialized batches.
+static const char MTLColumnarBatchMagic[8] = { 'M', 'T', 'L', 'C', 'O', 'L', 'S', '1' };
+
+#pragma mark Buffers
+
+static void MTLColumnStoreUInt64(uint8_t *bytes, NSUInteger index, uint64_t value) {
+	value = CFSwapInt64HostToLittle(value);
+	memcpy(bytes + index * sizeof(value), &value, sizeof(value));
+}
+
+static uint64_t MTLColumnLoadUInt64(const uint8_t *bytes, NSUInteger index) {
+	uint64_t value;
+	memcpy(&value, bytes + index * sizeof(value), sizeof(value));
+
+	return CFSwapInt64LittleToHost(value);
+}
+
+static void MTLColumnStoreDouble(uint8_t *bytes, NSUInteger index, double value) {
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+
+	MTLColumnStoreUInt64(bytes, index, bits);
+}
+
+static double MTLColumnLoadDouble(const uint8_t *bytes, NSUInteger index) {
+	uint64_t bits = MTLColumnLoadUInt64(bytes, index);
+
+	double value;
+	memcpy(&value, &bits, sizeof(value));
+
+	return value;
+}
+
+// Returns whether values of `type` are delimited by offsets.
+static BOOL MTLColumnTypeHasOffsets(MTLColumnType type) {
+	return (type == MTLColumnTypeString || type == MTLColumnTypeURL || type == MTLColumnTypeBinary);
+}
+
+// Returns the width of values of a fixed-width `type`, or 0 for types with
+// offsets or unknown types.
+static NSUInteger MTLColumnTypeWidth(MTLColumnType type) {
+	switch (type) {
+		case MTLColumnTypeBool:
+			return 1;
+
+		case MTLColumnTypeInt64:
+		case MTLColumnTypeUInt64:
+		case MTLColumnTypeFloat64:
+		case MTLColumnTypeTimestamp:
+			return 8;
+
+		default:
+			return 0;
+	}
+}
+
+// Returns the class of the objects which represent the values of `type` in
+// models.
+static Class MTLColumnTypeObjectClass(MTLColumnType type) {
+	switch (type) {
+		case MTLColumnTypeTimestamp:
+			return NSDate.class;
+
+		case MTLColumnTypeString:
+			return NSString.class;
+
+		case MTLColumnTypeURL:
+			return NSURL.class;
+
+		case MTLColumnTypeBinary:
+			return NSData.class;
+
+		default:
+			return NSNumber.class;
+	}
+}
+
+static NSError *MTLColumnarBatchError(NSInteger code, NSString *key, NSString *failureReasonFormat, NSArray *arguments) {
+	NSDictionary *userInfo = (key != nil ? @{ MTLColumnarBatchPropertyKeyErrorKey: key } : nil);
+	NSString *description = (code == MTLColumnarBatchErrorInvalidValue ? NSLocalizedString(@"Could not convert models", @"") : NSLocalizedString(@"Could not read columnar batch", @""));
+
+	return [NSError mtl_errorWithDomain:MTLColumnarBatchErrorDomain code:code descriptionFormat:description failureReasonFormat:failureReasonFormat arguments:arguments userInfo:userInfo];
+}
+
+@interface MTLColumn ()
+
+- (instancetype)initWithKey:(NSString *)key type:(MTLColumnType)type count:(NSUInteger)count nullCount:(NSUInteger)nullCount validityBitmap:(NSData *)validityBitmap offsets:(NSData *)offsets values:(NSData *)values;
+
+@end
+
+@implementation MTLColumn
+
+- (instancetype)initWithKey:(NSString *)key type:(MTLColumnType)type count:(NSUInteger)count nullCount:(NSUInteger)nullCount validityBitmap:(NSData *)validityBitmap offsets:(NSData *)offsets values:(NSData *)values {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_key = [key copy];
+	_type = type;
+	_count = count;
+	_nullCount = nullCount;
+	_validityBitmap = [validityBitmap copy];
+	_offsets = [offsets copy];
+	_values = [values copy];
+
+	return self;
+}
+
+- (BOOL)isNullAtIndex:(NSUInteger)index {
+	NSParameterAssert(index < self.count);
+
+	const uint8_t *bitmap = self.validityBitmap.bytes;
+	return (bitmap[index / 8] & (1 << (index % 8))) == 0;
+}
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> %@ (type %lu, %lu values, %lu nil)", self.class, self, self.key, (unsigned long)self.type, (unsigned long)self.count, (unsigned long)self.nullCount];
+}
+
+@end
+
+#pragma mark Extraction
+
+// Chooses the column type for the NSNumber values of `accessor`, so that no
+// value loses precision.
+static MTLColumnType MTLColumnTypeForNumbers(MTLPropertyAccessor *accessor, NSArray *models) {
+	BOOL allBooleans = YES;
+	BOOL anyFloatingPoint = NO;
+	BOOL anyNegative = NO;
+	BOOL anyUnsignedOverflow = NO;
+	BOOL anyValue = NO;
+
+	for (id model in models) {
+		NSNumber *number = [accessor objectValueOfModel:model];
+		if (![number isKindOfClass:NSNumber.class]) continue;
+
+		anyValue = YES;
+
+		if (CFGetTypeID((__bridge CFTypeRef)number) == CFBooleanGetTypeID()) continue;
+		allBooleans = NO;
+
+		const char *objCType = number.objCType;
+		if (strcmp(objCType, @encode(float)) == 0 || strcmp(objCType, @encode(double)) == 0) {
+			anyFloatingPoint = YES;
+		} else if (strcmp(objCType, @encode(unsigned long long)) == 0 && number.unsignedLongLongValue > INT64_MAX) {
+			anyUnsignedOverflow = YES;
+		} else if (number.longLongValue < 0) {
+			anyNegative = YES;
+		}
+	}
+
+	if (!anyValue) return MTLColumnTypeInt64;
+	if (allBooleans) return MTLColumnTypeBool;
+	if (anyFloatingPoint || (anyUnsignedOverflow && anyNegative)) return MTLColumnTypeFloat64;
+	if (anyUnsignedOverflow) return MTLColumnTypeUInt64;
+
+	return MTLColumnTypeInt64;
+}
+
+// Returns the column type for the values of `accessor`, or 0 if the property
+// should not be exported.
+static MTLColumnType MTLColumnTypeForAccessor(MTLPropertyAccessor *accessor, NSArray *models) {
+	switch (accessor.type) {
+		case MTLPropertyAccessorTypeBool:
+			return MTLColumnTypeBool;
+
+		case MTLPropertyAccessorTypeSignedInteger:
+			return MTLColumnTypeInt64;
+
+		case MTLPropertyAccessorTypeUnsignedInteger:
+			return MTLColumnTypeUInt64;
+
+		case MTLPropertyAccessorTypeFloatingPoint:
+			return MTLColumnTypeFloat64;
+
+		case MTLPropertyAccessorTypeUnsupported:
+			return 0;
+
+		case MTLPropertyAccessorTypeObject:
+			break;
+	}
+
+	Class objectClass = accessor.objectClass;
+	if ([objectClass isSubclassOfClass:NSNumber.class]) return MTLColumnTypeForNumbers(accessor, models);
+	if ([objectClass isSubclassOfClass:NSString.class]) return MTLColumnTypeString;
+	if ([objectClass isSubclassOfClass:NSURL.class]) return MTLColumnTypeURL;
+	if ([objectClass isSubclassOfClass:NSData.class]) return MTLColumnTypeBinary;
+	if ([objectClass isSubclassOfClass:NSDate.class]) return MTLColumnTypeTimestamp;
+
+	return 0;
+}
+
+// Packs a fixed-width column, without boxing scalar properties.
+static MTLColumn *MTLFixedWidthColumn(MTLPropertyAccessor *accessor, MTLColumnType type, NSArray *models, NSMutableData *bitmap, NSError **error) {
+	NSUInteger count = models.count;
+	NSMutableData *values = [NSMutableData dataWithLength:count * MTLColumnTypeWidth(type)];
+	uint8_t *valueBytes = values.mutableBytes;
+	uint8_t *bitmapBytes = bitmap.mutableBytes;
+	NSUInteger nullCount = 0;
+
+	BOOL isObject = (accessor.type == MTLPropertyAccessorTypeObject);
+
+	for (NSUInteger index = 0; index < count; index++) {
+		id model = models[index];
+		id object = nil;
+
+		if (isObject) {
+			object = [accessor objectValueOfModel:model];
+			if (object == nil) {
+				nullCount++;
+				continue;
+			}
+
+			if (![object isKindOfClass:MTLColumnTypeObjectClass(type)]) {
+				if (error != NULL) *error = MTLColumnarBatchError(MTLColumnarBatchErrorInvalidValue, accessor.key, NSLocalizedString(@"The value of \"%@\" at index %@ is %@, not %@.", @""), @[ accessor.key, @(index), NSStringFromClass([object class]), NSStringFromClass(MTLColumnTypeObjectClass(type)) ]);
+				return nil;
+			}
+		}
+
+		bitmapBytes[index / 8] |= (uint8_t)(1 << (index % 8));
+
+		switch (type) {
+			case MTLColumnTypeBool:
+				valueBytes[index] = (isObject ? [object boolValue] : [accessor signedIntegerValueOfModel:model] != 0);
+				break;
+
+			case MTLColumnTypeInt64:
+				MTLColumnStoreUInt64(valueBytes, index, (uint64_t)(isObject ? [object longLongValue] : [accessor signedIntegerValueOfModel:model]));
+				break;
+
+			case MTLColumnTypeUInt64:
+				MTLColumnStoreUInt64(valueBytes, index, (isObject ? [object unsignedLongLongValue] : [accessor unsignedIntegerValueOfModel:model]));
+				break;
+
+			case MTLColumnTypeFloat64:
+				MTLColumnStoreDouble(valueBytes, index, (isObject ? [object doubleValue] : [accessor doubleValueOfModel:model]));
+				break;
+
+			case MTLColumnTypeTimestamp:
+				MTLColumnStoreDouble(valueBytes, index, [object timeIntervalSince1970]);
+				break;
+
+			default:
+				NSCAssert(NO, @"Unexpected fixed-width column type %lu", (unsigned long)type);
+		}
+	}
+
+	return [[MTLColumn alloc] initWithKey:accessor.key type:type count:count nullCount:nullCount validityBitmap:bitmap offsets:nil values:values];
+}
+
+// Packs a string, URL or binary column.
+static MTLColumn *MTLVariableWidthColumn(MTLPropertyAccessor *accessor, MTLColumnType type, NSArray *models, NSMutableData *bitmap, NSError **error) {
+	NSUInteger count = models.count;
+	NSMutableData *offsets = [NSMutableData dataWithLength:(count + 1) * sizeof(uint64_t)];
+	NSMutableData *values = [NSMutableData data];
+	uint8_t *offsetBytes = offsets.mutableBytes;
+	uint8_t *bitmapBytes = bitmap.mutableBytes;
+	NSUInteger nullCount = 0;
+
+	Class objectClass = MTLColumnTypeObjectClass(type);
+
+	for (NSUInteger index = 0; index < count; index++) {
+		id object = [accessor objectValueOfModel:models[index]];
+
+		if (object == nil) {
+			nullCount++;
+		} else if (![object isKindOfClass:objectClass]) {
+			if (error != NULL) *error = MTLColumnarBatchError(MTLColumnarBatchErrorInvalidValue, accessor.key, NSLocalizedString(@"The value of \"%@\" at index %@ is %@, not %@.", @""), @[ accessor.key, @(index), NSStringFromClass([object class]), NSStringFromClass(objectClass) ]);
+			return nil;
+		} else {
+			bitmapBytes[index / 8] |= (uint8_t)(1 << (index % 8));
+
+			if (type == MTLColumnTypeBinary) {
+				[values appendData:object];
+			} else {
+				NSString *string = (type == MTLColumnTypeURL ? [object absoluteString] : object);
+
+				NSUInteger start = values.length;
+				NSUInteger usedLength = 0;
+				values.length = start + [string maximumLengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+				[string getBytes:(uint8_t *)values.mutableBytes + start maxLength:values.length - start usedLength:&usedLength encoding:NSUTF8StringEncoding options:0 range:NSMakeRange(0, string.length) remainingRange:NULL];
+				values.length = start + usedLength;
+			}
+		}
+
+		MTLColumnStoreUInt64(offsetBytes, index + 1, values.length);
+	}
+
+	return [[MTLColumn alloc] initWithKey:accessor.key type:type count:count nullCount:nullCount validityBitmap:bitmap offsets:offsets values:values];
+}
+
+#pragma mark Serialization
+
+static void MTLColumnarBatchAppendUInt64(NSMutableData *data, uint64_t value) {
+	value = CFSwapInt64HostToLittle(value);
+	[data appendBytes:&value length:sizeof(value)];
+}
+
+// Appends the length of `bytes`, then `bytes` padded to a multiple of 8.
+static void MTLColumnarBatchAppendBuffer(NSMutableData *data, const void *bytes, NSUInteger length) {
+	MTLColumnarBatchAppendUInt64(data, length);
+	[data appendBytes:bytes length:length];
+
+	NSUInteger padding = (8 - length % 8) % 8;
+	if (padding > 0) [data increaseLengthBy:padding];
+}
+
+// The state of a read from serialized data.
+typedef struct {
+	__unsafe_unretained NSData *data;
+	const uint8_t *bytes;
+	NSUInteger length;
+	NSUInteger offset;
+} MTLColumnarBatchReader;
+
+static BOOL MTLColumnarBatchReadUInt64(MTLColumnarBatchReader *reader, uint64_t *value) {
+	if (reader->length - reader->offset < sizeof(uint64_t)) return NO;
+
+	*value = MTLColumnLoadUInt64(reader->bytes + reader->offset, 0);
+	reader->offset += sizeof(uint64_t);
+
+	return YES;
+}
+
+// Reads a length-prefixed, padded buffer.
+static NSData *MTLColumnarBatchReadBuffer(MTLColumnarBatchReader *reader) {
+	uint64_t length = 0;
+	if (!MTLColumnarBatchReadUInt64(reader, &length)) return nil;
+
+	uint64_t paddedLength = length + (8 - length % 8) % 8;
+	if (paddedLength < length || paddedLength > reader->length - reader->offset) return nil;
+
+	NSData *buffer = [reader->data subdataWithRange:NSMakeRange(reader->offset, (NSUInteger)length)];
+	reader->offset += (NSUInteger)paddedLength;
+
+	return buffer;
+}
+
+static NSError *MTLColumnarBatchInvalidDataError(const MTLColumnarBatchReader *reader) {
+	return MTLColumnarBatchError(MTLColumnarBatchErrorInvalidData, nil, NSLocalizedString(@"The data is corrupt near offset %@.", @""), @[ @(reader->offset) ]);
+}
+
+// Checks that the buffers of a column are consistent with each other.
+static BOOL MTLColumnIsValid(MTLColumn *column) {
+	NSUInteger count = column.count;
+	if (column.validityBitmap.length != (count + 7) / 8) return NO;
+
+	const uint8_t *bitmap = column.validityBitmap.bytes;
+	NSUInteger presentCount = 0;
+	for (NSUInteger index = 0; index < count; index++) {
+		if (bitmap[index / 8] & (1 << (index % 8))) presentCount++;
+	}
+
+	if (count - presentCount != column.nullCount) return NO;
+
+	if (MTLColumnTypeHasOffsets(column.type)) {
+		if (column.offsets.length != (count + 1) * sizeof(uint64_t)) return NO;
+
+		const uint8_t *offsets = column.offsets.bytes;
+		uint64_t previous = MTLColumnLoadUInt64(offsets, 0);
+		if (previous != 0) return NO;
+
+		for (NSUInteger index = 1; index <= count; index++) {
+			uint64_t offset = MTLColumnLoadUInt64(offsets, index);
+			if (offset < previous) return NO;
+
+			previous = offset;
+		}
+
+		return previous == column.values.length;
+	}
+
+	NSUInteger width = MTLColumnTypeWidth(column.type);
+	if (width == 0) return NO;
+
+	return column.offsets.length == 0 && column.values.length == count * width;
+}
+
+@interface MTLColumnarBatch ()
+
+// Maps property keys to MTLColumn objects.
+@property (nonatomic, copy, readonly) NSDictionary *columnsByKey;
+
+- (instancetype)initWithModelClass:(Class)modelClass count:(NSUInteger)count columns:(NSArray *)columns;
+
+@end
+
+@implementation MTLColumnarBatch
+
+#pragma mark Lifecycle
+
++ (instancetype)batchWithModels:(NSArray *)models ofClass:(Class)modelClass error:(NSError **)error {
+	NSParameterAssert(models != nil);
+	NSParameterAssert([modelClass conformsToProtocol:@protocol(MTLModel)]);
+
+	NSUInteger count = models.count;
+	NSMutableArray *columns = [NSMutableArray array];
+
+	for (MTLPropertyAccessor *accessor in [MTLPropertyAccessor accessorsForModelClass:modelClass]) {
+		MTLColumnType type = MTLColumnTypeForAccessor(accessor, models);
+		if (type == 0) continue;
+
+		NSMutableData *bitmap = [NSMutableData dataWithLength:(count + 7) / 8];
+
+		// Errors must outlive the autorelease pool.
+		MTLColumn *column = nil;
+		NSError *columnError = nil;
+
+		@autoreleasepool {
+			NSError *localError = nil;
+			if (MTLColumnTypeHasOffsets(type)) {
+				column = MTLVariableWidthColumn(accessor, type, models, bitmap, &localError);
+			} else {
+				column = MTLFixedWidthColumn(accessor, type, models, bitmap, &localError);
+			}
+
+			columnError = localError;
+		}
+
+		if (column == nil) {
+			if (error != NULL) *error = columnError;
+			return nil;
+		}
+
+		[columns addObject:column];
+	}
+
+	return [[self alloc] initWithModelClass:modelClass count:count columns:columns];
+}
+
++ (instancetype)batchWithData:(NSData *)data error:(NSError **)error {
+	NSParameterAssert(data != nil);
+
+	MTLColumnarBatchReader reader = {
+		.data = data,
+		.bytes = data.bytes,
+		.length = data.length,
+		.offset = sizeof(MTLColumnarBatchMagic),
+	};
+
+	if (data.length < sizeof(MTLColumnarBatchMagic) || memcmp(data.bytes, MTLColumnarBatchMagic, sizeof(MTLColumnarBatchMagic)) != 0) {
+		if (error != NULL) *error = MTLColumnarBatchError(MTLColumnarBatchErrorInvalidData, nil, NSLocalizedString(@"The data is not a columnar batch.", @""), nil);
+		return nil;
+	}
+
+	uint64_t count = 0;
+	uint64_t columnCount = 0;
+	NSData *classNameData = nil;
+
+	if (!MTLColumnarBatchReadUInt64(&reader, &count) || !MTLColumnarBatchReadUInt64(&reader, &columnCount) || (classNameData = MTLColumnarBatchReadBuffer(&reader)) == nil || count > NSUIntegerMax / 8) {
+		if (error != NULL) *error = MTLColumnarBatchInvalidDataError(&reader);
+		return nil;
+	}
+
+	NSString *className = [[NSString alloc] initWithData:classNameData encoding:NSUTF8StringEncoding];
+	Class modelClass = (className != nil ? NSClassFromString(className) : Nil);
+	if (![modelClass conformsToProtocol:@protocol(MTLModel)]) {
+		if (error != NULL) *error = MTLColumnarBatchError(MTLColumnarBatchErrorUnknownModelClass, nil, NSLocalizedString(@"%@ is not a model class.", @""), @[ className ?: @"(invalid)" ]);
+		return nil;
+	}
+
+	NSMutableArray *columns = [NSMutableArray array];
+	for (uint64_t columnIndex = 0; columnIndex < columnCount; columnIndex++) {
+		NSData *keyData = MTLColumnarBatchReadBuffer(&reader);
+		NSString *key = (keyData != nil ? [[NSString alloc] initWithData:keyData encoding:NSUTF8StringEncoding] : nil);
+
+		uint64_t type = 0;
+		uint64_t nullCount = 0;
+		NSData *bitmap = nil;
+		NSData *offsets = nil;
+		NSData *values = nil;
+
+		BOOL success = key != nil
+			&& MTLColumnarBatchReadUInt64(&reader, &type)
+			&& MTLColumnarBatchReadUInt64(&reader, &nullCount)
+			&& (bitmap = MTLColumnarBatchReadBuffer(&reader)) != nil
+			&& (offsets = MTLColumnarBatchReadBuffer(&reader)) != nil
+			&& (values = MTLColumnarBatchReadBuffer(&reader)) != nil;
+
+		MTLColumn *column = nil;
+		if (success) {
+			column = [[MTLColumn alloc] initWithKey:key type:(MTLColumnType)type count:(NSUInteger)count nullCount:(NSUInteger)nullCount validityBitmap:bitmap offsets:(MTLColumnTypeHasOffsets((MTLColumnType)type) ? offsets : nil) values:values];
+		}
+
+		if (column == nil || !MTLColumnIsValid(column) || (!MTLColumnTypeHasOffsets(column.type) && offsets.length > 0)) {
+			if (error != NULL) *error = MTLColumnarBatchInvalidDataError(&reader);
+			return nil;
+		}
+
+		[columns addObject:column];
+	}
+
+	if (reader.offset != reader.length) {
+		if (error != NULL) *error = MTLColumnarBatchInvalidDataError(&reader);
+		return nil;
+	}
+
+	return [[self alloc] initWithModelClass:modelClass count:(NSUInteger)count columns:columns];
+}
+
++ (instancetype)batchWithContentsOfURL:(NSURL *)URL error:(NSError **)error {
+	NSParameterAssert(URL != nil);
+
+	NSData *data = [NSData dataWithContentsOfURL:URL options:NSDataReadingMappedIfSafe error:error];
+	if (data == nil) return nil;
+
+	return [self batchWithData:data error:error];
+}
+
+- (instancetype)initWithModelClass:(Class)modelClass count:(NSUInteger)count columns:(NSArray *)columns {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_modelClass = modelClass;
+	_count = count;
+	_columns = [columns sortedArrayUsingComparator:^(MTLColumn *first, MTLColumn *second) {
+		return [first.key compare:second.key];
+	}];
+
+	NSMutableDictionary *columnsByKey = [NSMutableDictionary dictionaryWithCapacity:columns.count];
+	for (MTLColumn *column in columns) {
+		columnsByKey[column.key] = column;
+	}
+
+	_columnsByKey = [columnsByKey copy];
+
+	return self;
+}
+
+#pragma mark Columns
+
+- (MTLColumn *)columnForKey:(NSString *)key {
+	NSParameterAssert(key != nil);
+
+	return self.columnsByKey[key];
+}
+
+#pragma mark Serialization
+
+- (NSData *)dataRepresentation {
+	NSMutableData *data = [NSMutableData data];
+	[data appendBytes:MTLColumnarBatchMagic length:sizeof(MTLColumnarBatchMagic)];
+
+	MTLColumnarBatchAppendUInt64(data, self.count);
+	MTLColumnarBatchAppendUInt64(data, self.columns.count);
+
+	NSData *className = [NSStringFromClass(self.modelClass) dataUsingEncoding:NSUTF8StringEncoding];
+	MTLColumnarBatchAppendBuffer(data, className.bytes, className.length);
+
+	for (MTLColumn *column in self.columns) {
+		NSData *key = [column.key dataUsingEncoding:NSUTF8StringEncoding];
+		MTLColumnarBatchAppendBuffer(data, key.bytes, key.length);
+
+		MTLColumnarBatchAppendUInt64(data, column.type);
+		MTLColumnarBatchAppendUInt64(data, column.nullCount);
+		MTLColumnarBatchAppendBuffer(data, column.validityBitmap.bytes, column.validityBitmap.length);
+		MTLColumnarBatchAppendBuffer(data, column.offsets.bytes, column.offsets.length);
+		MTLColumnarBatchAppendBuffer(data, column.values.bytes, column.values.length);
+	}
+
+	return data;
+}
+
+- (BOOL)writeToURL:(NSURL *)URL error:(NSError **)error {
+	NSParameterAssert(URL != nil);
+
+	return [self.dataRepresentation writeToURL:URL options:NSDataWritingAtomic error:error];
+}
+
+#pragma mark Models
+
+// Returns whether values of a column of `type` can be set on the property of
+// `accessor`.
+static BOOL MTLColumnTypeMatchesAccessor(MTLColumnType type, MTLPropertyAccessor *accessor) {
+	switch (accessor.type) {
+		case MTLPropertyAccessorTypeBool:
+		case MTLPropertyAccessorTypeSignedInteger:
+		case MTLPropertyAccessorTypeUnsignedInteger:
+		case MTLPropertyAccessorTypeFloatingPoint:
+			return type == MTLColumnTypeBool || type == MTLColumnTypeInt64 || type == MTLColumnTypeUInt64 || type == MTLColumnTypeFloat64;
+
+		case MTLPropertyAccessorTypeObject:
+			return accessor.objectClass == Nil || [MTLColumnTypeObjectClass(type) isSubclassOfClass:accessor.objectClass];
+
+		case MTLPropertyAccessorTypeUnsupported:
+			return NO;
+	}
+
+	return NO;
+}
+
+// Returns the value at `index` of a column as an object, or nil if it is nil
+// or invalid.
+static id MTLColumnObjectAtIndex(MTLColumn *column, NSUInteger index) {
+	const uint8_t *values = column.values.bytes;
+
+	switch (column.type) {
+		case MTLColumnTypeBool:
+			return @(values[index] != 0);
+
+		case MTLColumnTypeInt64:
+			return @((long long)MTLColumnLoadUInt64(values, index));
+
+		case MTLColumnTypeUInt64:
+			return @(MTLColumnLoadUInt64(values, index));
+
+		case MTLColumnTypeFloat64:
+			return @(MTLColumnLoadDouble(values, index));
+
+		case MTLColumnTypeTimestamp:
+			return [NSDate dateWithTimeIntervalSince1970:MTLColumnLoadDouble(values, index)];
+
+		case MTLColumnTypeString:
+		case MTLColumnTypeURL:
+		case MTLColumnTypeBinary: {
+			const uint8_t *offsets = column.offsets.bytes;
+			NSUInteger start = (NSUInteger)MTLColumnLoadUInt64(offsets, index);
+			NSUInteger length = (NSUInteger)MTLColumnLoadUInt64(offsets, index + 1) - start;
+
+			if (column.type == MTLColumnTypeBinary) return [NSData dataWithBytes:values + start length:length];
+
+			NSString *string = [[NSString alloc] initWithBytes:values + start length:length encoding:NSUTF8StringEncoding];
+			if (column.type == MTLColumnTypeString || string == nil) return string;
+
+			return [NSURL URLWithString:string];
+		}
+	}
+
+	return nil;
+}
+
+// Sets the value at `index` of a column on a scalar property, without boxing.
+static void MTLColumnSetScalarAtIndex(MTLColumn *column, NSUInteger index, MTLPropertyAccessor *accessor, id model) {
+	const uint8_t *values = column.values.bytes;
+
+	switch (column.type) {
+		case MTLColumnTypeBool:
+			[accessor setSignedIntegerValue:values[index] ofModel:model];
+			break;
+
+		case MTLColumnTypeInt64:
+			[accessor setSignedIntegerValue:(long long)MTLColumnLoadUInt64(values, index) ofModel:model];
+			break;
+
+		case MTLColumnTypeUInt64:
+			[accessor setUnsignedIntegerValue:MTLColumnLoadUInt64(values, index) ofModel:model];
+			break;
+
+		case MTLColumnTypeFloat64:
+			[accessor setDoubleValue:MTLColumnLoadDouble(values, index) ofModel:model];
+			break;
+
+		default:
+			NSCAssert(NO, @"Column type %lu cannot be set on a scalar", (unsigned long)column.type);
+	}
+}
+
+- (NSArray *)modelsWithError:(NSError **)error {
+	NSMutableArray *accessors = [NSMutableArray array];
+	NSMutableArray *columns = [NSMutableArray array];
+
+	for (MTLPropertyAccessor *accessor in [MTLPropertyAccessor accessorsForModelClass:self.modelClass]) {
+		MTLColumn *column = self.columnsByKey[accessor.key];
+		if (column == nil || !accessor.writable) continue;
+
+		if (!MTLColumnTypeMatchesAccessor(column.type, accessor)) {
+			if (error != NULL) *error = MTLColumnarBatchError(MTLColumnarBatchErrorInvalidValue, accessor.key, NSLocalizedString(@"The column for \"%@\" has type %@, which does not match the property.", @""), @[ accessor.key, @(column.type) ]);
+			return nil;
+		}
+
+		[accessors addObject:accessor];
+		[columns addObject:column];
+	}
+
+	NSUInteger count = self.count;
+	NSUInteger columnCount = columns.count;
+	NSMutableArray *models = [NSMutableArray arrayWithCapacity:count];
+
+	// Errors must outlive the autorelease pools.
+	NSError *rowError = nil;
+
+	for (NSUInteger index = 0; index < count && rowError == nil; index++) {
+		@autoreleasepool {
+			id<MTLModel> model = [[self.modelClass alloc] init];
+
+			for (NSUInteger columnIndex = 0; columnIndex < columnCount; columnIndex++) {
+				MTLColumn *column = columns[columnIndex];
+				if ([column isNullAtIndex:index]) continue;
+
+				MTLPropertyAccessor *accessor = accessors[columnIndex];
+				if (accessor.type != MTLPropertyAccessorTypeObject) {
+					MTLColumnSetScalarAtIndex(column, index, accessor, model);
+					continue;
+				}
+
+				id value = MTLColumnObjectAtIndex(column, index);
+				if (value == nil) {
+					rowError = MTLColumnarBatchError(MTLColumnarBatchErrorInvalidData, accessor.key, NSLocalizedString(@"The value of \"%@\" at index %@ is invalid.", @""), @[ accessor.key, @(index) ]);
+					break;
+				}
+
+				[accessor setObjectValue:value ofModel:model];
+			}
+
+			NSError *validationError = nil;
+			if (rowError == nil && ![model validate:&validationError]) {
+				rowError = validationError;
+			}
+
+			if (rowError == nil) [models addObject:model];
+		}
+	}
+
+	if (rowError != nil) {
+		if (error != NULL) *error = rowError;
+		return nil;
+	}
+
+	return models;
+}
+
+@end
@@ -0,0 +1,43 @@
+//
+//  MTLDataEncoding.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/// Decodes a base64 string, as defined by RFC 4648.
+///
+/// string  - The string to decode. This argument must not be nil.
+/// URLSafe - Whether `string` uses the URL and filename safe alphabet, in
+///           which case its padding is optional. Otherwise, the string must be
+///           padded to a multiple of four characters.
+///
+/// Returns the decoded data, or nil if `string` is not valid base64 without any
+/// whitespace.
+NSData *MTLDataFromBase64String(NSString *string, BOOL URLSafe) __attribute__((nonnull(1)));
+
+/// Encodes data as base64, as defined by RFC 4648.
+///
+/// data    - The data to encode. This argument must not be nil.
+/// URLSafe - Whether to use the URL and filename safe alphabet without padding,
+///           instead of the standard alphabet with padding.
+///
+/// Returns a string of ASCII characters.
+NSString *MTLBase64StringFromData(NSData *data, BOOL URLSafe) __attribute__((nonnull(1)));
+
+/// Decodes a string of hexadecimal digit pairs, in upper or lower case.
+///
+/// string - The string to decode. This argument must not be nil.
+///
+/// Returns the decoded data, or nil if `string` is not valid.
+NSData *MTLDataFromHexString(NSString *string) __attribute__((nonnull(1)));
+
+/// Encodes data as pairs of lowercase hexadecimal digits.
+///
+/// data - The data to encode. This argument must not be nil.
+///
+/// Returns a string of ASCII characters.
+NSString *MTLHexStringFromData(NSData *data) __attribute__((nonnull(1)));
@@ -0,0 +1,225 @@
+//
+//  MTLDataEncoding.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLDataEncoding.h"
+
+// Marks characters outside of an alphabet in the decoding tables. All valid
+// entries fit into six bits, so OR-ing the entries of a group together and
+// checking the high bits detects invalid characters without branching.
+static const uint8_t MTLInvalidDigit = 0xFF;
+
+static const char MTLBase64StandardAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char MTLBase64URLAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+static const char MTLHexAlphabet[] = "0123456789abcdef";
+
+// Fills `table` with the value of every byte in `alphabet`, or MTLInvalidDigit
+// for bytes outside of it.
+static void MTLFillDecodingTable(uint8_t table[256], const char *alphabet) {
+	memset(table, MTLInvalidDigit, 256);
+
+	for (uint8_t value = 0; alphabet[value] != '\0'; value++) {
+		table[(uint8_t)alphabet[value]] = value;
+	}
+}
+
+static const uint8_t *MTLBase64DecodingTable(BOOL URLSafe) {
+	static uint8_t standardTable[256];
+	static uint8_t URLTable[256];
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		MTLFillDecodingTable(standardTable, MTLBase64StandardAlphabet);
+		MTLFillDecodingTable(URLTable, MTLBase64URLAlphabet);
+	});
+
+	return (URLSafe ? URLTable : standardTable);
+}
+
+static const uint8_t *MTLHexDecodingTable(void) {
+	static uint8_t table[256];
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		MTLFillDecodingTable(table, MTLHexAlphabet);
+
+		for (uint8_t value = 10; value < 16; value++) {
+			table['A' + value - 10] = value;
+		}
+	});
+
+	return table;
+}
+
+// Invokes `block` with the ASCII bytes of `string`.
+//
+// Most strings decoded from JSON store their contents as 8-bit characters, in
+// which case the bytes are used without copying them. Any non-ASCII characters
+// are passed as bytes outside of the ASCII range, so they are rejected by the
+// decoding tables.
+static id MTLDecodeASCIIString(NSString *string, id (^block)(const uint8_t *bytes, NSUInteger length)) {
+	NSUInteger length = string.length;
+
+	// Up to the first non-ASCII character, UTF-8 and ASCII are identical, and
+	// that character's lead byte is within the first `length` bytes.
+	const char *bytes = CFStringGetCStringPtr((__bridge CFStringRef)string, kCFStringEncodingUTF8);
+	if (bytes != NULL) return block((const uint8_t *)bytes, length);
+
+	NSMutableData *buffer = [NSMutableData dataWithLength:length];
+	NSRange remainingRange = NSMakeRange(0, 0);
+	BOOL success = [string getBytes:buffer.mutableBytes maxLength:length usedLength:NULL encoding:NSASCIIStringEncoding options:0 range:NSMakeRange(0, length) remainingRange:&remainingRange];
+	if (!success || remainingRange.length > 0) return nil;
+
+	return block(buffer.bytes, length);
+}
+
+// Creates a string which takes ownership of the given malloc'd ASCII buffer.
+static NSString *MTLStringWithASCIIBuffer(char *buffer, NSUInteger length) {
+	NSString *string = [[NSString alloc] initWithBytesNoCopy:buffer length:length encoding:NSASCIIStringEncoding freeWhenDone:YES];
+	if (string == nil) free(buffer);
+
+	return string;
+}
+
+NSData *MTLDataFromBase64String(NSString *string, BOOL URLSafe) {
+	NSCParameterAssert(string != nil);
+
+	const uint8_t *table = MTLBase64DecodingTable(URLSafe);
+
+	return MTLDecodeASCIIString(string, ^ id (const uint8_t *bytes, NSUInteger length) {
+		if (!URLSafe && length % 4 != 0) return nil;
+
+		// Strip up to two padding characters.
+		if (length > 0 && bytes[length - 1] == '=') length--;
+		if (length > 0 && bytes[length - 1] == '=') length--;
+
+		NSUInteger remainder = length % 4;
+		if (remainder == 1) return nil;
+
+		NSUInteger groups = length / 4;
+		NSUInteger decodedLength = groups * 3 + (remainder == 0 ? 0 : remainder - 1);
+
+		NSMutableData *data = [NSMutableData dataWithLength:decodedLength];
+		uint8_t *output = data.mutableBytes;
+
+		uint8_t invalid = 0;
+		for (NSUInteger group = 0; group < groups; group++) {
+			const uint8_t *input = bytes + group * 4;
+			uint8_t a = table[input[0]], b = table[input[1]], c = table[input[2]], d = table[input[3]];
+			invalid |= a | b | c | d;
+
+			uint32_t value = (uint32_t)(a & 0x3F) << 18 | (uint32_t)(b & 0x3F) << 12 | (uint32_t)(c & 0x3F) << 6 | (uint32_t)(d & 0x3F);
+			output[group * 3] = (uint8_t)(value >> 16);
+			output[group * 3 + 1] = (uint8_t)(value >> 8);
+			output[group * 3 + 2] = (uint8_t)value;
+		}
+
+		if (remainder > 0) {
+			const uint8_t *input = bytes + groups * 4;
+			uint8_t *tail = output + groups * 3;
+
+			uint8_t a = table[input[0]], b = table[input[1]];
+			uint8_t c = (remainder == 3 ? table[input[2]] : 0);
+			invalid |= a | b | c;
+
+			uint32_t value = (uint32_t)(a & 0x3F) << 18 | (uint32_t)(b & 0x3F) << 12 | (uint32_t)(c & 0x3F) << 6;
+			tail[0] = (uint8_t)(value >> 16);
+			if (remainder == 3) tail[1] = (uint8_t)(value >> 8);
+		}
+
+		if ((invalid & 0xC0) != 0) return nil;
+
+		return data;
+	});
+}
+
+NSString *MTLBase64StringFromData(NSData *data, BOOL URLSafe) {
+	NSCParameterAssert(data != nil);
+
+	const char *alphabet = (URLSafe ? MTLBase64URLAlphabet : MTLBase64StandardAlphabet);
+	const uint8_t *input = data.bytes;
+	NSUInteger length = data.length;
+
+	NSUInteger groups = length / 3;
+	NSUInteger remainder = length % 3;
+
+	NSUInteger encodedLength = groups * 4;
+	if (remainder > 0) encodedLength += (URLSafe ? remainder + 1 : 4);
+
+	char *output = malloc(MAX(encodedLength, 1));
+
+	for (NSUInteger group = 0; group < groups; group++) {
+		const uint8_t *bytes = input + group * 3;
+		uint32_t value = (uint32_t)bytes[0] << 16 | (uint32_t)bytes[1] << 8 | (uint32_t)bytes[2];
+
+		char *characters = output + group * 4;
+		characters[0] = alphabet[(value >> 18) & 0x3F];
+		characters[1] = alphabet[(value >> 12) & 0x3F];
+		characters[2] = alphabet[(value >> 6) & 0x3F];
+		characters[3] = alphabet[value & 0x3F];
+	}
+
+	if (remainder > 0) {
+		const uint8_t *bytes = input + groups * 3;
+		uint32_t value = (uint32_t)bytes[0] << 16 | (remainder == 2 ? (uint32_t)bytes[1] << 8 : 0);
+
+		char *characters = output + groups * 4;
+		characters[0] = alphabet[(value >> 18) & 0x3F];
+		characters[1] = alphabet[(value >> 12) & 0x3F];
+
+		if (remainder == 2) {
+			characters[2] = alphabet[(value >> 6) & 0x3F];
+		} else if (!URLSafe) {
+			characters[2] = '=';
+		}
+
+		if (!URLSafe) characters[3] = '=';
+	}
+
+	return MTLStringWithASCIIBuffer(output, encodedLength);
+}
+
+NSData *MTLDataFromHexString(NSString *string) {
+	NSCParameterAssert(string != nil);
+
+	const uint8_t *table = MTLHexDecodingTable();
+
+	return MTLDecodeASCIIString(string, ^ id (const uint8_t *bytes, NSUInteger length) {
+		if (length % 2 != 0) return nil;
+
+		NSMutableData *data = [NSMutableData dataWithLength:length / 2];
+		uint8_t *output = data.mutableBytes;
+
+		// Hexadecimal digits fit into four bits, so this catches
+		// MTLInvalidDigit as well.
+		uint8_t invalid = 0;
+		for (NSUInteger index = 0; index < length / 2; index++) {
+			uint8_t high = table[bytes[index * 2]], low = table[bytes[index * 2 + 1]];
+			invalid |= high | low;
+
+			output[index] = (uint8_t)((high << 4) | (low & 0x0F));
+		}
+
+		if ((invalid & 0xF0) != 0) return nil;
+
+		return data;
+	});
+}
+
+NSString *MTLHexStringFromData(NSData *data) {
+	NSCParameterAssert(data != nil);
+
+	const uint8_t *input = data.bytes;
+	NSUInteger length = data.length;
+
+	char *output = malloc(MAX(length * 2, 1));
+
+	for (NSUInteger index = 0; index < length; index++) {
+		output[index * 2] = MTLHexAlphabet[input[index] >> 4];
+		output[index * 2 + 1] = MTLHexAlphabet[input[index] & 0x0F];
+	}
+
+	return MTLStringWithASCIIBuffer(output, length * 2);
+}
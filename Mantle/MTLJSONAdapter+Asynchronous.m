@@ -0,0 +1,270 @@
+//
+//  MTLJSONAdapter+Asynchronous.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLJSONAdapter+Asynchronous.h"
+
+// The number of objects converted by a worker before reporting progress.
+static const NSUInteger MTLJSONAdapterAsynchronousChunkSize = 128;
+
+// Returns the global concurrent queue matching the given quality of service.
+static dispatch_queue_t MTLGlobalQueueForQualityOfService(NSQualityOfService qualityOfService) {
+	switch (qualityOfService) {
+		case NSQualityOfServiceUserInteractive:
+			return dispatch_get_global_queue(QOS_CLASS_USER_INTERACTIVE, 0);
+
+		case NSQualityOfServiceUserInitiated:
+			return dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0);
+
+		case NSQualityOfServiceUtility:
+			return dispatch_get_global_queue(QOS_CLASS_UTILITY, 0);
+
+		case NSQualityOfServiceBackground:
+			return dispatch_get_global_queue(QOS_CLASS_BACKGROUND, 0);
+
+		case NSQualityOfServiceDefault:
+		default:
+			return dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0);
+	}
+}
+
+static NSError *MTLCancellationError(void) {
+	return [NSError errorWithDomain:NSCocoaErrorDomain code:NSUserCancelledError userInfo:nil];
+}
+
+// Converts `values` on worker threads by invoking `convert` once per chunk,
+// then invokes `completion` on `completionQueue` with all results in order.
+//
+// `convert` returns an array with one result per element of the chunk, or nil
+// if the conversion failed. It should check whether `progress` has been
+// cancelled before each element, and return nil if so.
+static NSProgress *MTLConvertAsynchronously(NSArray *values, NSQualityOfService qualityOfService, dispatch_queue_t completionQueue, NSArray *(^convert)(NSArray *chunk, NSProgress *progress, NSError **error), void (^completion)(NSArray *results, NSError *error)) {
+	NSCParameterAssert(values != nil);
+	NSCParameterAssert(convert != nil);
+	NSCParameterAssert(completion != nil);
+
+	NSUInteger count = values.count;
+	NSProgress *progress = [NSProgress progressWithTotalUnitCount:(int64_t)count];
+	progress.cancellable = YES;
+	progress.pausable = NO;
+
+	dispatch_queue_t workQueue = MTLGlobalQueueForQualityOfService(qualityOfService);
+	if (completionQueue == nil) completionQueue = dispatch_get_main_queue();
+
+	dispatch_async(workQueue, ^{
+		NSUInteger chunkCount = (count + MTLJSONAdapterAsynchronousChunkSize - 1) / MTLJSONAdapterAsynchronousChunkSize;
+
+		// Guards `chunkResults`, `failed` and `firstError`.
+		NSObject *lock = [[NSObject alloc] init];
+		NSMutableArray *chunkResults = [NSMutableArray arrayWithCapacity:chunkCount];
+		__block BOOL failed = NO;
+		__block NSError *firstError = nil;
+
+		for (NSUInteger chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++) {
+			[chunkResults addObject:NSNull.null];
+		}
+
+		// dispatch_apply() runs at most as many chunks at once as there are
+		// processors available to the queue.
+		dispatch_apply(chunkCount, workQueue, ^(size_t chunkIndex) {
+			if (progress.cancelled) return;
+
+			@synchronized (lock) {
+				if (failed) return;
+			}
+
+			NSRange range = NSMakeRange(chunkIndex * MTLJSONAdapterAsynchronousChunkSize, 0);
+			range.length = MIN(MTLJSONAdapterAsynchronousChunkSize, count - range.location);
+
+			NSError *error = nil;
+			NSArray *results = nil;
+			@autoreleasepool {
+				results = convert([values subarrayWithRange:range], progress, &error);
+			}
+
+			@synchronized (lock) {
+				if (results == nil) {
+					if (!failed) firstError = error;
+					failed = YES;
+					return;
+				}
+
+				chunkResults[chunkIndex] = results;
+				progress.completedUnitCount += (int64_t)range.length;
+			}
+		});
+
+		NSArray *results = nil;
+		NSError *error = nil;
+
+		if (progress.cancelled) {
+			error = MTLCancellationError();
+		} else if (failed) {
+			error = firstError;
+		} else {
+			NSMutableArray *allResults = [NSMutableArray arrayWithCapacity:count];
+			for (NSArray *chunk in chunkResults) {
+				[allResults addObjectsFromArray:chunk];
+			}
+
+			results = allResults;
+		}
+
+		dispatch_async(completionQueue, ^{
+			completion(results, error);
+		});
+	});
+
+	return progress;
+}
+
+@implementation MTLJSONAdapter (Asynchronous)
+
++ (NSProgress *)modelOfClass:(Class)modelClass fromJSONDictionary:(NSDictionary *)JSONDictionary qualityOfService:(NSQualityOfService)qualityOfService completionQueue:(dispatch_queue_t)completionQueue completion:(void (^)(id model, NSError *error))completion {
+	NSParameterAssert(modelClass != nil);
+	NSParameterAssert(completion != nil);
+
+	return MTLConvertAsynchronously(@[ JSONDictionary ?: NSNull.null ], qualityOfService, completionQueue, ^ NSArray * (NSArray *chunk, NSProgress *progress, NSError **error) {
+		id value = chunk.firstObject;
+		id model = [self modelOfClass:modelClass fromJSONDictionary:(value == NSNull.null ? nil : value) error:error];
+
+		return (model != nil ? @[ model ] : nil);
+	}, ^(NSArray *results, NSError *error) {
+		completion(results.firstObject, error);
+	});
+}
+
++ (NSProgress *)modelsOfClass:(Class)modelClass fromJSONArray:(NSArray *)JSONArray qualityOfService:(NSQualityOfService)qualityOfService completionQueue:(dispatch_queue_t)completionQueue completion:(void (^)(NSArray *models, NSError *error))completion {
+	NSParameterAssert(modelClass != nil);
+	NSParameterAssert(completion != nil);
+
+	if (JSONArray == nil || ![JSONArray isKindOfClass:NSArray.class]) {
+		// Let the synchronous method describe the problem.
+		NSError *error = nil;
+		[self modelsOfClass:modelClass fromJSONArray:JSONArray error:&error];
+
+		dispatch_async(completionQueue ?: dispatch_get_main_queue(), ^{
+			completion(nil, error);
+		});
+
+		return [NSProgress progressWithTotalUnitCount:0];
+	}
+
+	// Adapters can be used from multiple threads, so all chunks share one.
+	__block MTLJSONAdapter *adapter = nil;
+	NSObject *adapterLock = [[NSObject alloc] init];
+
+	return MTLConvertAsynchronously(JSONArray, qualityOfService, completionQueue, ^ NSArray * (NSArray *chunk, NSProgress *progress, NSError **error) {
+		MTLJSONAdapter *chunkAdapter = nil;
+		@synchronized (adapterLock) {
+			if (adapter == nil) adapter = [[self alloc] initWithModelClass:modelClass];
+			chunkAdapter = adapter;
+		}
+
+		NSMutableArray *models = [NSMutableArray arrayWithCapacity:chunk.count];
+		for (NSDictionary *JSONDictionary in chunk) {
+			if (progress.cancelled) return nil;
+
+			id model = [chunkAdapter modelFromJSONDictionary:JSONDictionary error:error];
+			if (model == nil) return nil;
+
+			[models addObject:model];
+		}
+
+		return models;
+	}, completion);
+}
+
++ (NSProgress *)modelsOfClass:(Class)modelClass fromJSONData:(NSData *)JSONData qualityOfService:(NSQualityOfService)qualityOfService completionQueue:(dispatch_queue_t)completionQueue completion:(void (^)(NSArray *models, NSError *error))completion {
+	NSParameterAssert(modelClass != nil);
+	NSParameterAssert(JSONData != nil);
+	NSParameterAssert(completion != nil);
+
+	// Parsing is one unit of work, and decoding the parsed array the other.
+	NSProgress *progress = [NSProgress progressWithTotalUnitCount:2];
+	progress.cancellable = YES;
+	progress.pausable = NO;
+
+	if (completionQueue == nil) completionQueue = dispatch_get_main_queue();
+
+	dispatch_async(MTLGlobalQueueForQualityOfService(qualityOfService), ^{
+		NSError *error = nil;
+		id JSONArray = nil;
+
+		if (!progress.cancelled) {
+			@autoreleasepool {
+				NSError *parsingError = nil;
+				JSONArray = [NSJSONSerialization JSONObjectWithData:JSONData options:0 error:&parsingError];
+				error = parsingError;
+			}
+		}
+
+		if (progress.cancelled || JSONArray == nil) {
+			if (progress.cancelled) error = MTLCancellationError();
+
+			dispatch_async(completionQueue, ^{
+				completion(nil, error);
+			});
+
+			return;
+		}
+
+		progress.completedUnitCount = 1;
+
+		[progress becomeCurrentWithPendingUnitCount:1];
+		NSProgress *decodingProgress = [self modelsOfClass:modelClass fromJSONArray:JSONArray qualityOfService:qualityOfService completionQueue:completionQueue completion:completion];
+		[progress resignCurrent];
+
+		// The progress may have been cancelled before decoding started.
+		if (progress.cancelled) [decodingProgress cancel];
+	});
+
+	return progress;
+}
+
++ (NSProgress *)JSONDictionaryFromModel:(id<MTLJSONSerializing>)model qualityOfService:(NSQualityOfService)qualityOfService completionQueue:(dispatch_queue_t)completionQueue completion:(void (^)(NSDictionary *JSONDictionary, NSError *error))completion {
+	NSParameterAssert(model != nil);
+	NSParameterAssert(completion != nil);
+
+	return MTLConvertAsynchronously(@[ model ], qualityOfService, completionQueue, ^ NSArray * (NSArray *chunk, NSProgress *progress, NSError **error) {
+		NSDictionary *JSONDictionary = [self JSONDictionaryFromModel:chunk.firstObject error:error];
+
+		return (JSONDictionary != nil ? @[ JSONDictionary ] : nil);
+	}, ^(NSArray *results, NSError *error) {
+		completion(results.firstObject, error);
+	});
+}
+
++ (NSProgress *)JSONArrayFromModels:(NSArray *)models qualityOfService:(NSQualityOfService)qualityOfService completionQueue:(dispatch_queue_t)completionQueue completion:(void (^)(NSArray *JSONArray, NSError *error))completion {
+	NSParameterAssert(models != nil);
+	NSParameterAssert([models isKindOfClass:NSArray.class]);
+	NSParameterAssert(completion != nil);
+
+	return MTLConvertAsynchronously(models, qualityOfService, completionQueue, ^ NSArray * (NSArray *chunk, NSProgress *progress, NSError **error) {
+		NSMutableArray *JSONArray = [NSMutableArray arrayWithCapacity:chunk.count];
+
+		// Reused for consecutive models of the same class.
+		MTLJSONAdapter *adapter = nil;
+
+		for (MTLModel<MTLJSONSerializing> *model in chunk) {
+			if (progress.cancelled) return nil;
+
+			if (adapter == nil || adapter.modelClass != model.class) {
+				adapter = [[self alloc] initWithModelClass:model.class];
+			}
+
+			NSDictionary *JSONDictionary = [adapter JSONDictionaryFromModel:model error:error];
+			if (JSONDictionary == nil) return nil;
+
+			[JSONArray addObject:JSONDictionary];
+		}
+
+		return JSONArray;
+	}, completion);
+}
+
+@end
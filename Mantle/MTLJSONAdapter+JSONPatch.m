@@ -0,0 +1,918 @@
+//
+//  MTLJSONAdapter+JSONPatch.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <objc/runtime.h>
+
+#import "MTLJSONAdapter+JSONPatch.h"
+#import "MTLModel.h"
+#import "MTLModel+Updating.h"
+#import "MTLTransformerErrorHandling.h"
+#import "NSError+MTLLazyDescription.h"
+#import "NSError+MTLModelException.h"
+
+static void *MTLJSONAdapterCachedJSONPatchMappingKey = &MTLJSONAdapterCachedJSONPatchMappingKey;
+
+@interface MTLJSONAdapter (MTLJSONPatchPrivate)
+
+// Implemented by MTLJSONAdapter.
+@property (nonatomic, strong, readonly) Class modelClass;
+@property (nonatomic, copy, readonly) NSDictionary *JSONKeyPathsByPropertyKey;
+@property (nonatomic, copy, readonly) NSDictionary *valueTransformersByPropertyKey;
+- (MTLJSONAdapter *)JSONAdapterForModelClass:(Class)modelClass error:(NSError **)error;
+
+@end
+
+// Creates an error describing why `operation` could not be applied.
+static NSError *MTLJSONPatchError(NSDictionary *operation, NSString *failureReasonFormat, NSArray *arguments) {
+	NSDictionary *userInfo = ([operation isKindOfClass:NSDictionary.class] ? @{ MTLJSONAdapterJSONPatchOperationErrorKey: operation } : nil);
+
+	return [NSError mtl_errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONPatch descriptionFormat:NSLocalizedString(@"Could not apply JSON patch", @"") failureReasonFormat:failureReasonFormat arguments:arguments userInfo:userInfo];
+}
+
+// Splits an RFC 6901 JSON pointer into its unescaped reference tokens.
+//
+// Returns an array of strings, which is empty for the pointer to the whole
+// document, or nil if `pointer` is not a valid JSON pointer.
+static NSArray *MTLJSONPointerTokens(id pointer) {
+	if (![pointer isKindOfClass:NSString.class]) return nil;
+	if ([pointer length] == 0) return @[];
+	if (![pointer hasPrefix:@"/"]) return nil;
+
+	NSArray *components = [[pointer substringFromIndex:1] componentsSeparatedByString:@"/"];
+	NSMutableArray *tokens = [[NSMutableArray alloc] initWithCapacity:components.count];
+
+	for (NSString *component in components) {
+		NSString *token = component;
+		if ([token rangeOfString:@"~"].location != NSNotFound) {
+			token = [[token stringByReplacingOccurrencesOfString:@"~1" withString:@"/"] stringByReplacingOccurrencesOfString:@"~0" withString:@"~"];
+		}
+
+		[tokens addObject:token];
+	}
+
+	return tokens;
+}
+
+// Parses a reference token into an index of an array with `count` elements,
+// where "-" refers to the index past the last element.
+//
+// Returns the index, or NSNotFound if `token` is not a valid array index.
+static NSUInteger MTLJSONPointerArrayIndex(NSString *token, NSUInteger count) {
+	if ([token isEqualToString:@"-"]) return count;
+
+	// Leading zeros are not allowed, and longer tokens could overflow.
+	NSUInteger length = token.length;
+	if (length == 0 || length > 18 || (length > 1 && [token characterAtIndex:0] == '0')) return NSNotFound;
+
+	NSUInteger index = 0;
+	for (NSUInteger i = 0; i < length; i++) {
+		unichar character = [token characterAtIndex:i];
+		if (character < '0' || character > '9') return NSNotFound;
+
+		index = index * 10 + (character - '0');
+	}
+
+	return index;
+}
+
+// Returns whether `tokens` starts with all of the elements of `prefix`.
+static BOOL MTLJSONPointerTokensHavePrefix(NSArray *tokens, NSArray *prefix) {
+	if (prefix.count > tokens.count) return NO;
+
+	for (NSUInteger i = 0; i < prefix.count; i++) {
+		if (![tokens[i] isEqualToString:prefix[i]]) return NO;
+	}
+
+	return YES;
+}
+
+// Resolves the tokens of `tokens` from `tokenIndex` on in a JSON value.
+//
+// Returns the value at the location, or nil if the location does not exist.
+static id MTLJSONValueAtTokens(id JSONValue, NSArray *tokens, NSUInteger tokenIndex) {
+	for (NSUInteger i = tokenIndex; i < tokens.count && JSONValue != nil; i++) {
+		NSString *token = tokens[i];
+
+		if ([JSONValue isKindOfClass:NSDictionary.class]) {
+			JSONValue = [JSONValue objectForKey:token];
+		} else if ([JSONValue isKindOfClass:NSArray.class]) {
+			NSArray *array = JSONValue;
+			NSUInteger index = MTLJSONPointerArrayIndex(token, array.count);
+
+			JSONValue = (index < array.count ? array[index] : nil);
+		} else {
+			return nil;
+		}
+	}
+
+	return JSONValue;
+}
+
+// Applies an "add", "remove" or "replace" operation to a JSON value at the
+// location of `tokens` from `tokenIndex` on, which must refer to a member of
+// the value.
+//
+// Only the containers along the path to the location are copied.
+//
+// Returns the updated JSON value, or nil if the location does not exist.
+static id MTLJSONValueByApplyingOperation(id JSONValue, NSString *operationName, NSArray *tokens, NSUInteger tokenIndex, id value) {
+	NSCParameterAssert(tokenIndex < tokens.count);
+
+	NSString *token = tokens[tokenIndex];
+	BOOL last = (tokenIndex + 1 == tokens.count);
+
+	if ([JSONValue isKindOfClass:NSDictionary.class]) {
+		id member = [JSONValue objectForKey:token];
+		if (member == nil && !(last && [operationName isEqualToString:@"add"])) return nil;
+
+		NSMutableDictionary *dictionary = [JSONValue mutableCopy];
+
+		if (!last) {
+			id newMember = MTLJSONValueByApplyingOperation(member, operationName, tokens, tokenIndex + 1, value);
+			if (newMember == nil) return nil;
+
+			dictionary[token] = newMember;
+		} else if ([operationName isEqualToString:@"remove"]) {
+			[dictionary removeObjectForKey:token];
+		} else {
+			dictionary[token] = value;
+		}
+
+		return [dictionary copy];
+	}
+
+	if ([JSONValue isKindOfClass:NSArray.class]) {
+		NSUInteger count = [JSONValue count];
+		NSUInteger index = MTLJSONPointerArrayIndex(token, count);
+
+		BOOL inserting = (last && [operationName isEqualToString:@"add"]);
+		if (index == NSNotFound || index > count || (index == count && !inserting)) return nil;
+
+		NSMutableArray *array = [JSONValue mutableCopy];
+
+		if (!last) {
+			id newElement = MTLJSONValueByApplyingOperation(array[index], operationName, tokens, tokenIndex + 1, value);
+			if (newElement == nil) return nil;
+
+			array[index] = newElement;
+		} else if (inserting) {
+			[array insertObject:value atIndex:index];
+		} else if ([operationName isEqualToString:@"remove"]) {
+			[array removeObjectAtIndex:index];
+		} else {
+			array[index] = value;
+		}
+
+		return [array copy];
+	}
+
+	return nil;
+}
+
+// Returns whether two JSON values are equal as defined for the "test"
+// operation by RFC 6902, which unlike -isEqual: tells booleans and numbers
+// apart.
+static BOOL MTLJSONValuesAreEqual(id value, id otherValue) {
+	if (value == otherValue) return YES;
+
+	if ([value isKindOfClass:NSNumber.class] && [otherValue isKindOfClass:NSNumber.class]) {
+		BOOL boolean = (CFGetTypeID((__bridge CFTypeRef)value) == CFBooleanGetTypeID());
+		BOOL otherBoolean = (CFGetTypeID((__bridge CFTypeRef)otherValue) == CFBooleanGetTypeID());
+
+		// BOOL properties are boxed as chars where BOOL is a signed char, so
+		// those still match booleans.
+		if (boolean != otherBoolean) {
+			NSNumber *number = (boolean ? otherValue : value);
+			if (strcmp(number.objCType, @encode(char)) != 0) return NO;
+		}
+
+		return [value isEqualToNumber:otherValue];
+	}
+
+	if ([value isKindOfClass:NSString.class] && [otherValue isKindOfClass:NSString.class]) {
+		return [value isEqualToString:otherValue];
+	}
+
+	if ([value isKindOfClass:NSArray.class] && [otherValue isKindOfClass:NSArray.class]) {
+		NSArray *array = value;
+		NSArray *otherArray = otherValue;
+		if (array.count != otherArray.count) return NO;
+
+		for (NSUInteger index = 0; index < array.count; index++) {
+			if (!MTLJSONValuesAreEqual(array[index], otherArray[index])) return NO;
+		}
+
+		return YES;
+	}
+
+	if ([value isKindOfClass:NSDictionary.class] && [otherValue isKindOfClass:NSDictionary.class]) {
+		NSDictionary *dictionary = value;
+		NSDictionary *otherDictionary = otherValue;
+		if (dictionary.count != otherDictionary.count) return NO;
+
+		for (NSString *key in dictionary) {
+			id otherMember = otherDictionary[key];
+			if (otherMember == nil || !MTLJSONValuesAreEqual(dictionary[key], otherMember)) return NO;
+		}
+
+		return YES;
+	}
+
+	return [value isEqual:NSNull.null] && [otherValue isEqual:NSNull.null];
+}
+
+// Returns whether `value` is a non-empty array of models conforming to
+// <MTLJSONSerializing>, like the values of +arrayTransformerWithModelClass:.
+static BOOL MTLJSONPatchIsArrayOfModels(id value) {
+	if (![value isKindOfClass:NSArray.class] || [value count] == 0) return NO;
+
+	for (id element in value) {
+		if (![element conformsToProtocol:@protocol(MTLJSONSerializing)]) return NO;
+	}
+
+	return YES;
+}
+
+// Returns a shallow copy of `model`. Unlike -copy, this never returns the
+// model itself.
+//
+// Only used for models which are not MTLModels, since those are copied with
+// -modelByUpdatingValues:error: instead.
+static id MTLJSONPatchCopyOfModel(id<MTLModel> model) {
+	NSObject<MTLModel> *copy = [[model.class alloc] init];
+	[copy setValuesForKeysWithDictionary:model.dictionaryValue];
+
+	return copy;
+}
+
+// The inverse of the +JSONKeyPathsByPropertyKey of a model class, used to
+// resolve the locations of JSON Patch operations to properties.
+@interface MTLJSONPatchMapping : NSObject
+
+- (instancetype)initWithJSONKeyPathsByPropertyKey:(NSDictionary *)JSONKeyPathsByPropertyKey;
+
+// Maps the JSON key paths of properties which are mapped to a single key path
+// to their property keys.
+@property (nonatomic, copy, readonly) NSDictionary *propertyKeysByJSONKeyPath;
+
+// Maps property keys to arrays holding the components of each of their JSON
+// key paths.
+@property (nonatomic, copy, readonly) NSDictionary *JSONKeyPathComponentsByPropertyKey;
+
+// Whether any JSON key path equals or contains another one, in which case a
+// single location may affect several properties.
+@property (nonatomic, assign, readonly) BOOL hasOverlappingKeyPaths;
+
+// Looks up the property mapped to a single JSON key path which equals or
+// contains the location of `tokens`.
+//
+// This is only possible if the key paths do not overlap, since the location
+// could affect several properties otherwise.
+//
+// matchedCount - Set to the number of components of the property's key path.
+//
+// Returns the property key, or nil if there is no such property or the key
+// paths overlap.
+- (NSString *)propertyKeyForTokens:(NSArray *)tokens matchedCount:(NSUInteger *)matchedCount;
+
+// Returns the keys of all properties with a JSON key path which contains, is
+// contained in or equals the location of `tokens`.
+- (NSArray *)propertyKeysAffectedByTokens:(NSArray *)tokens;
+
+@end
+
+@implementation MTLJSONPatchMapping
+
+- (instancetype)initWithJSONKeyPathsByPropertyKey:(NSDictionary *)JSONKeyPathsByPropertyKey {
+	self = [super init];
+	if (self == nil) return nil;
+
+	NSMutableDictionary *propertyKeysByJSONKeyPath = [[NSMutableDictionary alloc] initWithCapacity:JSONKeyPathsByPropertyKey.count];
+	NSMutableDictionary *componentsByPropertyKey = [[NSMutableDictionary alloc] initWithCapacity:JSONKeyPathsByPropertyKey.count];
+	NSMutableArray *allKeyPaths = [[NSMutableArray alloc] initWithCapacity:JSONKeyPathsByPropertyKey.count];
+
+	for (NSString *propertyKey in JSONKeyPathsByPropertyKey) {
+		id JSONKeyPaths = JSONKeyPathsByPropertyKey[propertyKey];
+		NSArray *keyPaths = ([JSONKeyPaths isKindOfClass:NSArray.class] ? JSONKeyPaths : @[ JSONKeyPaths ]);
+
+		NSMutableArray *components = [[NSMutableArray alloc] initWithCapacity:keyPaths.count];
+		for (NSString *keyPath in keyPaths) {
+			[components addObject:[keyPath componentsSeparatedByString:@"."]];
+			[allKeyPaths addObject:keyPath];
+		}
+
+		componentsByPropertyKey[propertyKey] = components;
+		if (![JSONKeyPaths isKindOfClass:NSArray.class]) propertyKeysByJSONKeyPath[JSONKeyPaths] = propertyKey;
+	}
+
+	NSSet *uniqueKeyPaths = [NSSet setWithArray:allKeyPaths];
+	BOOL overlapping = (uniqueKeyPaths.count != allKeyPaths.count);
+
+	for (NSString *keyPath in uniqueKeyPaths) {
+		if (overlapping) break;
+
+		NSRange separator = [keyPath rangeOfString:@"." options:NSLiteralSearch];
+		while (separator.location != NSNotFound) {
+			if ([uniqueKeyPaths containsObject:[keyPath substringToIndex:separator.location]]) {
+				overlapping = YES;
+				break;
+			}
+
+			separator = [keyPath rangeOfString:@"." options:NSLiteralSearch range:NSMakeRange(NSMaxRange(separator), keyPath.length - NSMaxRange(separator))];
+		}
+	}
+
+	_propertyKeysByJSONKeyPath = [propertyKeysByJSONKeyPath copy];
+	_JSONKeyPathComponentsByPropertyKey = [componentsByPropertyKey copy];
+	_hasOverlappingKeyPaths = overlapping;
+
+	return self;
+}
+
+- (NSString *)propertyKeyForTokens:(NSArray *)tokens matchedCount:(NSUInteger *)matchedCount {
+	if (self.hasOverlappingKeyPaths) return nil;
+
+	NSMutableString *keyPath = [[NSMutableString alloc] init];
+
+	for (NSUInteger i = 0; i < tokens.count; i++) {
+		NSString *token = tokens[i];
+
+		// A token containing a period can't be expressed in a JSON key path.
+		if ([token rangeOfString:@"."].location != NSNotFound) return nil;
+
+		if (i > 0) [keyPath appendString:@"."];
+		[keyPath appendString:token];
+
+		NSString *propertyKey = self.propertyKeysByJSONKeyPath[keyPath];
+		if (propertyKey != nil) {
+			*matchedCount = i + 1;
+			return propertyKey;
+		}
+	}
+
+	return nil;
+}
+
+- (NSArray *)propertyKeysAffectedByTokens:(NSArray *)tokens {
+	NSMutableArray *propertyKeys = [[NSMutableArray alloc] init];
+
+	[self.JSONKeyPathComponentsByPropertyKey enumerateKeysAndObjectsUsingBlock:^(NSString *propertyKey, NSArray *keyPaths, BOOL *stop) {
+		for (NSArray *components in keyPaths) {
+			if (MTLJSONPointerTokensHavePrefix(tokens, components) || MTLJSONPointerTokensHavePrefix(components, tokens)) {
+				[propertyKeys addObject:propertyKey];
+				break;
+			}
+		}
+	}];
+
+	return propertyKeys;
+}
+
+@end
+
+@implementation MTLJSONAdapter (JSONPatch)
+
+#pragma mark Patching
+
++ (id)modelByApplyingJSONPatch:(NSArray *)operations toModel:(id<MTLJSONSerializing>)model error:(NSError * __autoreleasing *)error {
+	NSParameterAssert(model != nil);
+
+	MTLJSONAdapter *adapter = [[self alloc] initWithModelClass:model.class];
+
+	return [adapter modelByApplyingJSONPatch:operations toModel:model error:error];
+}
+
+- (id)modelByApplyingJSONPatch:(NSArray *)operations toModel:(id<MTLJSONSerializing>)model error:(NSError * __autoreleasing *)error {
+	NSParameterAssert(model != nil);
+	NSParameterAssert([model isKindOfClass:self.modelClass]);
+
+	if (![operations isKindOfClass:NSArray.class]) {
+		if (error != NULL) {
+			*error = MTLJSONPatchError(nil, NSLocalizedString(@"Expected an array of operations, got: %@", @""), @[ operations.class ?: NSNull.null ]);
+		}
+
+		return nil;
+	}
+
+	id patchedModel = model;
+
+	@try {
+		for (NSDictionary *operation in operations) {
+			patchedModel = [self modelByApplyingJSONPatchOperation:operation toModel:patchedModel error:error];
+			if (patchedModel == nil) return nil;
+		}
+	} @catch (NSException *ex) {
+		NSLog(@"*** Caught exception applying JSON patch to %@: %@", model, ex);
+
+		// Fail fast in Debug builds.
+		#if DEBUG
+		@throw ex;
+		#else
+		if (error != NULL) {
+			*error = [NSError mtl_modelErrorWithException:ex];
+		}
+
+		return nil;
+		#endif
+	}
+
+	return patchedModel;
+}
+
+- (id)modelByApplyingJSONPatchOperation:(NSDictionary *)operation toModel:(id<MTLJSONSerializing>)model error:(NSError * __autoreleasing *)error {
+	if (![operation isKindOfClass:NSDictionary.class]) {
+		if (error != NULL) {
+			*error = MTLJSONPatchError(nil, NSLocalizedString(@"Expected an operation object, got: %@", @""), @[ operation ?: NSNull.null ]);
+		}
+
+		return nil;
+	}
+
+	NSString *operationName = operation[@"op"];
+	NSArray *tokens = MTLJSONPointerTokens(operation[@"path"]);
+
+	if (tokens == nil) {
+		if (error != NULL) {
+			*error = MTLJSONPatchError(operation, NSLocalizedString(@"Invalid path: %@", @""), @[ operation[@"path"] ?: NSNull.null ]);
+		}
+
+		return nil;
+	}
+
+	if ([operationName isEqual:@"remove"]) {
+		return [self modelByWritingJSONValue:nil operationName:operationName atTokens:tokens ofModel:model operation:operation error:error];
+	}
+
+	if ([operationName isEqual:@"add"] || [operationName isEqual:@"replace"] || [operationName isEqual:@"test"]) {
+		id value = operation[@"value"];
+		if (value == nil) {
+			if (error != NULL) {
+				*error = MTLJSONPatchError(operation, NSLocalizedString(@"The \"%@\" operation is missing a value.", @""), @[ operationName ]);
+			}
+
+			return nil;
+		}
+
+		if (![operationName isEqual:@"test"]) {
+			return [self modelByWritingJSONValue:value operationName:operationName atTokens:tokens ofModel:model operation:operation error:error];
+		}
+
+		id currentValue = [self JSONValueAtTokens:tokens ofModel:model operation:operation error:error];
+		if (currentValue == nil) return nil;
+
+		if (!MTLJSONValuesAreEqual(currentValue, value)) {
+			if (error != NULL) {
+				*error = MTLJSONPatchError(operation, NSLocalizedString(@"Expected %1$@ at %2$@, got: %3$@", @""), @[ value, operation[@"path"], currentValue ]);
+			}
+
+			return nil;
+		}
+
+		return model;
+	}
+
+	if ([operationName isEqual:@"copy"] || [operationName isEqual:@"move"]) {
+		NSArray *fromTokens = MTLJSONPointerTokens(operation[@"from"]);
+		if (fromTokens == nil) {
+			if (error != NULL) {
+				*error = MTLJSONPatchError(operation, NSLocalizedString(@"Invalid from path: %@", @""), @[ operation[@"from"] ?: NSNull.null ]);
+			}
+
+			return nil;
+		}
+
+		BOOL moving = [operationName isEqual:@"move"];
+		if (moving && MTLJSONPointerTokensHavePrefix(tokens, fromTokens)) {
+			if ([tokens isEqualToArray:fromTokens]) return model;
+
+			if (error != NULL) {
+				*error = MTLJSONPatchError(operation, NSLocalizedString(@"%@ cannot be moved into one of its children.", @""), @[ operation[@"from"] ]);
+			}
+
+			return nil;
+		}
+
+		id value = [self JSONValueAtTokens:fromTokens ofModel:model operation:operation error:error];
+		if (value == nil) return nil;
+
+		if (moving) {
+			model = [self modelByWritingJSONValue:nil operationName:@"remove" atTokens:fromTokens ofModel:model operation:operation error:error];
+			if (model == nil) return nil;
+		}
+
+		return [self modelByWritingJSONValue:value operationName:@"add" atTokens:tokens ofModel:model operation:operation error:error];
+	}
+
+	if (error != NULL) {
+		*error = MTLJSONPatchError(operation, NSLocalizedString(@"Unsupported operation: %@", @""), @[ operationName ?: NSNull.null ]);
+	}
+
+	return nil;
+}
+
+#pragma mark Reading
+
+// Returns the JSON representation of a property of `model`, with nil
+// represented by NSNull, or nil if the property's transformer is not
+// reversible or failed.
+- (id)JSONValueForPropertyKey:(NSString *)propertyKey ofModel:(id<MTLJSONSerializing>)model operation:(NSDictionary *)operation error:(NSError * __autoreleasing *)error {
+	id value = [(NSObject *)model valueForKey:propertyKey];
+
+	NSValueTransformer *transformer = self.valueTransformersByPropertyKey[propertyKey];
+	if (transformer == nil) return value ?: NSNull.null;
+
+	if (![transformer.class allowsReverseTransformation]) {
+		if (error != NULL) {
+			*error = MTLJSONPatchError(operation, NSLocalizedString(@"The JSON transformer of %1$@ in %2$@ is not reversible.", @""), @[ propertyKey, NSStringFromClass(self.modelClass) ]);
+		}
+
+		return nil;
+	}
+
+	if ([transformer respondsToSelector:@selector(reverseTransformedValue:success:error:)]) {
+		BOOL success = YES;
+		value = [(id<MTLTransformerErrorHandling>)transformer reverseTransformedValue:value success:&success error:error];
+
+		if (!success) return nil;
+	} else {
+		value = [transformer reverseTransformedValue:value];
+	}
+
+	return value ?: NSNull.null;
+}
+
+// Resolves the location of `tokens` in the JSON representation of `model`.
+//
+// Returns the JSON value at the location, or nil if it does not exist.
+- (id)JSONValueAtTokens:(NSArray *)tokens ofModel:(id<MTLJSONSerializing>)model operation:(NSDictionary *)operation error:(NSError * __autoreleasing *)error {
+	if (model.class != self.modelClass) {
+		MTLJSONAdapter *otherAdapter = [self JSONAdapterForModelClass:model.class error:error];
+
+		return [otherAdapter JSONValueAtTokens:tokens ofModel:model operation:operation error:error];
+	}
+
+	NSUInteger matchedCount = 0;
+	NSString *propertyKey = [self.JSONPatchMapping propertyKeyForTokens:tokens matchedCount:&matchedCount];
+
+	id JSONValue;
+
+	if (propertyKey == nil) {
+		// The location is not inside a single property, so resolve it in the
+		// whole JSON representation.
+		NSDictionary *JSONDictionary = [self JSONDictionaryFromModel:model error:error];
+		if (JSONDictionary == nil) return nil;
+
+		JSONValue = MTLJSONValueAtTokens(JSONDictionary, tokens, 0);
+	} else {
+		id value = [(NSObject *)model valueForKey:propertyKey];
+		NSArray *remainingTokens = [tokens subarrayWithRange:NSMakeRange(matchedCount, tokens.count - matchedCount)];
+
+		id nestedModel = [self nestedModelInValue:value atTokens:remainingTokens matchedCount:&matchedCount];
+		if (nestedModel != nil) {
+			MTLJSONAdapter *nestedAdapter = [self JSONAdapterForModelClass:[nestedModel class] error:error];
+			NSArray *nestedTokens = [remainingTokens subarrayWithRange:NSMakeRange(matchedCount, remainingTokens.count - matchedCount)];
+
+			return [nestedAdapter JSONValueAtTokens:nestedTokens ofModel:nestedModel operation:operation error:error];
+		}
+
+		id propertyJSONValue = [self JSONValueForPropertyKey:propertyKey ofModel:model operation:operation error:error];
+		if (propertyJSONValue == nil) return nil;
+
+		JSONValue = MTLJSONValueAtTokens(propertyJSONValue, remainingTokens, 0);
+	}
+
+	if (JSONValue == nil && error != NULL) {
+		*error = MTLJSONPatchError(operation, NSLocalizedString(@"%@ does not exist.", @""), @[ operation[@"from"] ?: operation[@"path"] ]);
+	}
+
+	return JSONValue;
+}
+
+// Finds a model conforming to <MTLJSONSerializing> which contains or is the
+// location of `tokens` inside a property value, either because the value is
+// such a model, or because it is an array and the location is inside or at
+// such an element.
+//
+// matchedCount - Set to the number of tokens leading to the nested model.
+//
+// Returns the nested model, or nil if the location is not inside one.
+- (id)nestedModelInValue:(id)value atTokens:(NSArray *)tokens matchedCount:(NSUInteger *)matchedCount {
+	if (tokens.count == 0) return nil;
+
+	if ([value conformsToProtocol:@protocol(MTLJSONSerializing)]) {
+		*matchedCount = 0;
+		return value;
+	}
+
+	if ([value isKindOfClass:NSArray.class]) {
+		NSArray *array = value;
+		NSUInteger index = MTLJSONPointerArrayIndex(tokens[0], array.count);
+
+		if (index < array.count && [array[index] conformsToProtocol:@protocol(MTLJSONSerializing)]) {
+			*matchedCount = 1;
+			return array[index];
+		}
+	}
+
+	return nil;
+}
+
+#pragma mark Writing
+
+// Applies an "add", "remove" or "replace" operation at the location of
+// `tokens` in the JSON representation of `model`.
+//
+// JSONValue - The value to add or replace with, or nil when removing.
+//
+// Returns a patched copy of `model`, `model` itself if no value changed, or
+// nil if the operation could not be applied.
+- (id)modelByWritingJSONValue:(id)JSONValue operationName:(NSString *)operationName atTokens:(NSArray *)tokens ofModel:(id<MTLJSONSerializing>)model operation:(NSDictionary *)operation error:(NSError * __autoreleasing *)error {
+	if (model.class != self.modelClass) {
+		MTLJSONAdapter *otherAdapter = [self JSONAdapterForModelClass:model.class error:error];
+
+		return [otherAdapter modelByWritingJSONValue:JSONValue operationName:operationName atTokens:tokens ofModel:model operation:operation error:error];
+	}
+
+	if (tokens.count == 0) {
+		if (JSONValue == nil) {
+			if (error != NULL) {
+				*error = MTLJSONPatchError(operation, NSLocalizedString(@"A model cannot be removed from itself.", @""), nil);
+			}
+
+			return nil;
+		}
+
+		return [self modelFromJSONDictionary:JSONValue error:error];
+	}
+
+	MTLJSONPatchMapping *mapping = self.JSONPatchMapping;
+
+	NSUInteger matchedCount = 0;
+	NSString *propertyKey = [mapping propertyKeyForTokens:tokens matchedCount:&matchedCount];
+	NSArray *propertyKeys = (propertyKey != nil ? @[ propertyKey ] : [mapping propertyKeysAffectedByTokens:tokens]);
+
+	if (propertyKeys.count == 0) {
+		if (error != NULL) {
+			*error = MTLJSONPatchError(operation, NSLocalizedString(@"%1$@ is not mapped to any property of %2$@.", @""), @[ operation[@"path"] ?: NSNull.null, NSStringFromClass(self.modelClass) ]);
+		}
+
+		return nil;
+	}
+
+	NSMutableDictionary *newValues = [[NSMutableDictionary alloc] initWithCapacity:propertyKeys.count];
+
+	for (NSString *propertyKey in propertyKeys) {
+		id newValue = nil;
+		if (![self getPatchedValue:&newValue forPropertyKey:propertyKey ofModel:model JSONValue:JSONValue operationName:operationName atTokens:tokens operation:operation error:error]) return nil;
+
+		newValues[propertyKey] = newValue ?: NSNull.null;
+	}
+
+	return [self modelBySettingValues:newValues ofModel:model error:error];
+}
+
+// Computes the value of a property after applying an operation to the JSON
+// representation of `model`. The property must have a JSON key path which
+// contains, is contained in or equals the location of `tokens`.
+//
+// Returns whether the value could be computed.
+- (BOOL)getPatchedValue:(id *)newValue forPropertyKey:(NSString *)propertyKey ofModel:(id<MTLJSONSerializing>)model JSONValue:(id)JSONValue operationName:(NSString *)operationName atTokens:(NSArray *)tokens operation:(NSDictionary *)operation error:(NSError * __autoreleasing *)error {
+	id JSONKeyPaths = self.JSONKeyPathsByPropertyKey[propertyKey];
+	NSArray *keyPathComponents = self.JSONPatchMapping.JSONKeyPathComponentsByPropertyKey[propertyKey];
+
+	id newJSONValue;
+
+	if (![JSONKeyPaths isKindOfClass:NSArray.class]) {
+		NSArray *components = keyPathComponents.firstObject;
+
+		if (tokens.count <= components.count) {
+			// The location is the property itself, or contains it.
+			newJSONValue = (JSONValue != nil ? MTLJSONValueAtTokens(JSONValue, components, tokens.count) : nil);
+		} else {
+			id value = [(NSObject *)model valueForKey:propertyKey];
+			NSArray *remainingTokens = [tokens subarrayWithRange:NSMakeRange(components.count, tokens.count - components.count)];
+
+			// Elements of arrays of models are inserted and removed directly,
+			// sharing all other elements. Other arrays are spliced in JSON.
+			BOOL splicing = (remainingTokens.count == 1 && ([operationName isEqualToString:@"add"] || [operationName isEqualToString:@"remove"]));
+			if (splicing && MTLJSONPatchIsArrayOfModels(value)) {
+				*newValue = [self arrayBySplicingJSONValue:JSONValue operationName:operationName atToken:remainingTokens[0] intoArray:value operation:operation error:error];
+				return *newValue != nil;
+			}
+
+			NSUInteger matchedCount = 0;
+			id nestedModel = (splicing ? nil : [self nestedModelInValue:value atTokens:remainingTokens matchedCount:&matchedCount]);
+
+			if (nestedModel != nil) {
+				MTLJSONAdapter *nestedAdapter = [self JSONAdapterForModelClass:[nestedModel class] error:error];
+				NSArray *nestedTokens = [remainingTokens subarrayWithRange:NSMakeRange(matchedCount, remainingTokens.count - matchedCount)];
+
+				id patchedModel = [nestedAdapter modelByWritingJSONValue:JSONValue operationName:operationName atTokens:nestedTokens ofModel:nestedModel operation:operation error:error];
+				if (patchedModel == nil) return NO;
+
+				if (matchedCount == 0 || patchedModel == nestedModel) {
+					*newValue = (matchedCount == 0 ? patchedModel : value);
+				} else {
+					NSMutableArray *array = [value mutableCopy];
+					array[MTLJSONPointerArrayIndex(remainingTokens[0], array.count)] = patchedModel;
+
+					*newValue = [array copy];
+				}
+
+				return YES;
+			}
+
+			id currentJSONValue = [self JSONValueForPropertyKey:propertyKey ofModel:model operation:operation error:error];
+			if (currentJSONValue == nil) return NO;
+
+			newJSONValue = MTLJSONValueByApplyingOperation(currentJSONValue, operationName, tokens, components.count, JSONValue);
+			if (newJSONValue == nil) {
+				if (error != NULL) {
+					*error = MTLJSONPatchError(operation, NSLocalizedString(@"%@ does not exist.", @""), @[ operation[@"path"] ]);
+				}
+
+				return NO;
+			}
+		}
+	} else {
+		// The JSON representation of a property with multiple key paths is a
+		// dictionary keyed by those key paths, which keeps the values of the
+		// key paths which are not affected.
+		id currentJSONValue = [self JSONValueForPropertyKey:propertyKey ofModel:model operation:operation error:error];
+		if (currentJSONValue == nil) return NO;
+
+		if ([currentJSONValue isEqual:NSNull.null]) currentJSONValue = @{};
+
+		if (![currentJSONValue isKindOfClass:NSDictionary.class]) {
+			if (error != NULL) {
+				*error = MTLJSONPatchError(operation, NSLocalizedString(@"Expected a dictionary for %@, got: %@", @""), @[ propertyKey, currentJSONValue ]);
+			}
+
+			return NO;
+		}
+
+		NSMutableDictionary *dictionary = [currentJSONValue mutableCopy];
+		__block BOOL missing = NO;
+
+		[JSONKeyPaths enumerateObjectsUsingBlock:^(NSString *keyPath, NSUInteger index, BOOL *stop) {
+			NSArray *components = keyPathComponents[index];
+			id keyPathValue;
+
+			if (tokens.count <= components.count) {
+				if (!MTLJSONPointerTokensHavePrefix(components, tokens)) return;
+
+				keyPathValue = (JSONValue != nil ? MTLJSONValueAtTokens(JSONValue, components, tokens.count) : nil);
+			} else {
+				if (!MTLJSONPointerTokensHavePrefix(tokens, components)) return;
+
+				keyPathValue = MTLJSONValueByApplyingOperation(dictionary[keyPath], operationName, tokens, components.count, JSONValue);
+				if (keyPathValue == nil) {
+					missing = YES;
+					*stop = YES;
+					return;
+				}
+			}
+
+			if (keyPathValue != nil) {
+				dictionary[keyPath] = keyPathValue;
+			} else {
+				[dictionary removeObjectForKey:keyPath];
+			}
+		}];
+
+		if (missing) {
+			if (error != NULL) {
+				*error = MTLJSONPatchError(operation, NSLocalizedString(@"%@ does not exist.", @""), @[ operation[@"path"] ]);
+			}
+
+			return NO;
+		}
+
+		newJSONValue = dictionary;
+	}
+
+	NSValueTransformer *transformer = self.valueTransformersByPropertyKey[propertyKey];
+	if ([newJSONValue isEqual:NSNull.null]) newJSONValue = nil;
+
+	if (transformer == nil) {
+		*newValue = newJSONValue;
+		return YES;
+	}
+
+	if ([transformer respondsToSelector:@selector(transformedValue:success:error:)]) {
+		BOOL success = YES;
+		*newValue = [(id<MTLTransformerErrorHandling>)transformer transformedValue:newJSONValue success:&success error:error];
+
+		return success;
+	}
+
+	*newValue = [transformer transformedValue:newJSONValue];
+	return YES;
+}
+
+// Applies an "add" or "remove" operation to an element of an array of models.
+// An added model is decoded with the adapter of the class of the first
+// element.
+//
+// Returns a new array sharing all other elements, or nil if the location does
+// not exist or the model could not be decoded.
+- (NSArray *)arrayBySplicingJSONValue:(id)JSONValue operationName:(NSString *)operationName atToken:(NSString *)token intoArray:(NSArray *)array operation:(NSDictionary *)operation error:(NSError * __autoreleasing *)error {
+	BOOL inserting = [operationName isEqualToString:@"add"];
+	NSUInteger index = MTLJSONPointerArrayIndex(token, array.count);
+
+	if (index == NSNotFound || index > array.count || (index == array.count && !inserting)) {
+		if (error != NULL) {
+			*error = MTLJSONPatchError(operation, NSLocalizedString(@"%@ does not exist.", @""), @[ operation[@"path"] ]);
+		}
+
+		return nil;
+	}
+
+	NSMutableArray *splicedArray = [array mutableCopy];
+
+	if (inserting) {
+		MTLJSONAdapter *elementAdapter = [self JSONAdapterForModelClass:[array.firstObject class] error:error];
+		if (elementAdapter == nil) return nil;
+
+		id element = [elementAdapter modelFromJSONDictionary:JSONValue error:error];
+		if (element == nil) return nil;
+
+		[splicedArray insertObject:element atIndex:index];
+	} else {
+		[splicedArray removeObjectAtIndex:index];
+	}
+
+	return [splicedArray copy];
+}
+
+// Validates the changed values of `newValues`, in which nil is represented by
+// NSNull, and sets them on a copy of `model`.
+//
+// MTLModels are copied with -modelByUpdatingValues:error:, which copies the
+// other properties without boxing them, and shares their values.
+//
+// Returns the copy, `model` itself if no value changed, or nil if a value
+// failed to validate.
+- (id)modelBySettingValues:(NSDictionary *)newValues ofModel:(id<MTLJSONSerializing>)model error:(NSError * __autoreleasing *)error {
+	if ([model isKindOfClass:MTLModel.class]) {
+		NSMutableDictionary *changedValues = nil;
+
+		for (NSString *propertyKey in newValues) {
+			id value = newValues[propertyKey];
+			id currentValue = [(NSObject *)model valueForKey:propertyKey] ?: NSNull.null;
+			if (currentValue == value || [currentValue isEqual:value]) continue;
+
+			if (changedValues == nil) changedValues = [[NSMutableDictionary alloc] initWithCapacity:newValues.count];
+			changedValues[propertyKey] = value;
+		}
+
+		if (changedValues == nil) return model;
+
+		return [(MTLModel *)model modelByUpdatingValues:changedValues error:error];
+	}
+
+	NSObject<MTLModel> *copy = nil;
+
+	for (NSString *propertyKey in newValues) {
+		id value = newValues[propertyKey];
+		if ([value isEqual:NSNull.null]) value = nil;
+
+		id currentValue = [(NSObject *)model valueForKey:propertyKey];
+		if (currentValue == value || [currentValue isEqual:value]) continue;
+
+		if (copy == nil) copy = MTLJSONPatchCopyOfModel(model);
+
+		// Mark this as being autoreleased, because validateValue may return
+		// a new object to be stored in this variable.
+		__autoreleasing id validatedValue = value;
+		if (![copy validateValue:&validatedValue forKey:propertyKey error:error]) return nil;
+
+		[copy setValue:validatedValue forKey:propertyKey];
+	}
+
+	return copy ?: model;
+}
+
+#pragma mark Mapping
+
+- (MTLJSONPatchMapping *)JSONPatchMapping {
+	Class modelClass = self.modelClass;
+
+	MTLJSONPatchMapping *mapping = objc_getAssociatedObject(modelClass, MTLJSONAdapterCachedJSONPatchMappingKey);
+	if (mapping != nil) return mapping;
+
+	mapping = [[MTLJSONPatchMapping alloc] initWithJSONKeyPathsByPropertyKey:self.JSONKeyPathsByPropertyKey];
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(modelClass, MTLJSONAdapterCachedJSONPatchMappingKey, mapping, OBJC_ASSOCIATION_RETAIN);
+
+	return mapping;
+}
+
+@end
@@ -7,22 +7,36 @@
 //
 
 #import <objc/runtime.h>
+#import <stdatomic.h>
 
 #import "NSDictionary+MTLJSONKeyPath.h"
 
+#import "MTLAutoreleasePoolChunking.h"
 #import "MTLEXTRuntimeExtensions.h"
 #import "MTLEXTScope.h"
 #import "MTLJSONAdapter.h"
+#import "MTLJSONShapeCache.h"
+#import "MTLLRUCache.h"
+#import "MTLMemoizingValueTransformer.h"
+#import "MTLMetricsRecording.h"
 #import "MTLModel.h"
+#import "MTLPayloadCache.h"
+#import "MTLPayloadCacheSharing.h"
 #import "MTLTransformerErrorHandling.h"
 #import "MTLReflection.h"
+#import "MTLStringInterningPool.h"
+#import "MTLTraceRecording.h"
+#import "MTLUniquingContext.h"
 #import "NSValueTransformer+MTLPredefinedTransformerAdditions.h"
 #import "MTLValueTransformer.h"
+#import "NSError+MTLLazyDescription.h"
+#import "NSError+MTLModelException.h"
 
 NSString * const MTLJSONAdapterErrorDomain = @"MTLJSONAdapterErrorDomain";
 const NSInteger MTLJSONAdapterErrorNoClassFound = 2;
 const NSInteger MTLJSONAdapterErrorInvalidJSONDictionary = 3;
 const NSInteger MTLJSONAdapterErrorInvalidJSONMapping = 4;
+const NSInteger MTLJSONAdapterErrorInvalidJSONPatch = 5;
 
 // An exception was thrown and caught.
 const NSInteger MTLJSONAdapterErrorExceptionThrown = 1;
@@ -30,6 +44,37 @@ const NSInteger MTLJSONAdapterErrorExceptionThrown = 1;
 // Associated with the NSException that was caught.
 NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownException";
 
+NSString * const MTLJSONAdapterJSONKeyPathErrorKey = @"MTLJSONAdapterJSONKeyPath";
+NSString * const MTLJSONAdapterJSONDictionaryErrorKey = @"MTLJSONAdapterJSONDictionary";
+NSString * const MTLJSONAdapterJSONPatchOperationErrorKey = @"MTLJSONAdapterJSONPatchOperation";
+
+// The number of results cached in each direction by the transformers returned
+// from +memoizingTransformerForKey:modelClass:transformer:.
+static const NSUInteger MTLJSONAdapterMemoizationCountLimit = 512;
+
+// The number of top-level JSON values of a shape which are buffered on the
+// stack while decoding. Wider model classes use a heap buffer.
+static const NSUInteger MTLJSONAdapterStackTopLevelValueLimit = 32;
+
+// The number of model classes for which the memoizing transformers of
+// +memoizingTransformerForKey:modelClass:transformer: are kept.
+static const NSUInteger MTLJSONAdapterMemoizedClassCountLimit = 128;
+
+// The string interning pool and uniquing context of a decode.
+typedef struct {
+	__unsafe_unretained MTLStringInterningPool *stringInterningPool;
+	__unsafe_unretained MTLUniquingContext *uniquingContext;
+} MTLJSONAdapterDecodingScope;
+
+// The pool and context of the outermost decode on the current thread, which
+// nested adapters without a pool or context of their own use as well.
+//
+// Adapters of nested models are cached and shared between decodes, which may
+// run on other threads at the same time, so they must never be handed the pool
+// or context of a decode themselves. The decoding adapter keeps the pool and
+// context alive while they are set.
+static __thread MTLJSONAdapterDecodingScope MTLJSONAdapterCurrentDecodingScope;
+
 @interface MTLJSONAdapter ()
 
 // The MTLModel subclass being parsed, or the class of `model` if parsing has
@@ -42,6 +87,13 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 // A cached copy of the return value of -valueTransformersForModelClass:
 @property (nonatomic, copy, readonly) NSDictionary *valueTransformersByPropertyKey;
 
+// The property keys whose string values are deduplicated through
+// `stringInterningPool`.
+@property (nonatomic, copy, readonly) NSSet *stringInterningPropertyKeys;
+
+// Caches decoders specialized for the shapes of decoded JSON dictionaries.
+@property (nonatomic, strong, readonly) MTLJSONShapeCache *shapeCache;
+
 // Used to cache the JSON adapters returned by -JSONAdapterForModelClass:error:.
 @property (nonatomic, strong, readonly) NSMapTable *JSONAdaptersByModelClass;
 
@@ -58,6 +110,18 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 // adapter could be created, nil is returned.
 - (MTLJSONAdapter *)JSONAdapterForModelClass:(Class)modelClass error:(NSError **)error;
 
+// Decodes a payload with `decode`, or returns the model previously decoded
+// from the same bytes with the same configuration from `payloadCache`, if any.
+- (id)modelFromPayload:(NSData *)payload decodingWithBlock:(id (^)(NSError **error))decode error:(NSError **)error;
+
+// Serializes a model whose class is exactly `modelClass`, after any
+// dispatching to other adapters has happened.
+- (NSDictionary *)JSONDictionaryFromModelOfAdapterClass:(id<MTLJSONSerializing>)model error:(NSError **)error;
+
+// Deserializes a model of `modelClass`, after any dispatching to other adapters
+// has happened.
+- (id)modelOfAdapterClassFromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error;
+
 // Collect all value transformers needed for a given class.
 //
 // modelClass - The class from which to parse the JSON. This class must conform
@@ -67,8 +131,66 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 // transformation as keys and the value transformers as values.
 + (NSDictionary *)valueTransformersForModelClass:(Class)modelClass;
 
+// Returns the process-wide memoizing transformer for a property, creating one
+// which wraps `transformer` if necessary.
+//
+// key         - The property key. This argument must not be nil.
+// modelClass  - The class declaring the property. This argument must not be
+//               nil.
+// transformer - The transformer to wrap if no memoizing transformer exists yet.
+//               This argument must not be nil.
++ (MTLMemoizingValueTransformer *)memoizingTransformerForKey:(NSString *)key modelClass:(Class)modelClass transformer:(NSValueTransformer *)transformer;
+
 @end
 
+// Returns whether `adapter` has a string interning pool or uniquing context
+// which is not in effect on the current thread yet.
+static BOOL MTLJSONAdapterNeedsDecodingScope(MTLJSONAdapter *adapter) {
+	MTLStringInterningPool *stringInterningPool = adapter.stringInterningPool;
+	if (stringInterningPool != nil && stringInterningPool != MTLJSONAdapterCurrentDecodingScope.stringInterningPool) return YES;
+
+	MTLUniquingContext *uniquingContext = adapter.uniquingContext;
+	return uniquingContext != nil && uniquingContext != MTLJSONAdapterCurrentDecodingScope.uniquingContext;
+}
+
+// Puts the string interning pool and uniquing context of `adapter`, if any,
+// into effect on the current thread.
+//
+// Returns the previous scope, which must be restored once the decode is done.
+static MTLJSONAdapterDecodingScope MTLJSONAdapterEnterDecodingScope(MTLJSONAdapter *adapter) {
+	MTLJSONAdapterDecodingScope previousScope = MTLJSONAdapterCurrentDecodingScope;
+
+	if (adapter.stringInterningPool != nil) MTLJSONAdapterCurrentDecodingScope.stringInterningPool = adapter.stringInterningPool;
+	if (adapter.uniquingContext != nil) MTLJSONAdapterCurrentDecodingScope.uniquingContext = adapter.uniquingContext;
+
+	return previousScope;
+}
+
+// Returns `value` with any string, or strings directly inside an array,
+// replaced by their canonical instances from `stringInterningPool`.
+static id MTLJSONAdapterInternStrings(MTLStringInterningPool *stringInterningPool, id value) {
+	if ([value isKindOfClass:NSString.class]) return [stringInterningPool internedString:value];
+	if (![value isKindOfClass:NSArray.class]) return value;
+
+	NSMutableArray *internedArray = nil;
+	NSUInteger index = 0;
+
+	for (id element in value) {
+		if ([element isKindOfClass:NSString.class]) {
+			NSString *internedString = [stringInterningPool internedString:element];
+
+			if (internedString != element) {
+				if (internedArray == nil) internedArray = [value mutableCopy];
+				internedArray[index] = internedString;
+			}
+		}
+
+		index++;
+	}
+
+	return (internedArray != nil ? [internedArray copy] : value);
+}
+
 @implementation MTLJSONAdapter
 
 #pragma mark Convenience methods
@@ -79,25 +201,49 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 	return [adapter modelFromJSONDictionary:JSONDictionary error:error];
 }
 
++ (id)modelOfClass:(Class)modelClass fromJSONData:(NSData *)data error:(NSError * __autoreleasing *)error {
+	MTLJSONAdapter *adapter = [[self alloc] initWithModelClass:modelClass];
+
+	return [adapter modelFromJSONData:data error:error];
+}
+
 + (NSArray *)modelsOfClass:(Class)modelClass fromJSONArray:(NSArray *)JSONArray error:(NSError * __autoreleasing *)error {
 	if (JSONArray == nil || ![JSONArray isKindOfClass:NSArray.class]) {
 		if (error != NULL) {
-			NSDictionary *userInfo = @{
-				NSLocalizedDescriptionKey: NSLocalizedString(@"Missing JSON array", @""),
-				NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"%@ could not be created because an invalid JSON array was provided: %@", @""), NSStringFromClass(modelClass), JSONArray.class],
-			};
-			*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONDictionary userInfo:userInfo];
+			*error = [NSError mtl_errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONDictionary descriptionFormat:NSLocalizedString(@"Missing JSON array", @"") failureReasonFormat:NSLocalizedString(@"%@ could not be created because an invalid JSON array was provided: %@", @"") arguments:@[ NSStringFromClass(modelClass), JSONArray.class ?: NSNull.null ] userInfo:nil];
 		}
 		return nil;
 	}
 
-	NSMutableArray *models = [NSMutableArray arrayWithCapacity:JSONArray.count];
-	for (NSDictionary *JSONDictionary in JSONArray){
-		MTLModel *model = [self modelOfClass:modelClass fromJSONDictionary:JSONDictionary error:error];
+	// Share one adapter, and with it the decoders it specializes, between all
+	// of the dictionaries.
+	MTLJSONAdapter *adapter = [[self alloc] initWithModelClass:modelClass];
 
-		if (model == nil) return nil;
+	NSUInteger count = JSONArray.count;
+	NSMutableArray *models = [[NSMutableArray alloc] initWithCapacity:count];
+
+	// Errors must outlive the autorelease pools.
+	NSError *modelError = nil;
+	BOOL failed = NO;
+
+	for (NSUInteger start = 0; start < count && !failed; start += MTLAutoreleasePoolChunkSize) {
+		@autoreleasepool {
+			NSUInteger end = MIN(start + MTLAutoreleasePoolChunkSize, count);
+			for (NSUInteger index = start; index < end; index++) {
+				MTLModel *model = [adapter modelFromJSONDictionary:JSONArray[index] error:&modelError];
+				if (model == nil) {
+					failed = YES;
+					break;
+				}
 
-		[models addObject:model];
+				[models addObject:model];
+			}
+		}
+	}
+
+	if (failed) {
+		if (error != NULL) *error = modelError;
+		return nil;
 	}
 
 	return models;
@@ -113,12 +259,39 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 	NSParameterAssert(models != nil);
 	NSParameterAssert([models isKindOfClass:NSArray.class]);
 
-	NSMutableArray *JSONArray = [NSMutableArray arrayWithCapacity:models.count];
-	for (MTLModel<MTLJSONSerializing> *model in models) {
-		NSDictionary *JSONDictionary = [self JSONDictionaryFromModel:model error:error];
-		if (JSONDictionary == nil) return nil;
+	NSUInteger count = models.count;
+	NSMutableArray *JSONArray = [[NSMutableArray alloc] initWithCapacity:count];
+
+	// Reused for consecutive models of the same class.
+	MTLJSONAdapter *adapter = nil;
+
+	// Errors must outlive the autorelease pools.
+	NSError *JSONError = nil;
+	BOOL failed = NO;
+
+	for (NSUInteger start = 0; start < count && !failed; start += MTLAutoreleasePoolChunkSize) {
+		@autoreleasepool {
+			NSUInteger end = MIN(start + MTLAutoreleasePoolChunkSize, count);
+			for (NSUInteger index = start; index < end; index++) {
+				MTLModel<MTLJSONSerializing> *model = models[index];
+				if (adapter == nil || adapter.modelClass != model.class) {
+					adapter = [[self alloc] initWithModelClass:model.class];
+				}
+
+				NSDictionary *JSONDictionary = [adapter JSONDictionaryFromModel:model error:&JSONError];
+				if (JSONDictionary == nil) {
+					failed = YES;
+					break;
+				}
+
+				[JSONArray addObject:JSONDictionary];
+			}
+		}
+	}
 
-		[JSONArray addObject:JSONDictionary];
+	if (failed) {
+		if (error != NULL) *error = JSONError;
+		return nil;
 	}
 
 	return JSONArray;
@@ -166,12 +339,29 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 	}
 
 	_valueTransformersByPropertyKey = [self.class valueTransformersForModelClass:modelClass];
+	_shapeCache = [[MTLJSONShapeCache alloc] initWithModelClass:modelClass JSONKeyPathsByPropertyKey:_JSONKeyPathsByPropertyKey valueTransformersByPropertyKey:_valueTransformersByPropertyKey];
+
+	if ([modelClass respondsToSelector:@selector(JSONPropertyKeysForStringInterning)]) {
+		_stringInterningPropertyKeys = [modelClass JSONPropertyKeysForStringInterning];
+	} else {
+		_stringInterningPropertyKeys = [NSSet setWithArray:_JSONKeyPathsByPropertyKey.allKeys];
+	}
 
 	_JSONAdaptersByModelClass = [NSMapTable strongToStrongObjectsMapTable];
 
 	return self;
 }
 
+#pragma mark Statistics
+
+- (NSUInteger)shapeCacheHitCount {
+	return self.shapeCache.hitCount;
+}
+
+- (NSUInteger)shapeCacheMissCount {
+	return self.shapeCache.missCount;
+}
+
 #pragma mark Serialization
 
 - (NSDictionary *)JSONDictionaryFromModel:(id<MTLJSONSerializing>)model error:(NSError * __autoreleasing *)error {
@@ -184,9 +374,30 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 		return [otherAdapter JSONDictionaryFromModel:model error:error];
 	}
 
+	BOOL tracing = MTLTraceEnabled;
+	if (!tracing && !MTLMetricsEnabled) return [self JSONDictionaryFromModelOfAdapterClass:model error:error];
+
+	if (tracing) MTLTraceBegin(MTLTraceStageEncode, self.modelClass);
+
+	uint64_t startTime = MTLMetricsCurrentTime();
+	NSError *encodeError = nil;
+	NSDictionary *JSONDictionary = [self JSONDictionaryFromModelOfAdapterClass:model error:&encodeError];
+	if (MTLMetricsEnabled) MTLMetricsRecord(MTLMetricKindEncode, self.modelClass, nil, startTime, JSONDictionary != nil, (JSONDictionary == nil ? encodeError : nil));
+
+	if (tracing) MTLTraceEnd(MTLTraceStageEncode, self.modelClass);
+
+	if (JSONDictionary == nil && error != NULL) *error = encodeError;
+	return JSONDictionary;
+}
+
+- (NSDictionary *)JSONDictionaryFromModelOfAdapterClass:(id<MTLJSONSerializing>)model error:(NSError * __autoreleasing *)error {
+	BOOL tracing = MTLTraceEnabled;
+
 	NSSet *propertyKeysToSerialize = [self serializablePropertyKeys:[NSSet setWithArray:self.JSONKeyPathsByPropertyKey.allKeys] forModel:model];
 
+	if (tracing) MTLTraceBegin(MTLTraceStageDictionaryValue, self.modelClass);
 	NSDictionary *dictionaryValue = [model.dictionaryValue dictionaryWithValuesForKeys:propertyKeysToSerialize.allObjects];
+	if (tracing) MTLTraceEnd(MTLTraceStageDictionaryValue, self.modelClass);
 	NSMutableDictionary *JSONDictionary = [[NSMutableDictionary alloc] initWithCapacity:dictionaryValue.count];
 
 	__block BOOL success = YES;
@@ -203,21 +414,31 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 			// dictionaryValue we're going to insert into.
 			if ([value isEqual:NSNull.null]) value = nil;
 
+			uint64_t transformStartTime = (MTLMetricsEnabled ? MTLMetricsCurrentTime() : 0);
+			if (tracing) MTLTraceBegin(MTLTraceStageReverseTransform, self.modelClass);
+
 			if ([transformer respondsToSelector:@selector(reverseTransformedValue:success:error:)]) {
 				id<MTLTransformerErrorHandling> errorHandlingTransformer = (id)transformer;
 
 				value = [errorHandlingTransformer reverseTransformedValue:value success:&success error:&tmpError];
-
-				if (!success) {
-					*stop = YES;
-					return;
-				}
 			} else {
 				value = [transformer reverseTransformedValue:value] ?: NSNull.null;
 			}
+
+			if (MTLMetricsEnabled) MTLMetricsRecord(MTLMetricKindReverseTransform, self.modelClass, propertyKey, transformStartTime, success, (success ? nil : tmpError));
+			if (tracing) MTLTraceEnd(MTLTraceStageReverseTransform, self.modelClass);
+
+			if (!success) {
+				*stop = YES;
+				return;
+			}
 		}
 
 		void (^createComponents)(id, NSString *) = ^(id obj, NSString *keyPath) {
+			// A key path with a single component can be set as it is, without
+			// splitting it.
+			if ([keyPath rangeOfString:@"." options:NSLiteralSearch].location == NSNotFound) return;
+
 			NSArray *keyPathComponents = [keyPath componentsSeparatedByString:@"."];
 
 			// Set up dictionaries at each step of the key path.
@@ -232,6 +453,8 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 			}
 		};
 
+		if (tracing) MTLTraceBegin(MTLTraceStageKeyPathInsertion, self.modelClass);
+
 		if ([JSONKeyPaths isKindOfClass:NSString.class]) {
 			createComponents(JSONDictionary, JSONKeyPaths);
 
@@ -245,6 +468,8 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 				[JSONDictionary setValue:value[JSONKeyPath] forKeyPath:JSONKeyPath];
 			}
 		}
+
+		if (tracing) MTLTraceEnd(MTLTraceStageKeyPathInsertion, self.modelClass);
 	}];
 
 	if (success) {
@@ -257,16 +482,27 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 }
 
 - (id)modelFromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError * __autoreleasing *)error {
+	if (MTLJSONAdapterNeedsDecodingScope(self)) {
+		// Make the pool and context available to the adapters of nested models.
+		MTLJSONAdapterDecodingScope previousScope = MTLJSONAdapterEnterDecodingScope(self);
+		@onExit {
+			MTLJSONAdapterCurrentDecodingScope = previousScope;
+		};
+
+		return [self modelFromJSONDictionary:JSONDictionary error:error];
+	}
+
 	if ([self.modelClass respondsToSelector:@selector(classForParsingJSONDictionary:)]) {
+		BOOL tracingClassDispatch = MTLTraceEnabled;
+		if (tracingClassDispatch) MTLTraceBegin(MTLTraceStageClassDispatch, self.modelClass);
+
 		Class class = [self.modelClass classForParsingJSONDictionary:JSONDictionary];
+
+		if (tracingClassDispatch) MTLTraceEnd(MTLTraceStageClassDispatch, self.modelClass);
+
 		if (class == nil) {
 			if (error != NULL) {
-				NSDictionary *userInfo = @{
-					NSLocalizedDescriptionKey: NSLocalizedString(@"Could not parse JSON", @""),
-					NSLocalizedFailureReasonErrorKey: NSLocalizedString(@"No model class could be found to parse the JSON dictionary.", @"")
-				};
-
-				*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorNoClassFound userInfo:userInfo];
+				*error = [NSError mtl_errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorNoClassFound descriptionFormat:NSLocalizedString(@"Could not parse JSON", @"") failureReasonFormat:NSLocalizedString(@"No model class could be found to parse the JSON dictionary.", @"") arguments:nil userInfo:nil];
 			}
 
 			return nil;
@@ -281,71 +517,270 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 		}
 	}
 
+	BOOL tracing = MTLTraceEnabled;
+	if (!tracing && !MTLMetricsEnabled) return [self modelOfAdapterClassFromJSONDictionary:JSONDictionary error:error];
+
+	if (tracing) MTLTraceBegin(MTLTraceStageDecode, self.modelClass);
+
+	uint64_t startTime = MTLMetricsCurrentTime();
+	NSError *decodeError = nil;
+	id model = [self modelOfAdapterClassFromJSONDictionary:JSONDictionary error:&decodeError];
+	if (MTLMetricsEnabled) MTLMetricsRecord(MTLMetricKindDecode, self.modelClass, nil, startTime, model != nil, (model == nil ? decodeError : nil));
+
+	if (tracing) MTLTraceEnd(MTLTraceStageDecode, self.modelClass);
+
+	if (model == nil && error != NULL) *error = decodeError;
+	return model;
+}
+
+- (id)modelFromJSONData:(NSData *)data error:(NSError * __autoreleasing *)error {
+	if (data == nil) return nil;
+
+	id (^decode)(NSError **) = ^ id (NSError **error) {
+		id dictionary = [NSJSONSerialization JSONObjectWithData:data options:0 error:error];
+		if (dictionary == nil) return nil;
+
+		// Validates that the object is a dictionary.
+		return [self modelFromJSONDictionary:dictionary error:error];
+	};
+
+	return [self modelFromPayload:data decodingWithBlock:decode error:error];
+}
+
+- (id)modelFromPayload:(NSData *)payload decodingWithBlock:(id (^)(NSError **error))decode error:(NSError **)error {
+	MTLPayloadCache *payloadCache = self.payloadCache;
+	if (payloadCache == nil) return decode(error);
+
+	// Adapters sharing a cache may decode the same bytes differently, or into
+	// models interned or uniqued through different pools and contexts.
+	MTLStringInterningPool *stringInterningPool = self.stringInterningPool ?: MTLJSONAdapterCurrentDecodingScope.stringInterningPool;
+	MTLUniquingContext *uniquingContext = self.uniquingContext ?: MTLJSONAdapterCurrentDecodingScope.uniquingContext;
+	NSArray *configuration = @[ self.class, stringInterningPool ?: NSNull.null, uniquingContext ?: NSNull.null ];
+
+	__block NSError *decodeError = nil;
+	id model = [payloadCache objectForPayload:payload modelClass:self.modelClass configuration:configuration decodingWithBlock:^{
+		return decode(&decodeError);
+	}];
+
+	if (model == nil && error != NULL) *error = decodeError;
+	return model;
+}
+
+- (BOOL)updateModel:(id<MTLJSONSerializing>)model fromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError * __autoreleasing *)error {
+	NSParameterAssert(model != nil);
+	NSParameterAssert([model isKindOfClass:self.modelClass]);
+	NSParameterAssert(!MTLPayloadCacheIsSharedObject(model));
+
+	if (MTLJSONAdapterNeedsDecodingScope(self)) {
+		// Make the pool and context available to the adapters of nested models.
+		MTLJSONAdapterDecodingScope previousScope = MTLJSONAdapterEnterDecodingScope(self);
+		@onExit {
+			MTLJSONAdapterCurrentDecodingScope = previousScope;
+		};
+
+		return [self updateModel:model fromJSONDictionary:JSONDictionary error:error];
+	}
+
+	if (model.class != self.modelClass) {
+		MTLJSONAdapter *otherAdapter = [self JSONAdapterForModelClass:model.class error:error];
+
+		return [otherAdapter updateModel:model fromJSONDictionary:JSONDictionary error:error];
+	}
+
 	if (JSONDictionary == nil || ![JSONDictionary isKindOfClass:NSDictionary.class]) {
 		if (error != NULL) {
-			NSDictionary *userInfo = @{
-				NSLocalizedDescriptionKey: NSLocalizedString(@"Missing JSON dictionary", @""),
-				NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"%@ could not be created because an invalid JSON dictionary was provided: %@", @""), NSStringFromClass(self.modelClass), JSONDictionary.class],
-			};
-			*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONDictionary userInfo:userInfo];
+			*error = [NSError mtl_errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONDictionary descriptionFormat:NSLocalizedString(@"Missing JSON dictionary", @"") failureReasonFormat:NSLocalizedString(@"%@ could not be updated because an invalid JSON dictionary was provided: %@", @"") arguments:@[ NSStringFromClass(self.modelClass), JSONDictionary.class ?: NSNull.null ] userInfo:nil];
 		}
-		return nil;
+		return NO;
 	}
 
+	NSDictionary *dictionaryValue = [self dictionaryValueFromJSONDictionary:JSONDictionary partial:YES error:error];
+	if (dictionaryValue == nil) return NO;
+
+	NSObject<MTLModel> *object = (id)model;
+	NSMutableDictionary *changedValues = [[NSMutableDictionary alloc] initWithCapacity:dictionaryValue.count];
+
+	// The values replaced so far, with nil represented by NSNull, to restore
+	// if setting a later value throws.
+	NSMutableDictionary *previousValues = [[NSMutableDictionary alloc] initWithCapacity:dictionaryValue.count];
+
+	@try {
+		// Validate every changed value before setting any of them, so that a
+		// failed validation leaves the model untouched.
+		for (NSString *key in dictionaryValue) {
+			id value = dictionaryValue[key];
+			if ([value isEqual:NSNull.null]) value = nil;
+
+			id currentValue = [object valueForKey:key];
+			if (currentValue == value || [currentValue isEqual:value]) continue;
+
+			// Mark this as being autoreleased, because validateValue may return
+			// a new object to be stored in this variable.
+			__autoreleasing id validatedValue = value;
+			if (![object validateValue:&validatedValue forKey:key error:error]) return NO;
+
+			changedValues[key] = validatedValue ?: NSNull.null;
+		}
+
+		for (NSString *key in changedValues) {
+			id value = changedValues[key];
+			previousValues[key] = [object valueForKey:key] ?: NSNull.null;
+			[object setValue:([value isEqual:NSNull.null] ? nil : value) forKey:key];
+		}
+	} @catch (NSException *ex) {
+		NSLog(@"*** Caught exception updating %@ from JSON dictionary: %@", object, ex);
+
+		// Restore the values set before the exception. The value being set
+		// when it was thrown is restored too, in case it was partly applied.
+		@try {
+			for (NSString *key in previousValues) {
+				id value = previousValues[key];
+				[object setValue:([value isEqual:NSNull.null] ? nil : value) forKey:key];
+			}
+		} @catch (NSException *rollbackException) {
+			NSLog(@"*** Caught exception restoring %@ after a failed update: %@", object, rollbackException);
+		}
+
+		// Fail fast in Debug builds.
+		#if DEBUG
+		@throw ex;
+		#else
+		if (error != NULL) {
+			*error = [NSError mtl_modelErrorWithException:ex];
+		}
+
+		return NO;
+		#endif
+	}
+
+	return YES;
+}
+
+// Transforms the values of all properties present in `JSONDictionary`, with nil
+// values represented by NSNull.
+//
+// partial - Whether properties mapped to multiple JSON key paths are only
+//           considered present if at least one of the key paths is. Otherwise,
+//           their transformers always receive a dictionary, which may be
+//           empty.
+//
+// Returns a dictionary value, or nil if a transformation failed.
+- (NSDictionary *)dictionaryValueFromJSONDictionary:(NSDictionary *)JSONDictionary partial:(BOOL)partial error:(NSError * __autoreleasing *)error {
+	BOOL tracing = MTLTraceEnabled;
+
 	NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:JSONDictionary.count];
 
-	for (NSString *propertyKey in [self.modelClass propertyKeys]) {
+	MTLStringInterningPool *stringInterningPool = self.stringInterningPool ?: MTLJSONAdapterCurrentDecodingScope.stringInterningPool;
+	NSSet *stringInterningPropertyKeys = self.stringInterningPropertyKeys;
+
+	// Full decodes go through a decoder specialized for the shape of the
+	// dictionary if possible, which already knows the properties that are
+	// absent and the values that don't need to be transformed.
+	MTLJSONShapeCache *shapeCache = self.shapeCache;
+	NSArray *propertyKeys = shapeCache.propertyKeys;
+
+	// The top-level values are only needed for full decodes. They are kept on
+	// the stack unless the model class is unusually wide.
+	__unsafe_unretained id stackTopLevelValues[MTLJSONAdapterStackTopLevelValueLimit];
+	__unsafe_unretained id *topLevelValues = NULL;
+	MTLJSONShape *shape = nil;
+
+	if (!partial) {
+		NSUInteger topLevelKeyCount = shapeCache.topLevelKeyCount;
+		topLevelValues = (topLevelKeyCount <= MTLJSONAdapterStackTopLevelValueLimit ? stackTopLevelValues : (__unsafe_unretained id *)malloc(topLevelKeyCount * sizeof(id)));
+
+		shape = [shapeCache shapeForJSONDictionary:JSONDictionary values:topLevelValues];
+	}
+
+	@onExit {
+		if (topLevelValues != stackTopLevelValues) free(topLevelValues);
+	};
+
+	for (NSUInteger index = 0; index < propertyKeys.count; index++) {
+		NSString *propertyKey = propertyKeys[index];
 		id JSONKeyPaths = self.JSONKeyPathsByPropertyKey[propertyKey];
 
-		if (JSONKeyPaths == nil) continue;
+		MTLJSONShapePropertyAction action = (shape != nil ? [shape actionForPropertyAtIndex:index] : MTLJSONShapePropertyActionGeneric);
+		if (action == MTLJSONShapePropertyActionSkip) continue;
 
 		id value;
+		BOOL success = YES;
 
-		if ([JSONKeyPaths isKindOfClass:NSArray.class]) {
-			NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+		if (action == MTLJSONShapePropertyActionGeneric) {
+			if (tracing) MTLTraceBegin(MTLTraceStageKeyPathExtraction, self.modelClass);
+
+			if ([JSONKeyPaths isKindOfClass:NSArray.class]) {
+				NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
 
-			for (NSString *keyPath in JSONKeyPaths) {
-				BOOL success = NO;
-				id value = [JSONDictionary mtl_valueForJSONKeyPath:keyPath success:&success error:error];
+				for (NSString *keyPath in JSONKeyPaths) {
+					id value = [JSONDictionary mtl_valueForJSONKeyPath:keyPath success:&success error:error];
 
-				if (!success) return nil;
+					if (!success) break;
+
+					if (value != nil) dictionary[keyPath] = value;
+				}
 
-				if (value != nil) dictionary[keyPath] = value;
+				value = (partial && dictionary.count == 0 ? nil : dictionary);
+			} else {
+				value = [JSONDictionary mtl_valueForJSONKeyPath:JSONKeyPaths success:&success error:error];
 			}
 
-			value = dictionary;
-		} else {
-			BOOL success = NO;
-			value = [JSONDictionary mtl_valueForJSONKeyPath:JSONKeyPaths success:&success error:error];
+			if (tracing) MTLTraceEnd(MTLTraceStageKeyPathExtraction, self.modelClass);
 
 			if (!success) return nil;
+
+			if (value == nil) continue;
+		} else {
+			value = topLevelValues[[shapeCache topLevelKeyIndexOfPropertyAtIndex:index]];
 		}
 
-		if (value == nil) continue;
+		// Whether a transform stage needs to be ended if an exception is
+		// thrown.
+		BOOL tracingTransform = NO;
 
 		@try {
-			NSValueTransformer *transformer = self.valueTransformersByPropertyKey[propertyKey];
+			NSValueTransformer *transformer = (action != MTLJSONShapePropertyActionPassThrough ? self.valueTransformersByPropertyKey[propertyKey] : nil);
 			if (transformer != nil) {
 				// Map NSNull -> nil for the transformer, and then back for the
 				// dictionary we're going to insert into.
 				if ([value isEqual:NSNull.null]) value = nil;
 
+				uint64_t transformStartTime = (MTLMetricsEnabled ? MTLMetricsCurrentTime() : 0);
+				NSError *transformError = nil;
+				success = YES;
+
+				tracingTransform = tracing;
+				if (tracingTransform) MTLTraceBegin(MTLTraceStageTransform, self.modelClass);
+
 				if ([transformer respondsToSelector:@selector(transformedValue:success:error:)]) {
 					id<MTLTransformerErrorHandling> errorHandlingTransformer = (id)transformer;
 
-					BOOL success = YES;
-					value = [errorHandlingTransformer transformedValue:value success:&success error:error];
-
-					if (!success) return nil;
+					value = [errorHandlingTransformer transformedValue:value success:&success error:&transformError];
 				} else {
 					value = [transformer transformedValue:value];
 				}
 
+				if (MTLMetricsEnabled) MTLMetricsRecord(MTLMetricKindTransform, self.modelClass, propertyKey, transformStartTime, success, (success ? nil : transformError));
+
+				if (tracingTransform) MTLTraceEnd(MTLTraceStageTransform, self.modelClass);
+				tracingTransform = NO;
+
+				if (!success) {
+					if (error != NULL && transformError != nil) *error = transformError;
+					return nil;
+				}
+
 				if (value == nil) value = NSNull.null;
 			}
 
+			if (stringInterningPool != nil && [stringInterningPropertyKeys containsObject:propertyKey]) {
+				value = MTLJSONAdapterInternStrings(stringInterningPool, value);
+			}
+
 			dictionaryValue[propertyKey] = value;
 		} @catch (NSException *ex) {
+			if (tracingTransform) MTLTraceEnd(MTLTraceStageTransform, self.modelClass);
+
 			NSLog(@"*** Caught exception %@ parsing JSON key path \"%@\" from: %@", ex, JSONKeyPaths, JSONDictionary);
 
 			// Fail fast in Debug builds.
@@ -368,9 +803,53 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 		}
 	}
 
+	return dictionaryValue;
+}
+
+- (id)modelOfAdapterClassFromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError * __autoreleasing *)error {
+	if (JSONDictionary == nil || ![JSONDictionary isKindOfClass:NSDictionary.class]) {
+		if (error != NULL) {
+			*error = [NSError mtl_errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONDictionary descriptionFormat:NSLocalizedString(@"Missing JSON dictionary", @"") failureReasonFormat:NSLocalizedString(@"%@ could not be created because an invalid JSON dictionary was provided: %@", @"") arguments:@[ NSStringFromClass(self.modelClass), JSONDictionary.class ?: NSNull.null ] userInfo:nil];
+		}
+		return nil;
+	}
+
+	NSDictionary *dictionaryValue = [self dictionaryValueFromJSONDictionary:JSONDictionary partial:NO error:error];
+	if (dictionaryValue == nil) return nil;
+
+	BOOL tracing = MTLTraceEnabled;
+
+	if (tracing) MTLTraceBegin(MTLTraceStageModelInitialization, self.modelClass);
 	id model = [self.modelClass modelWithDictionary:dictionaryValue error:error];
+	if (tracing) MTLTraceEnd(MTLTraceStageModelInitialization, self.modelClass);
+
+	if (model == nil) return nil;
+
+	if (!tracing && !MTLMetricsEnabled) return [model validate:error] ? [self uniquedModel:model] : nil;
+
+	if (tracing) MTLTraceBegin(MTLTraceStageValidation, self.modelClass);
 
-	return [model validate:error] ? model : nil;
+	uint64_t validationStartTime = MTLMetricsCurrentTime();
+	NSError *validationError = nil;
+	BOOL valid = [model validate:&validationError];
+	if (MTLMetricsEnabled) MTLMetricsRecord(MTLMetricKindValidation, self.modelClass, nil, validationStartTime, valid, (valid ? nil : validationError));
+	if (!valid && error != NULL && validationError != nil) *error = validationError;
+
+	if (tracing) MTLTraceEnd(MTLTraceStageValidation, self.modelClass);
+
+	return valid ? [self uniquedModel:model] : nil;
+}
+
+// Returns the canonical instance of a decoded model from the uniquing
+// context of the decode in effect, if any.
+//
+// The receiver's own context was put into effect when its decode began, so
+// that it never outlives the decode.
+- (id)uniquedModel:(id)model {
+	MTLUniquingContext *uniquingContext = MTLJSONAdapterCurrentDecodingScope.uniquingContext;
+	if (uniquingContext == nil) return model;
+
+	return [uniquingContext uniqueModel:model];
 }
 
 + (NSDictionary *)valueTransformersForModelClass:(Class)modelClass {
@@ -434,9 +913,66 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 		if (transformer != nil) result[key] = transformer;
 	}
 
+	if ([modelClass respondsToSelector:@selector(JSONPropertyKeysForTransformerMemoization)]) {
+		for (NSString *key in [modelClass JSONPropertyKeysForTransformerMemoization]) {
+			NSValueTransformer *transformer = result[key];
+			if (transformer == nil) continue;
+
+			result[key] = [self memoizingTransformerForKey:key modelClass:modelClass transformer:transformer];
+		}
+	}
+
 	return result;
 }
 
+// Maps @[ adapterClass, modelClass ] to dictionaries of memoizing transformers
+// keyed by property key, for the most recently used model classes.
++ (MTLLRUCache *)memoizingTransformersByClasses {
+	static MTLLRUCache *transformers;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		transformers = [[MTLLRUCache alloc] initWithCountLimit:MTLJSONAdapterMemoizedClassCountLimit totalCostLimit:0];
+	});
+
+	return transformers;
+}
+
++ (MTLMemoizingValueTransformer *)memoizingTransformerForKey:(NSString *)key modelClass:(Class)modelClass transformer:(NSValueTransformer *)transformer {
+	NSParameterAssert(key != nil);
+	NSParameterAssert(modelClass != nil);
+	NSParameterAssert(transformer != nil);
+
+	MTLLRUCache *transformersByClasses = [MTLJSONAdapter memoizingTransformersByClasses];
+
+	@synchronized (transformersByClasses) {
+		NSArray *classes = @[ self, modelClass ];
+		NSMutableDictionary *transformersByKey = [transformersByClasses objectForKey:classes];
+		if (transformersByKey == nil) {
+			transformersByKey = [[NSMutableDictionary alloc] init];
+			[transformersByClasses setObject:transformersByKey forKey:classes cost:1];
+		}
+
+		MTLMemoizingValueTransformer *result = transformersByKey[key];
+		if (result == nil) {
+			result = [MTLMemoizingValueTransformer transformerWithTransformer:transformer countLimit:MTLJSONAdapterMemoizationCountLimit memoizesReverseTransformations:YES];
+			transformersByKey[key] = result;
+		}
+
+		return result;
+	}
+}
+
++ (NSDictionary *)memoizingTransformersForModelClass:(Class)modelClass {
+	NSParameterAssert(modelClass != nil);
+	NSParameterAssert([modelClass conformsToProtocol:@protocol(MTLJSONSerializing)]);
+
+	MTLLRUCache *transformersByClasses = [MTLJSONAdapter memoizingTransformersByClasses];
+
+	@synchronized (transformersByClasses) {
+		return [[transformersByClasses objectForKey:@[ self, modelClass ]] copy] ?: @{};
+	}
+}
+
 - (MTLJSONAdapter *)JSONAdapterForModelClass:(Class)modelClass error:(NSError * __autoreleasing *)error {
 	NSParameterAssert(modelClass != nil);
 	NSParameterAssert([modelClass conformsToProtocol:@protocol(MTLJSONSerializing)]);
@@ -444,12 +980,14 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 	@synchronized(self) {
 		MTLJSONAdapter *result = [self.JSONAdaptersByModelClass objectForKey:modelClass];
 
-		if (result != nil) return result;
+		if (MTLMetricsEnabled) MTLMetricsRecord(result != nil ? MTLMetricKindAdapterCacheHit : MTLMetricKindAdapterCacheMiss, modelClass, nil, 0, YES, nil);
 
-		result = [[self.class alloc] initWithModelClass:modelClass];
+		if (result == nil) {
+			result = [[self.class alloc] initWithModelClass:modelClass];
 
-		if (result != nil) {
-			[self.JSONAdaptersByModelClass setObject:result forKey:modelClass];
+			if (result != nil) {
+				[self.JSONAdaptersByModelClass setObject:result forKey:modelClass];
+			}
 		}
 
 		return result;
@@ -485,35 +1023,87 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 
 @end
 
+// Creates an adapter on first use, which can then be read from many threads at
+// once without taking a lock.
+@interface MTLJSONAdapterLazyReference : NSObject {
+	// A +1 reference to the adapter, or NULL if it has not been created yet.
+	_Atomic(void *) _adapter;
+}
+
+- (instancetype)initWithAdapterClass:(Class)adapterClass modelClass:(Class)modelClass;
+
+@property (nonatomic, strong, readonly) Class adapterClass;
+@property (nonatomic, strong, readonly) Class modelClass;
+
+// The adapter for `modelClass`, which is created the first time this is read.
+//
+// If several threads read this at once, each may create an adapter, but they
+// all return the one that was published first.
+@property (nonatomic, strong, readonly) MTLJSONAdapter *adapter;
+
+@end
+
+@implementation MTLJSONAdapterLazyReference
+
+- (instancetype)initWithAdapterClass:(Class)adapterClass modelClass:(Class)modelClass {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_adapterClass = adapterClass;
+	_modelClass = modelClass;
+	atomic_init(&_adapter, NULL);
+
+	return self;
+}
+
+- (void)dealloc {
+	void *adapter = atomic_load_explicit(&_adapter, memory_order_acquire);
+	if (adapter != NULL) CFRelease(adapter);
+}
+
+- (MTLJSONAdapter *)adapter {
+	void *existingAdapter = atomic_load_explicit(&_adapter, memory_order_acquire);
+	if (existingAdapter != NULL) return (__bridge MTLJSONAdapter *)existingAdapter;
+
+	MTLJSONAdapter *adapter = [[self.adapterClass alloc] initWithModelClass:self.modelClass];
+	if (adapter == nil) return nil;
+
+	void *retainedAdapter = (void *)CFBridgingRetain(adapter);
+
+	if (!atomic_compare_exchange_strong_explicit(&_adapter, &existingAdapter, retainedAdapter, memory_order_acq_rel, memory_order_acquire)) {
+		// Another thread published its adapter first.
+		CFRelease(retainedAdapter);
+		return (__bridge MTLJSONAdapter *)existingAdapter;
+	}
+
+	return adapter;
+}
+
+@end
+
 @implementation MTLJSONAdapter (ValueTransformers)
 
 + (NSValueTransformer<MTLTransformerErrorHandling> *)dictionaryTransformerWithModelClass:(Class)modelClass {
 	NSParameterAssert([modelClass conformsToProtocol:@protocol(MTLModel)]);
 	NSParameterAssert([modelClass conformsToProtocol:@protocol(MTLJSONSerializing)]);
-	__block MTLJSONAdapter *adapter;
-	
+
+	// The adapter is created lazily, since creating it eagerly would recurse
+	// infinitely for models which (indirectly) contain themselves.
+	MTLJSONAdapterLazyReference *adapterReference = [[MTLJSONAdapterLazyReference alloc] initWithAdapterClass:self modelClass:modelClass];
+
 	return [MTLValueTransformer
 		transformerUsingForwardBlock:^ id (id JSONDictionary, BOOL *success, NSError **error) {
 			if (JSONDictionary == nil) return nil;
 			
 			if (![JSONDictionary isKindOfClass:NSDictionary.class]) {
 				if (error != NULL) {
-					NSDictionary *userInfo = @{
-						NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert JSON dictionary to model object", @""),
-						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSDictionary, got: %@", @""), JSONDictionary],
-						MTLTransformerErrorHandlingInputValueErrorKey : JSONDictionary
-					};
-					
-					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+					*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert JSON dictionary to model object", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSDictionary, got: %@", @"") arguments:@[ JSONDictionary ] inputValue:JSONDictionary];
 				}
 				*success = NO;
 				return nil;
 			}
 
-			if (!adapter) {
-				adapter = [[self alloc] initWithModelClass:modelClass];
-			}
-			id model = [adapter modelFromJSONDictionary:JSONDictionary error:error];
+			id model = [adapterReference.adapter modelFromJSONDictionary:JSONDictionary error:error];
 			if (model == nil) {
 				*success = NO;
 			}
@@ -525,22 +1115,13 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 			
 			if (![model conformsToProtocol:@protocol(MTLModel)] || ![model conformsToProtocol:@protocol(MTLJSONSerializing)]) {
 				if (error != NULL) {
-					NSDictionary *userInfo = @{
-						NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert model object to JSON dictionary", @""),
-						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected a MTLModel object conforming to <MTLJSONSerializing>, got: %@.", @""), model],
-						MTLTransformerErrorHandlingInputValueErrorKey : model
-					};
-					
-					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+					*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert model object to JSON dictionary", @"") failureReasonFormat:NSLocalizedString(@"Expected a MTLModel object conforming to <MTLJSONSerializing>, got: %@.", @"") arguments:@[ model ] inputValue:model];
 				}
 				*success = NO;
 				return nil;
 			}
 
-			if (!adapter) {
-				adapter = [[self alloc] initWithModelClass:modelClass];
-			}
-			NSDictionary *result = [adapter JSONDictionaryFromModel:model error:error];
+			NSDictionary *result = [adapterReference.adapter JSONDictionaryFromModel:model error:error];
 			if (result == nil) {
 				*success = NO;
 			}
@@ -550,54 +1131,47 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 }
 
 + (NSValueTransformer<MTLTransformerErrorHandling> *)arrayTransformerWithModelClass:(Class)modelClass {
-	id<MTLTransformerErrorHandling> dictionaryTransformer = [self dictionaryTransformerWithModelClass:modelClass];
-	
+	// Transforms all dictionaries or models in a single batch.
+	NSValueTransformer<MTLTransformerErrorHandling> *mappingTransformer = [NSValueTransformer mtl_arrayMappingTransformerWithTransformer:[self dictionaryTransformerWithModelClass:modelClass]];
+
 	return [MTLValueTransformer
 		transformerUsingForwardBlock:^ id (NSArray *dictionaries, BOOL *success, NSError **error) {
 			if (dictionaries == nil) return nil;
 			
 			if (![dictionaries isKindOfClass:NSArray.class]) {
 				if (error != NULL) {
-					NSDictionary *userInfo = @{
-						NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert JSON array to model array", @""),
-						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSArray, got: %@.", @""), dictionaries],
-						MTLTransformerErrorHandlingInputValueErrorKey : dictionaries
-					};
-					
-					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+					*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert JSON array to model array", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSArray, got: %@.", @"") arguments:@[ dictionaries ] inputValue:dictionaries];
 				}
 				*success = NO;
 				return nil;
 			}
 			
-			NSMutableArray *models = [NSMutableArray arrayWithCapacity:dictionaries.count];
+			NSUInteger index = 0;
 			for (id JSONDictionary in dictionaries) {
-				if (JSONDictionary == NSNull.null) {
-					[models addObject:NSNull.null];
-					continue;
-				}
-				
-				if (![JSONDictionary isKindOfClass:NSDictionary.class]) {
+				if (JSONDictionary != NSNull.null && ![JSONDictionary isKindOfClass:NSDictionary.class]) {
 					if (error != NULL) {
 						NSDictionary *userInfo = @{
-							NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert JSON array to model array", @""),
-							NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSDictionary or an NSNull, got: %@.", @""), JSONDictionary],
-							MTLTransformerErrorHandlingInputValueErrorKey : JSONDictionary
+							MTLTransformerErrorHandlingInputValueErrorKey: JSONDictionary,
+							MTLTransformerErrorHandlingIndexErrorKey: @(index)
 						};
-						
-						*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+
+						*error = [NSError mtl_errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput descriptionFormat:NSLocalizedString(@"Could not convert JSON array to model array", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSDictionary or an NSNull, got: %@.", @"") arguments:@[ JSONDictionary ] userInfo:userInfo];
 					}
 					*success = NO;
 					return nil;
 				}
-				
-				id model = [dictionaryTransformer transformedValue:JSONDictionary success:success error:error];
-				
-				if (*success == NO) return nil;
-				
-				if (model == nil) continue;
-				
-				[models addObject:model];
+
+				index++;
+			}
+			
+			NSError *mappingError = nil;
+			NSArray *models = [mappingTransformer transformedValue:dictionaries success:success error:&mappingError];
+
+			if (*success == NO) {
+				// Surface the error of the model which failed, as if it had
+				// been transformed on its own.
+				if (error != NULL) *error = [mappingError mtl_userInfoValueForKey:NSUnderlyingErrorKey] ?: mappingError;
+				return nil;
 			}
 			
 			return models;
@@ -607,46 +1181,36 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 			
 			if (![models isKindOfClass:NSArray.class]) {
 				if (error != NULL) {
-					NSDictionary *userInfo = @{
-						NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert model array to JSON array", @""),
-						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSArray, got: %@.", @""), models],
-						MTLTransformerErrorHandlingInputValueErrorKey : models
-					};
-					
-					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+					*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert model array to JSON array", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSArray, got: %@.", @"") arguments:@[ models ] inputValue:models];
 				}
 				*success = NO;
 				return nil;
 			}
 			
-			NSMutableArray *dictionaries = [NSMutableArray arrayWithCapacity:models.count];
+			NSUInteger index = 0;
 			for (id model in models) {
-				if (model == NSNull.null) {
-					[dictionaries addObject:NSNull.null];
-					continue;
-				}
-				
-				if (![model isKindOfClass:MTLModel.class]) {
+				if (model != NSNull.null && ![model isKindOfClass:MTLModel.class]) {
 					if (error != NULL) {
 						NSDictionary *userInfo = @{
-							NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert JSON array to model array", @""),
-							NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected a MTLModel or an NSNull, got: %@.", @""), model],
-							MTLTransformerErrorHandlingInputValueErrorKey : model
+							MTLTransformerErrorHandlingInputValueErrorKey: model,
+							MTLTransformerErrorHandlingIndexErrorKey: @(index)
 						};
-						
-						*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+
+						*error = [NSError mtl_errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput descriptionFormat:NSLocalizedString(@"Could not convert JSON array to model array", @"") failureReasonFormat:NSLocalizedString(@"Expected a MTLModel or an NSNull, got: %@.", @"") arguments:@[ model ] userInfo:userInfo];
 					}
 					*success = NO;
 					return nil;
 				}
-				
-				NSDictionary *dict = [dictionaryTransformer reverseTransformedValue:model success:success error:error];
-				
-				if (*success == NO) return nil;
-				
-				if (dict == nil) continue;
-				
-				[dictionaries addObject:dict];
+
+				index++;
+			}
+			
+			NSError *mappingError = nil;
+			NSArray *dictionaries = [mappingTransformer reverseTransformedValue:models success:success error:&mappingError];
+
+			if (*success == NO) {
+				if (error != NULL) *error = [mappingError mtl_userInfoValueForKey:NSUnderlyingErrorKey] ?: mappingError;
+				return nil;
 			}
 			
 			return dictionaries;
@@ -0,0 +1,103 @@
+//
+//  MTLJSONShapeCache.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/// What a decoder specialized for a shape does with a property.
+///
+/// MTLJSONShapePropertyActionSkip        - The property's JSON key path is
+///                                         absent, so it is not decoded.
+/// MTLJSONShapePropertyActionPassThrough - The property's JSON value is used
+///                                         as is, since it has no transformer,
+///                                         or only a validating transformer
+///                                         which the value's type is known to
+///                                         satisfy.
+/// MTLJSONShapePropertyActionTransform   - The property's JSON value is passed
+///                                         to its transformer.
+/// MTLJSONShapePropertyActionGeneric     - The property is mapped to a nested
+///                                         or multiple JSON key paths, so its
+///                                         value is extracted and transformed
+///                                         without specialization.
+typedef enum : uint8_t {
+	MTLJSONShapePropertyActionSkip,
+	MTLJSONShapePropertyActionPassThrough,
+	MTLJSONShapePropertyActionTransform,
+	MTLJSONShapePropertyActionGeneric,
+} MTLJSONShapePropertyAction;
+
+/// A decoder specialized for one shape of JSON dictionary.
+@interface MTLJSONShape : NSObject
+
+/// Returns what to do with the property at `index` of the cache's
+/// `propertyKeys`.
+- (MTLJSONShapePropertyAction)actionForPropertyAtIndex:(NSUInteger)index;
+
+@end
+
+/// Caches decoders specialized for the shapes of the JSON dictionaries decoded
+/// into one model class, similar to the inline caches of JavaScript engines.
+///
+/// The shape of a JSON dictionary consists of the presence and JSON types of
+/// the top-level values which the model class's JSON key paths start with. Keys
+/// which are not mapped to any property don't affect the shape.
+///
+/// At most a handful of shapes are cached, after which dictionaries of other
+/// shapes are decoded without specialization.
+///
+/// This class is thread-safe.
+@interface MTLJSONShapeCache : NSObject
+
+/// Initializes the receiver for a model class.
+///
+/// modelClass                     - The class being decoded, for which
+///                                  MTLMetricKindShapeCacheHit and
+///                                  MTLMetricKindShapeCacheMiss are recorded.
+///                                  This argument must not be nil.
+/// JSONKeyPathsByPropertyKey      - The model class's JSON key paths. This
+///                                  argument must not be nil.
+/// valueTransformersByPropertyKey - The transformers used when decoding the
+///                                  properties. This argument must not be nil.
+- (instancetype)initWithModelClass:(Class)modelClass JSONKeyPathsByPropertyKey:(NSDictionary *)JSONKeyPathsByPropertyKey valueTransformersByPropertyKey:(NSDictionary *)valueTransformersByPropertyKey;
+
+/// The keys of all mapped properties, in the order used by shapes.
+@property (nonatomic, copy, readonly) NSArray *propertyKeys;
+
+/// The number of top-level JSON keys which the JSON key paths start with.
+@property (nonatomic, assign, readonly) NSUInteger topLevelKeyCount;
+
+/// Returns the index of the top-level value of the property at `index` of
+/// `propertyKeys`, for use with the values returned by
+/// -shapeForJSONDictionary:values:.
+- (NSUInteger)topLevelKeyIndexOfPropertyAtIndex:(NSUInteger)index;
+
+/// Looks up the decoder specialized for the shape of `JSONDictionary`, and
+/// creates one if it isn't cached yet and there's still room.
+///
+/// Every call counts as a hit or a miss, and records the metric of the same
+/// kind if metrics are enabled. Partial decodes don't call this, so they are
+/// never counted.
+///
+/// JSONDictionary - The JSON dictionary to decode. This argument must not be
+///                  nil.
+/// values         - A buffer of `topLevelKeyCount` elements which is set to the
+///                  top-level values of `JSONDictionary`, or nil for absent
+///                  ones.
+///
+/// Returns a shape, or nil if the dictionary must be decoded without
+/// specialization.
+- (MTLJSONShape *)shapeForJSONDictionary:(NSDictionary *)JSONDictionary values:(__unsafe_unretained id *)values;
+
+/// The number of dictionaries whose shape was already cached.
+@property (atomic, assign, readonly) NSUInteger hitCount;
+
+/// The number of dictionaries whose shape was not cached, either because it
+/// was new, or because the cache was full and it had to be decoded without
+/// specialization.
+@property (atomic, assign, readonly) NSUInteger missCount;
+
+@end
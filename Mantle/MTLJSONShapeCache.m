@@ -0,0 +1,331 @@
+//
+//  MTLJSONShapeCache.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <objc/runtime.h>
+#import <stdatomic.h>
+
+#import "MTLJSONShapeCache.h"
+#import "MTLMetricsRecording.h"
+#import "MTLValidatingValueTransformer.h"
+
+// The maximum number of shapes cached for a model class. Dictionaries of any
+// other shape are decoded generically, like a megamorphic call site.
+static const NSUInteger MTLJSONShapeCacheLimit = 4;
+
+// The JSON type of a top-level value in a shape.
+typedef enum : uint8_t {
+	MTLJSONValueKindAbsent,
+	MTLJSONValueKindNull,
+	MTLJSONValueKindString,
+	MTLJSONValueKindNumber,
+	MTLJSONValueKindArray,
+	MTLJSONValueKindDictionary,
+	MTLJSONValueKindOther,
+} MTLJSONValueKind;
+
+static MTLJSONValueKind MTLJSONValueKindOfValue(id value) {
+	if (value == nil) return MTLJSONValueKindAbsent;
+	if (value == NSNull.null) return MTLJSONValueKindNull;
+	if ([value isKindOfClass:NSString.class]) return MTLJSONValueKindString;
+	if ([value isKindOfClass:NSNumber.class]) return MTLJSONValueKindNumber;
+	if ([value isKindOfClass:NSArray.class]) return MTLJSONValueKindArray;
+	if ([value isKindOfClass:NSDictionary.class]) return MTLJSONValueKindDictionary;
+
+	return MTLJSONValueKindOther;
+}
+
+// Returns the class which all values of `kind` are kinds of, or Nil if there is
+// no such class.
+static Class MTLJSONValueKindClass(MTLJSONValueKind kind) {
+	switch (kind) {
+		case MTLJSONValueKindString:
+			return NSString.class;
+
+		case MTLJSONValueKindNumber:
+			return NSNumber.class;
+
+		case MTLJSONValueKindArray:
+			return NSArray.class;
+
+		case MTLJSONValueKindDictionary:
+			return NSDictionary.class;
+
+		default:
+			return Nil;
+	}
+}
+
+@interface MTLJSONShape () {
+	NSUInteger _valueCount;
+
+	// The classes and JSON types of the top-level values the shape was
+	// specialized for. Comparing classes first means that the JSON type only
+	// needs to be determined for values of classes which weren't seen before.
+	__unsafe_unretained Class *_classes;
+	MTLJSONValueKind *_kinds;
+
+	// One action per property of the cache.
+	MTLJSONShapePropertyAction *_actions;
+}
+
+// Initializes the receiver, which takes ownership of the given malloc()ed
+// buffers.
+- (instancetype)initWithValueCount:(NSUInteger)valueCount classes:(__unsafe_unretained Class *)classes kinds:(MTLJSONValueKind *)kinds actions:(MTLJSONShapePropertyAction *)actions;
+
+// Returns whether top-level values have the shape of the receiver.
+- (BOOL)matchesValues:(__unsafe_unretained id *)values;
+
+@end
+
+@implementation MTLJSONShape
+
+- (instancetype)initWithValueCount:(NSUInteger)valueCount classes:(__unsafe_unretained Class *)classes kinds:(MTLJSONValueKind *)kinds actions:(MTLJSONShapePropertyAction *)actions {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_valueCount = valueCount;
+	_classes = classes;
+	_kinds = kinds;
+	_actions = actions;
+
+	return self;
+}
+
+- (void)dealloc {
+	free(_classes);
+	free(_kinds);
+	free(_actions);
+}
+
+- (MTLJSONShapePropertyAction)actionForPropertyAtIndex:(NSUInteger)index {
+	return _actions[index];
+}
+
+- (BOOL)matchesValues:(__unsafe_unretained id *)values {
+	for (NSUInteger index = 0; index < _valueCount; index++) {
+		id value = values[index];
+		if (object_getClass(value) == _classes[index]) continue;
+
+		if (MTLJSONValueKindOfValue(value) != _kinds[index]) return NO;
+	}
+
+	return YES;
+}
+
+@end
+
+@interface MTLJSONShapeCache () {
+	// For each property, the index of the top-level key its JSON key path
+	// starts with, or NSNotFound if it has multiple key paths.
+	NSUInteger *_topLevelKeyIndexes;
+
+	// For each property, whether its JSON key path has more than one
+	// component.
+	BOOL *_nestedKeyPaths;
+
+	_Atomic(NSUInteger) _hitCount;
+	_Atomic(NSUInteger) _missCount;
+}
+
+@property (nonatomic, strong, readonly) Class modelClass;
+
+// The top-level keys of the JSON key paths, in the order of the values
+// returned by -shapeForJSONDictionary:values:.
+@property (nonatomic, copy, readonly) NSArray *topLevelKeys;
+
+// The transformer of each property, or NSNull for properties without one.
+@property (nonatomic, copy, readonly) NSArray *transformers;
+
+// The specialized shapes, in the order they were encountered. Replaced while
+// synchronized on the receiver.
+@property (atomic, copy) NSArray *shapes;
+
+@end
+
+@implementation MTLJSONShapeCache
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithModelClass:(Class)modelClass JSONKeyPathsByPropertyKey:(NSDictionary *)JSONKeyPathsByPropertyKey valueTransformersByPropertyKey:(NSDictionary *)valueTransformersByPropertyKey {
+	NSParameterAssert(modelClass != nil);
+	NSParameterAssert(JSONKeyPathsByPropertyKey != nil);
+	NSParameterAssert(valueTransformersByPropertyKey != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_modelClass = modelClass;
+	_propertyKeys = [JSONKeyPathsByPropertyKey.allKeys sortedArrayUsingSelector:@selector(compare:)];
+	_shapes = @[];
+
+	NSUInteger propertyCount = _propertyKeys.count;
+	_topLevelKeyIndexes = malloc(MAX(propertyCount, 1) * sizeof(*_topLevelKeyIndexes));
+	_nestedKeyPaths = malloc(MAX(propertyCount, 1) * sizeof(*_nestedKeyPaths));
+
+	NSMutableArray *topLevelKeys = [[NSMutableArray alloc] initWithCapacity:propertyCount];
+	NSMutableDictionary *indexesByTopLevelKey = [[NSMutableDictionary alloc] initWithCapacity:propertyCount];
+	NSMutableArray *transformers = [[NSMutableArray alloc] initWithCapacity:propertyCount];
+
+	for (NSUInteger index = 0; index < propertyCount; index++) {
+		NSString *propertyKey = _propertyKeys[index];
+		[transformers addObject:valueTransformersByPropertyKey[propertyKey] ?: NSNull.null];
+
+		id JSONKeyPaths = JSONKeyPathsByPropertyKey[propertyKey];
+		if ([JSONKeyPaths isKindOfClass:NSArray.class]) {
+			_topLevelKeyIndexes[index] = NSNotFound;
+			_nestedKeyPaths[index] = NO;
+			continue;
+		}
+
+		NSRange separator = [JSONKeyPaths rangeOfString:@"."];
+		NSString *topLevelKey = (separator.location == NSNotFound ? JSONKeyPaths : [JSONKeyPaths substringToIndex:separator.location]);
+
+		NSNumber *topLevelKeyIndex = indexesByTopLevelKey[topLevelKey];
+		if (topLevelKeyIndex == nil) {
+			topLevelKeyIndex = @(topLevelKeys.count);
+			indexesByTopLevelKey[topLevelKey] = topLevelKeyIndex;
+			[topLevelKeys addObject:topLevelKey];
+		}
+
+		_topLevelKeyIndexes[index] = topLevelKeyIndex.unsignedIntegerValue;
+		_nestedKeyPaths[index] = (separator.location != NSNotFound);
+	}
+
+	_topLevelKeys = [topLevelKeys copy];
+	_transformers = [transformers copy];
+
+	return self;
+}
+
+- (void)dealloc {
+	free(_topLevelKeyIndexes);
+	free(_nestedKeyPaths);
+}
+
+#pragma mark Statistics
+
+- (NSUInteger)hitCount {
+	return atomic_load_explicit(&_hitCount, memory_order_relaxed);
+}
+
+- (NSUInteger)missCount {
+	return atomic_load_explicit(&_missCount, memory_order_relaxed);
+}
+
+#pragma mark Shapes
+
+- (NSUInteger)topLevelKeyCount {
+	return self.topLevelKeys.count;
+}
+
+- (NSUInteger)topLevelKeyIndexOfPropertyAtIndex:(NSUInteger)index {
+	NSParameterAssert(index < self.propertyKeys.count);
+
+	return _topLevelKeyIndexes[index];
+}
+
+- (MTLJSONShape *)shapeForJSONDictionary:(NSDictionary *)JSONDictionary values:(__unsafe_unretained id *)values {
+	NSParameterAssert(JSONDictionary != nil);
+	NSParameterAssert(values != NULL);
+
+	NSArray *topLevelKeys = self.topLevelKeys;
+	NSUInteger keyCount = topLevelKeys.count;
+
+	for (NSUInteger index = 0; index < keyCount; index++) {
+		values[index] = JSONDictionary[topLevelKeys[index]];
+	}
+
+	NSArray *shapes = self.shapes;
+	for (MTLJSONShape *shape in shapes) {
+		if (![shape matchesValues:values]) continue;
+
+		atomic_fetch_add_explicit(&_hitCount, 1, memory_order_relaxed);
+		if (MTLMetricsEnabled) MTLMetricsRecord(MTLMetricKindShapeCacheHit, self.modelClass, nil, 0, YES, nil);
+
+		return shape;
+	}
+
+	atomic_fetch_add_explicit(&_missCount, 1, memory_order_relaxed);
+	if (MTLMetricsEnabled) MTLMetricsRecord(MTLMetricKindShapeCacheMiss, self.modelClass, nil, 0, YES, nil);
+
+	if (shapes.count >= MTLJSONShapeCacheLimit) return nil;
+
+	MTLJSONShape *shape = [self specializedShapeForValues:values];
+
+	@synchronized (self) {
+		// Another thread may have added the same shape in the meantime.
+		NSArray *currentShapes = self.shapes;
+		for (MTLJSONShape *currentShape in currentShapes) {
+			if ([currentShape matchesValues:values]) return currentShape;
+		}
+
+		if (currentShapes.count < MTLJSONShapeCacheLimit) {
+			self.shapes = [currentShapes arrayByAddingObject:shape];
+		}
+	}
+
+	return shape;
+}
+
+// Creates a shape specialized for the given top-level values.
+- (MTLJSONShape *)specializedShapeForValues:(__unsafe_unretained id *)values {
+	NSUInteger keyCount = self.topLevelKeys.count;
+	NSUInteger propertyCount = self.propertyKeys.count;
+
+	__unsafe_unretained Class *classes = (__unsafe_unretained Class *)calloc(MAX(keyCount, 1), sizeof(*classes));
+	MTLJSONValueKind *kinds = calloc(MAX(keyCount, 1), sizeof(*kinds));
+	MTLJSONShapePropertyAction *actions = calloc(MAX(propertyCount, 1), sizeof(*actions));
+
+	for (NSUInteger index = 0; index < keyCount; index++) {
+		classes[index] = object_getClass(values[index]);
+		kinds[index] = MTLJSONValueKindOfValue(values[index]);
+	}
+
+	for (NSUInteger index = 0; index < propertyCount; index++) {
+		NSUInteger keyIndex = _topLevelKeyIndexes[index];
+		if (keyIndex == NSNotFound) {
+			actions[index] = MTLJSONShapePropertyActionGeneric;
+			continue;
+		}
+
+		MTLJSONValueKind kind = kinds[keyIndex];
+		if (kind == MTLJSONValueKindAbsent) {
+			actions[index] = MTLJSONShapePropertyActionSkip;
+			continue;
+		}
+
+		if (_nestedKeyPaths[index]) {
+			actions[index] = MTLJSONShapePropertyActionGeneric;
+			continue;
+		}
+
+		id transformer = self.transformers[index];
+		if (transformer == NSNull.null) {
+			actions[index] = MTLJSONShapePropertyActionPassThrough;
+			continue;
+		}
+
+		// A validating transformer would return nulls and values of its class
+		// unchanged, so it doesn't need to run for them.
+		if ([transformer isKindOfClass:MTLValidatingValueTransformer.class]) {
+			Class validatedClass = [transformer validatedClass];
+			Class kindClass = MTLJSONValueKindClass(kind);
+
+			if (kind == MTLJSONValueKindNull || (kindClass != Nil && [kindClass isSubclassOfClass:validatedClass])) {
+				actions[index] = MTLJSONShapePropertyActionPassThrough;
+				continue;
+			}
+		}
+
+		actions[index] = MTLJSONShapePropertyActionTransform;
+	}
+
+	return [[MTLJSONShape alloc] initWithValueCount:keyCount classes:classes kinds:kinds actions:actions];
+}
+
+@end
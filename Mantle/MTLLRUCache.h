@@ -0,0 +1,56 @@
+//
+//  MTLLRUCache.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/// A thread-safe cache which evicts its least recently used entries once it
+/// exceeds a count or cost limit.
+@interface MTLLRUCache : NSObject
+
+/// Initializes the receiver with the given limits.
+///
+/// countLimit     - The maximum number of entries, or 0 for no limit.
+/// totalCostLimit - The maximum sum of the costs of all entries, or 0 for no
+///                  limit.
+- (instancetype)initWithCountLimit:(NSUInteger)countLimit totalCostLimit:(NSUInteger)totalCostLimit;
+
+/// The maximum number of entries, or 0 if unlimited.
+@property (nonatomic, assign, readonly) NSUInteger countLimit;
+
+/// The maximum total cost of all entries, or 0 if unlimited.
+@property (nonatomic, assign, readonly) NSUInteger totalCostLimit;
+
+/// The number of entries in the cache.
+@property (atomic, assign, readonly) NSUInteger count;
+
+/// The sum of the costs of all entries in the cache.
+@property (atomic, assign, readonly) NSUInteger totalCost;
+
+/// The number of lookups which found an entry.
+@property (atomic, assign, readonly) NSUInteger hitCount;
+
+/// The number of lookups which did not find an entry.
+@property (atomic, assign, readonly) NSUInteger missCount;
+
+/// Returns the object associated with `key` and marks it as most recently
+/// used, or nil if there is no such entry.
+- (id)objectForKey:(id)key;
+
+/// Associates `object` with `key`, replacing any existing entry, and then
+/// evicts least recently used entries until the receiver is within its limits.
+///
+/// An object whose cost alone exceeds `totalCostLimit` is not stored.
+- (void)setObject:(id)object forKey:(id<NSCopying>)key cost:(NSUInteger)cost;
+
+/// Removes the entry for `key`, if any.
+- (void)removeObjectForKey:(id)key;
+
+/// Removes all entries. Hit and miss counts are left untouched.
+- (void)removeAllObjects;
+
+@end
@@ -0,0 +1,179 @@
+//
+//  MTLLRUCache.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLLRUCache.h"
+
+// A node in the recency list of MTLLRUCache.
+@interface MTLLRUCacheEntry : NSObject {
+@public
+	id _key;
+	id _object;
+	NSUInteger _cost;
+
+	// The entries are owned by the cache's dictionary, so the list links do not
+	// need to retain them.
+	__unsafe_unretained MTLLRUCacheEntry *_previous;
+	__unsafe_unretained MTLLRUCacheEntry *_next;
+}
+
+@end
+
+@implementation MTLLRUCacheEntry
+@end
+
+@interface MTLLRUCache () {
+	// The most and least recently used entries.
+	__unsafe_unretained MTLLRUCacheEntry *_head;
+	__unsafe_unretained MTLLRUCacheEntry *_tail;
+}
+
+// Maps keys to MTLLRUCacheEntry objects. Only accessed while synchronized on
+// the receiver.
+@property (nonatomic, strong, readonly) NSMutableDictionary *entries;
+
+@property (atomic, assign, readwrite) NSUInteger totalCost;
+@property (atomic, assign, readwrite) NSUInteger hitCount;
+@property (atomic, assign, readwrite) NSUInteger missCount;
+
+@end
+
+@implementation MTLLRUCache
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	return [self initWithCountLimit:0 totalCostLimit:0];
+}
+
+- (instancetype)initWithCountLimit:(NSUInteger)countLimit totalCostLimit:(NSUInteger)totalCostLimit {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_countLimit = countLimit;
+	_totalCostLimit = totalCostLimit;
+	_entries = [[NSMutableDictionary alloc] init];
+
+	return self;
+}
+
+#pragma mark Recency List
+
+// Must be called while synchronized on the receiver.
+- (void)unlinkEntry:(MTLLRUCacheEntry *)entry {
+	if (entry->_previous != nil) entry->_previous->_next = entry->_next;
+	if (entry->_next != nil) entry->_next->_previous = entry->_previous;
+	if (_head == entry) _head = entry->_next;
+	if (_tail == entry) _tail = entry->_previous;
+
+	entry->_previous = nil;
+	entry->_next = nil;
+}
+
+// Must be called while synchronized on the receiver.
+- (void)insertEntryAtHead:(MTLLRUCacheEntry *)entry {
+	entry->_next = _head;
+	if (_head != nil) _head->_previous = entry;
+
+	_head = entry;
+	if (_tail == nil) _tail = entry;
+}
+
+// Must be called while synchronized on the receiver.
+- (void)removeEntry:(MTLLRUCacheEntry *)entry {
+	id key = entry->_key;
+
+	[self unlinkEntry:entry];
+	self.totalCost -= entry->_cost;
+
+	// This may deallocate the entry, so it must happen last.
+	[self.entries removeObjectForKey:key];
+}
+
+// Must be called while synchronized on the receiver.
+- (void)evictIfNeeded {
+	while (_tail != nil) {
+		BOOL overCount = (self.countLimit > 0 && self.entries.count > self.countLimit);
+		BOOL overCost = (self.totalCostLimit > 0 && self.totalCost > self.totalCostLimit);
+		if (!overCount && !overCost) break;
+
+		[self removeEntry:_tail];
+	}
+}
+
+#pragma mark Caching
+
+- (NSUInteger)count {
+	@synchronized (self) {
+		return self.entries.count;
+	}
+}
+
+- (id)objectForKey:(id)key {
+	if (key == nil) return nil;
+
+	@synchronized (self) {
+		MTLLRUCacheEntry *entry = self.entries[key];
+		if (entry == nil) {
+			self.missCount++;
+			return nil;
+		}
+
+		self.hitCount++;
+
+		if (_head != entry) {
+			[self unlinkEntry:entry];
+			[self insertEntryAtHead:entry];
+		}
+
+		return entry->_object;
+	}
+}
+
+- (void)setObject:(id)object forKey:(id<NSCopying>)key cost:(NSUInteger)cost {
+	NSParameterAssert(object != nil);
+	NSParameterAssert(key != nil);
+
+	@synchronized (self) {
+		MTLLRUCacheEntry *existing = self.entries[key];
+		if (existing != nil) [self removeEntry:existing];
+
+		if (self.totalCostLimit > 0 && cost > self.totalCostLimit) return;
+
+		MTLLRUCacheEntry *entry = [[MTLLRUCacheEntry alloc] init];
+		entry->_key = [(id)key copy];
+		entry->_object = object;
+		entry->_cost = cost;
+
+		self.entries[entry->_key] = entry;
+		[self insertEntryAtHead:entry];
+		self.totalCost += cost;
+
+		[self evictIfNeeded];
+	}
+}
+
+- (void)removeObjectForKey:(id)key {
+	if (key == nil) return;
+
+	@synchronized (self) {
+		MTLLRUCacheEntry *entry = self.entries[key];
+		if (entry != nil) [self removeEntry:entry];
+	}
+}
+
+- (void)removeAllObjects {
+	@synchronized (self) {
+		_head = nil;
+		_tail = nil;
+
+		[self.entries removeAllObjects];
+		self.totalCost = 0;
+	}
+}
+
+@end
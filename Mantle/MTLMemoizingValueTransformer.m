@@ -0,0 +1,245 @@
+//
+//  MTLMemoizingValueTransformer.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLMemoizingValueTransformer.h"
+#import "MTLLRUCache.h"
+#import "MTLMetricsRecording.h"
+
+//
+// Any MTLMemoizingValueTransformer wrapping a reversible transformer.
+// Necessary because +allowsReverseTransformation is a class method.
+//
+@interface MTLReversibleMemoizingValueTransformer : MTLMemoizingValueTransformer
+@end
+
+// Keys the caches by NSNumber inputs, which are only equal to numbers of the
+// same kind, so that the results for @YES, @1 and @1.0 are kept apart.
+@interface MTLMemoizedNumberKey : NSObject <NSCopying>
+
+- (instancetype)initWithNumber:(NSNumber *)number;
+
+@end
+
+@interface MTLMemoizingValueTransformer ()
+
+@property (nonatomic, strong, readonly) MTLLRUCache *forwardCache;
+@property (nonatomic, strong, readonly) MTLLRUCache *reverseCache;
+
+@end
+
+// Stands in for nil results in the caches.
+static id MTLMemoizedNilValue(void) {
+	static id nilValue;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		nilValue = [[NSObject alloc] init];
+	});
+
+	return nilValue;
+}
+
+// Returns the key under which the result for `value` is cached, or nil if
+// `value` should not be memoized.
+//
+// Only strings and numbers are memoized. Other values, like collections, are
+// expensive to hash and compare, and often hash poorly.
+static id MTLMemoizationKeyForValue(id value) {
+	if ([value isKindOfClass:NSString.class]) return value;
+	if ([value isKindOfClass:NSNumber.class]) return [[MTLMemoizedNumberKey alloc] initWithNumber:value];
+
+	return nil;
+}
+
+// Returns whether `result` can be handed to every caller transforming an equal
+// value, which is only the case if it is immutable.
+static BOOL MTLMemoizedResultIsShareable(id result) {
+	if (result == nil) return YES;
+	if (![result conformsToProtocol:@protocol(NSCopying)]) return NO;
+
+	// Immutable values, including models whose class returns YES from
+	// +instancesAreImmutable, return themselves from -copy.
+	return [result copy] == result;
+}
+
+// Looks up `value` in `cache`, or transforms it using `block` and caches the
+// result if the transformation succeeded and the result is immutable.
+static id MTLMemoizedTransformedValue(MTLLRUCache *cache, id value, BOOL *success, NSError **error, id (^block)(id value, BOOL *success, NSError **error)) {
+	id key = (cache != nil ? MTLMemoizationKeyForValue(value) : nil);
+	if (key == nil) return block(value, success, error);
+
+	id cached = [cache objectForKey:key];
+	if (MTLMetricsEnabled) MTLMetricsRecord(cached != nil ? MTLMetricKindTransformerCacheHit : MTLMetricKindTransformerCacheMiss, Nil, nil, 0, YES, nil);
+
+	if (cached != nil) {
+		if (success != NULL) *success = YES;
+
+		return (cached == MTLMemoizedNilValue() ? nil : cached);
+	}
+
+	BOOL transformationSuccess = YES;
+	id result = block(value, &transformationSuccess, error);
+
+	if (success != NULL) *success = transformationSuccess;
+	if (transformationSuccess && MTLMemoizedResultIsShareable(result)) {
+		[cache setObject:result ?: MTLMemoizedNilValue() forKey:key cost:1];
+	}
+
+	return result;
+}
+
+@implementation MTLMemoizedNumberKey {
+	NSNumber *_number;
+
+	// 'B' for booleans, 'd' for floating-point numbers, and 'q' for integers.
+	char _kind;
+}
+
+- (instancetype)initWithNumber:(NSNumber *)number {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_number = number;
+
+	const char *objCType = number.objCType;
+	if (CFGetTypeID((__bridge CFTypeRef)number) == CFBooleanGetTypeID()) {
+		_kind = 'B';
+	} else if (strcmp(objCType, @encode(double)) == 0 || strcmp(objCType, @encode(float)) == 0) {
+		_kind = 'd';
+	} else {
+		_kind = 'q';
+	}
+
+	return self;
+}
+
+- (instancetype)copyWithZone:(NSZone *)zone {
+	return self;
+}
+
+- (NSUInteger)hash {
+	return _number.hash ^ (NSUInteger)_kind;
+}
+
+- (BOOL)isEqual:(MTLMemoizedNumberKey *)key {
+	if (self == key) return YES;
+	if (![key isKindOfClass:MTLMemoizedNumberKey.class]) return NO;
+
+	return _kind == key->_kind && [_number isEqualToNumber:key->_number];
+}
+
+@end
+
+@implementation MTLMemoizingValueTransformer
+
+#pragma mark Lifecycle
+
++ (instancetype)transformerWithTransformer:(NSValueTransformer *)transformer countLimit:(NSUInteger)countLimit memoizesReverseTransformations:(BOOL)memoizesReverseTransformations {
+	NSParameterAssert(transformer != nil);
+	NSParameterAssert(countLimit > 0);
+
+	Class class = ([transformer.class allowsReverseTransformation] ? MTLReversibleMemoizingValueTransformer.class : MTLMemoizingValueTransformer.class);
+
+	return [[class alloc] initWithTransformer:transformer countLimit:countLimit memoizesReverseTransformations:memoizesReverseTransformations];
+}
+
+- (id)initWithTransformer:(NSValueTransformer *)transformer countLimit:(NSUInteger)countLimit memoizesReverseTransformations:(BOOL)memoizesReverseTransformations {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_transformer = transformer;
+	_countLimit = countLimit;
+	_memoizesReverseTransformations = memoizesReverseTransformations;
+	_forwardCache = [[MTLLRUCache alloc] initWithCountLimit:countLimit totalCostLimit:0];
+
+	if (memoizesReverseTransformations && [transformer.class allowsReverseTransformation]) {
+		_reverseCache = [[MTLLRUCache alloc] initWithCountLimit:countLimit totalCostLimit:0];
+	}
+
+	return self;
+}
+
+#pragma mark Statistics
+
+- (NSUInteger)hitCount {
+	return self.forwardCache.hitCount;
+}
+
+- (NSUInteger)missCount {
+	return self.forwardCache.missCount;
+}
+
+- (NSUInteger)reverseHitCount {
+	return self.reverseCache.hitCount;
+}
+
+- (NSUInteger)reverseMissCount {
+	return self.reverseCache.missCount;
+}
+
+- (void)removeAllCachedValues {
+	[self.forwardCache removeAllObjects];
+	[self.reverseCache removeAllObjects];
+}
+
+#pragma mark NSValueTransformer
+
++ (BOOL)allowsReverseTransformation {
+	return NO;
+}
+
++ (Class)transformedValueClass {
+	return NSObject.class;
+}
+
+- (id)transformedValue:(id)value {
+	return [self transformedValue:value success:NULL error:NULL];
+}
+
+#pragma mark MTLTransformerErrorHandling
+
+- (id)transformedValue:(id)value success:(BOOL *)success error:(NSError * __autoreleasing *)error {
+	NSValueTransformer *transformer = self.transformer;
+
+	return MTLMemoizedTransformedValue(self.forwardCache, value, success, error, ^ id (id value, BOOL *success, NSError **error) {
+		if ([transformer respondsToSelector:@selector(transformedValue:success:error:)]) {
+			return [(id<MTLTransformerErrorHandling>)transformer transformedValue:value success:success error:error];
+		} else {
+			return [transformer transformedValue:value];
+		}
+	});
+}
+
+@end
+
+@implementation MTLReversibleMemoizingValueTransformer
+
+#pragma mark NSValueTransformer
+
++ (BOOL)allowsReverseTransformation {
+	return YES;
+}
+
+- (id)reverseTransformedValue:(id)value {
+	return [self reverseTransformedValue:value success:NULL error:NULL];
+}
+
+#pragma mark MTLTransformerErrorHandling
+
+- (id)reverseTransformedValue:(id)value success:(BOOL *)success error:(NSError * __autoreleasing *)error {
+	NSValueTransformer *transformer = self.transformer;
+
+	return MTLMemoizedTransformedValue(self.reverseCache, value, success, error, ^ id (id value, BOOL *success, NSError **error) {
+		if ([transformer respondsToSelector:@selector(reverseTransformedValue:success:error:)]) {
+			return [(id<MTLTransformerErrorHandling>)transformer reverseTransformedValue:value success:success error:error];
+		} else {
+			return [transformer reverseTransformedValue:value];
+		}
+	});
+}
+
+@end
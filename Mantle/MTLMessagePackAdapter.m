@@ -0,0 +1,142 @@
+//
+//  MTLMessagePackAdapter.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <objc/runtime.h>
+
+#import "MTLEXTRuntimeExtensions.h"
+#import "MTLEXTScope.h"
+#import "MTLMessagePackAdapter.h"
+#import "MTLMessagePackSerialization.h"
+#import "MTLModel.h"
+#import "MTLTransformerErrorHandling.h"
+#import "MTLValueTransformer.h"
+
+@interface MTLJSONAdapter (MTLMessagePackAdapterPrivate)
+
+// Implemented by MTLJSONAdapter.
+@property (nonatomic, strong, readonly) Class modelClass;
++ (NSDictionary *)valueTransformersForModelClass:(Class)modelClass;
+- (id)modelFromPayload:(NSData *)payload decodingWithBlock:(id (^)(NSError **error))decode error:(NSError **)error;
+
+@end
+
+// Returns the class of values MessagePack can represent natively for a
+// property, or Nil if the property should only use its JSON transformer.
+static Class MTLMessagePackNativeClassForProperty(objc_property_t property) {
+	mtl_propertyAttributes *attributes = mtl_copyPropertyAttributes(property);
+	@onExit {
+		free(attributes);
+	};
+
+	if (attributes == NULL || *(attributes->type) != *(@encode(id))) return Nil;
+
+	// Numbers need no special treatment, since the default transformers
+	// already pass them through unchanged, and custom transformers (like
+	// mappings of enums to strings) should keep their JSON representation.
+	Class propertyClass = attributes->objectClass;
+	if ([propertyClass isSubclassOfClass:NSDate.class]) return NSDate.class;
+	if ([propertyClass isSubclassOfClass:NSData.class]) return NSData.class;
+
+	return Nil;
+}
+
+// Wraps the JSON transformer of a property whose values MessagePack can
+// represent natively.
+//
+// Native values are passed through in both directions. Other input values are
+// converted using `transformer`, if there is one.
+static NSValueTransformer *MTLMessagePackNativeTransformer(Class nativeClass, NSValueTransformer *transformer) {
+	return [MTLValueTransformer
+		transformerUsingForwardBlock:^ id (id value, BOOL *success, NSError **error) {
+			if (value == nil || [value isKindOfClass:nativeClass] || transformer == nil) return value;
+
+			if ([transformer respondsToSelector:@selector(transformedValue:success:error:)]) {
+				return [(id<MTLTransformerErrorHandling>)transformer transformedValue:value success:success error:error];
+			} else {
+				return [transformer transformedValue:value];
+			}
+		}
+		reverseBlock:^ id (id value, BOOL *success, NSError **error) {
+			return value;
+		}];
+}
+
+@implementation MTLMessagePackAdapter
+
+#pragma mark Convenience methods
+
++ (id)modelOfClass:(Class)modelClass fromMessagePackData:(NSData *)data error:(NSError **)error {
+	MTLMessagePackAdapter *adapter = [[self alloc] initWithModelClass:modelClass];
+
+	return [adapter modelFromMessagePackData:data error:error];
+}
+
++ (NSArray *)modelsOfClass:(Class)modelClass fromMessagePackData:(NSData *)data error:(NSError **)error {
+	if (data == nil) return nil;
+
+	id array = [MTLMessagePackSerialization messagePackObjectWithData:data error:error];
+	if (array == nil) return nil;
+
+	return [self modelsOfClass:modelClass fromJSONArray:array error:error];
+}
+
++ (NSData *)messagePackDataFromModel:(id<MTLJSONSerializing>)model error:(NSError **)error {
+	MTLMessagePackAdapter *adapter = [[self alloc] initWithModelClass:model.class];
+
+	return [adapter messagePackDataFromModel:model error:error];
+}
+
++ (NSData *)messagePackDataFromModels:(NSArray *)models error:(NSError **)error {
+	NSArray *array = [self JSONArrayFromModels:models error:error];
+	if (array == nil) return nil;
+
+	return [MTLMessagePackSerialization dataWithMessagePackObject:array error:error];
+}
+
+#pragma mark Serialization
+
+- (id)modelFromMessagePackData:(NSData *)data error:(NSError **)error {
+	if (data == nil) return nil;
+
+	id (^decode)(NSError **) = ^ id (NSError **error) {
+		id dictionary = [MTLMessagePackSerialization messagePackObjectWithData:data error:error];
+		if (dictionary == nil) return nil;
+
+		// Validates that the object is a dictionary.
+		return [self modelFromJSONDictionary:dictionary error:error];
+	};
+
+	return [self modelFromPayload:data decodingWithBlock:decode error:error];
+}
+
+- (NSData *)messagePackDataFromModel:(id<MTLJSONSerializing>)model error:(NSError **)error {
+	NSDictionary *dictionary = [self JSONDictionaryFromModel:model error:error];
+	if (dictionary == nil) return nil;
+
+	return [MTLMessagePackSerialization dataWithMessagePackObject:dictionary error:error];
+}
+
+#pragma mark MTLJSONAdapter
+
++ (NSDictionary *)valueTransformersForModelClass:(Class)modelClass {
+	NSMutableDictionary *result = [[super valueTransformersForModelClass:modelClass] mutableCopy];
+
+	for (NSString *key in [modelClass propertyKeys]) {
+		objc_property_t property = class_getProperty(modelClass, key.UTF8String);
+		if (property == NULL) continue;
+
+		Class nativeClass = MTLMessagePackNativeClassForProperty(property);
+		if (nativeClass == Nil) continue;
+
+		result[key] = MTLMessagePackNativeTransformer(nativeClass, result[key]);
+	}
+
+	return result;
+}
+
+@end
@@ -0,0 +1,567 @@
+//
+//  MTLMessagePackSerialization.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLMessagePackSerialization.h"
+#import "NSError+MTLLazyDescription.h"
+
+NSString * const MTLMessagePackSerializationErrorDomain = @"MTLMessagePackSerializationErrorDomain";
+const NSInteger MTLMessagePackSerializationErrorUnsupportedType = 1;
+const NSInteger MTLMessagePackSerializationErrorTruncatedData = 2;
+const NSInteger MTLMessagePackSerializationErrorInvalidData = 3;
+
+NSString * const MTLMessagePackSerializationOffsetErrorKey = @"MTLMessagePackSerializationOffset";
+
+// The extension type of timestamps.
+static const uint8_t MTLMessagePackTimestampType = 0xff;
+
+// The deepest nesting of arrays and maps which will be read or written, so that
+// malicious data or cyclic collections cannot exhaust the stack.
+static const NSUInteger MTLMessagePackMaximumDepth = 512;
+
+#pragma mark Writing
+
+static void MTLMessagePackWriteByte(NSMutableData *data, uint8_t byte) {
+	[data appendBytes:&byte length:1];
+}
+
+// Appends the low `byteCount` bytes of `value` in big-endian order.
+static void MTLMessagePackWriteBigEndian(NSMutableData *data, uint64_t value, NSUInteger byteCount) {
+	uint8_t bytes[8];
+	for (NSUInteger index = 0; index < byteCount; index++) {
+		bytes[byteCount - 1 - index] = (uint8_t)(value >> (8 * index));
+	}
+
+	[data appendBytes:bytes length:byteCount];
+}
+
+static void MTLMessagePackWriteTypedInteger(NSMutableData *data, uint8_t type, uint64_t value, NSUInteger byteCount) {
+	MTLMessagePackWriteByte(data, type);
+	MTLMessagePackWriteBigEndian(data, value, byteCount);
+}
+
+// Writes the header of a str, bin, array or map with `length` elements.
+//
+// fixType  - The type byte of the fixed-length variant, or 0 if there is none.
+// fixLimit - The number of elements the fixed-length variant can hold.
+// types    - The type bytes of the 8, 16 and 32 bit variants. The 8 bit
+//            variant is skipped if its type is 0.
+//
+// Returns NO if `length` cannot be represented.
+static BOOL MTLMessagePackWriteLength(NSMutableData *data, NSUInteger length, uint8_t fixType, NSUInteger fixLimit, const uint8_t types[3]) {
+	if (fixType != 0 && length < fixLimit) {
+		MTLMessagePackWriteByte(data, fixType | (uint8_t)length);
+	} else if (types[0] != 0 && length <= UINT8_MAX) {
+		MTLMessagePackWriteTypedInteger(data, types[0], length, 1);
+	} else if (length <= UINT16_MAX) {
+		MTLMessagePackWriteTypedInteger(data, types[1], length, 2);
+	} else if (length <= UINT32_MAX) {
+		MTLMessagePackWriteTypedInteger(data, types[2], length, 4);
+	} else {
+		return NO;
+	}
+
+	return YES;
+}
+
+static void MTLMessagePackWriteInteger(NSMutableData *data, long long value) {
+	if (value >= 0) {
+		if (value < 128) {
+			MTLMessagePackWriteByte(data, (uint8_t)value);
+		} else if (value <= UINT8_MAX) {
+			MTLMessagePackWriteTypedInteger(data, 0xcc, (uint64_t)value, 1);
+		} else if (value <= UINT16_MAX) {
+			MTLMessagePackWriteTypedInteger(data, 0xcd, (uint64_t)value, 2);
+		} else if (value <= UINT32_MAX) {
+			MTLMessagePackWriteTypedInteger(data, 0xce, (uint64_t)value, 4);
+		} else {
+			MTLMessagePackWriteTypedInteger(data, 0xcf, (uint64_t)value, 8);
+		}
+	} else {
+		if (value >= -32) {
+			MTLMessagePackWriteByte(data, (uint8_t)(int8_t)value);
+		} else if (value >= INT8_MIN) {
+			MTLMessagePackWriteTypedInteger(data, 0xd0, (uint64_t)value, 1);
+		} else if (value >= INT16_MIN) {
+			MTLMessagePackWriteTypedInteger(data, 0xd1, (uint64_t)value, 2);
+		} else if (value >= INT32_MIN) {
+			MTLMessagePackWriteTypedInteger(data, 0xd2, (uint64_t)value, 4);
+		} else {
+			MTLMessagePackWriteTypedInteger(data, 0xd3, (uint64_t)value, 8);
+		}
+	}
+}
+
+static void MTLMessagePackWriteNumber(NSMutableData *data, NSNumber *number) {
+	if (CFGetTypeID((__bridge CFTypeRef)number) == CFBooleanGetTypeID()) {
+		MTLMessagePackWriteByte(data, number.boolValue ? 0xc3 : 0xc2);
+		return;
+	}
+
+	const char *objCType = number.objCType;
+	if (strcmp(objCType, @encode(float)) == 0) {
+		float value = number.floatValue;
+		uint32_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+
+		MTLMessagePackWriteTypedInteger(data, 0xca, bits, 4);
+		return;
+	}
+
+	if (strcmp(objCType, @encode(double)) == 0) {
+		double value = number.doubleValue;
+		uint64_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+
+		MTLMessagePackWriteTypedInteger(data, 0xcb, bits, 8);
+		return;
+	}
+
+	if (strcmp(objCType, @encode(unsigned long long)) == 0 && number.unsignedLongLongValue > INT64_MAX) {
+		MTLMessagePackWriteTypedInteger(data, 0xcf, number.unsignedLongLongValue, 8);
+		return;
+	}
+
+	MTLMessagePackWriteInteger(data, number.longLongValue);
+}
+
+// Writes a timestamp extension, using the smallest of the 32, 64 and 96 bit
+// formats which can represent `date`.
+//
+// Returns NO if the date is not finite, or too far from 1970 for the 96 bit
+// format.
+static BOOL MTLMessagePackWriteDate(NSMutableData *data, NSDate *date, NSError **error) {
+	NSTimeInterval interval = date.timeIntervalSince1970;
+	double seconds = floor(interval);
+
+	// 2^63 is the first value which does not fit into an int64_t.
+	if (!isfinite(seconds) || seconds < (double)INT64_MIN || seconds >= 9223372036854775808.0) {
+		if (error != NULL) {
+			*error = [NSError mtl_errorWithDomain:MTLMessagePackSerializationErrorDomain code:MTLMessagePackSerializationErrorUnsupportedType descriptionFormat:NSLocalizedString(@"Could not serialize date", @"") failureReasonFormat:NSLocalizedString(@"%@ seconds since 1970 cannot be written as a MessagePack timestamp.", @"") arguments:@[ @(interval) ] userInfo:nil];
+		}
+
+		return NO;
+	}
+
+	int64_t wholeSeconds = (int64_t)seconds;
+	uint32_t nanoseconds = (uint32_t)MIN(llround((interval - seconds) * NSEC_PER_SEC), (long long)NSEC_PER_SEC - 1);
+
+	if (wholeSeconds >= 0 && (wholeSeconds >> 34) == 0) {
+		if (nanoseconds == 0 && wholeSeconds <= UINT32_MAX) {
+			MTLMessagePackWriteTypedInteger(data, 0xd6, MTLMessagePackTimestampType, 1);
+			MTLMessagePackWriteBigEndian(data, (uint64_t)wholeSeconds, 4);
+		} else {
+			MTLMessagePackWriteTypedInteger(data, 0xd7, MTLMessagePackTimestampType, 1);
+			MTLMessagePackWriteBigEndian(data, ((uint64_t)nanoseconds << 34) | (uint64_t)wholeSeconds, 8);
+		}
+	} else {
+		MTLMessagePackWriteTypedInteger(data, 0xc7, 12, 1);
+		MTLMessagePackWriteByte(data, MTLMessagePackTimestampType);
+		MTLMessagePackWriteBigEndian(data, nanoseconds, 4);
+		MTLMessagePackWriteBigEndian(data, (uint64_t)wholeSeconds, 8);
+	}
+
+	return YES;
+}
+
+static NSError *MTLMessagePackUnsupportedTypeError(id object) {
+	return [NSError mtl_errorWithDomain:MTLMessagePackSerializationErrorDomain code:MTLMessagePackSerializationErrorUnsupportedType descriptionFormat:NSLocalizedString(@"Could not serialize object", @"") failureReasonFormat:NSLocalizedString(@"%@ cannot be written as MessagePack.", @"") arguments:@[ NSStringFromClass([object class]) ] userInfo:nil];
+}
+
+static BOOL MTLMessagePackWriteObject(NSMutableData *data, id object, NSUInteger depth, NSError **error) {
+	if (depth > MTLMessagePackMaximumDepth) {
+		if (error != NULL) {
+			*error = [NSError mtl_errorWithDomain:MTLMessagePackSerializationErrorDomain code:MTLMessagePackSerializationErrorUnsupportedType descriptionFormat:NSLocalizedString(@"Could not serialize object", @"") failureReasonFormat:NSLocalizedString(@"Collections are nested more than %@ levels deep.", @"") arguments:@[ @(MTLMessagePackMaximumDepth) ] userInfo:nil];
+		}
+
+		return NO;
+	}
+
+	if (object == nil || [object isKindOfClass:NSNull.class]) {
+		MTLMessagePackWriteByte(data, 0xc0);
+		return YES;
+	}
+
+	if ([object isKindOfClass:NSNumber.class]) {
+		MTLMessagePackWriteNumber(data, object);
+		return YES;
+	}
+
+	if ([object isKindOfClass:NSString.class]) {
+		NSString *string = object;
+		NSUInteger length = [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+
+		static const uint8_t types[3] = { 0xd9, 0xda, 0xdb };
+		if (!MTLMessagePackWriteLength(data, length, 0xa0, 32, types)) {
+			if (error != NULL) *error = MTLMessagePackUnsupportedTypeError(object);
+			return NO;
+		}
+
+		NSUInteger offset = data.length;
+		data.length += length;
+
+		// Strings with unpaired surrogates have no UTF-8 representation.
+		NSUInteger usedLength = 0;
+		NSRange remainingRange = NSMakeRange(0, 0);
+		BOOL converted = [string getBytes:(uint8_t *)data.mutableBytes + offset maxLength:length usedLength:&usedLength encoding:NSUTF8StringEncoding options:0 range:NSMakeRange(0, string.length) remainingRange:&remainingRange];
+		if ((!converted && string.length > 0) || usedLength != length || remainingRange.length > 0) {
+			if (error != NULL) {
+				*error = [NSError mtl_errorWithDomain:MTLMessagePackSerializationErrorDomain code:MTLMessagePackSerializationErrorUnsupportedType descriptionFormat:NSLocalizedString(@"Could not serialize string", @"") failureReasonFormat:NSLocalizedString(@"The string \"%@\" cannot be converted to UTF-8.", @"") arguments:@[ string ] userInfo:nil];
+			}
+
+			return NO;
+		}
+
+		return YES;
+	}
+
+	if ([object isKindOfClass:NSData.class]) {
+		static const uint8_t types[3] = { 0xc4, 0xc5, 0xc6 };
+		if (!MTLMessagePackWriteLength(data, [object length], 0, 0, types)) {
+			if (error != NULL) *error = MTLMessagePackUnsupportedTypeError(object);
+			return NO;
+		}
+
+		[data appendData:object];
+		return YES;
+	}
+
+	if ([object isKindOfClass:NSDate.class]) {
+		return MTLMessagePackWriteDate(data, object, error);
+	}
+
+	if ([object isKindOfClass:NSArray.class]) {
+		static const uint8_t types[3] = { 0, 0xdc, 0xdd };
+		if (!MTLMessagePackWriteLength(data, [object count], 0x90, 16, types)) {
+			if (error != NULL) *error = MTLMessagePackUnsupportedTypeError(object);
+			return NO;
+		}
+
+		for (id element in object) {
+			if (!MTLMessagePackWriteObject(data, element, depth + 1, error)) return NO;
+		}
+
+		return YES;
+	}
+
+	if ([object isKindOfClass:NSDictionary.class]) {
+		static const uint8_t types[3] = { 0, 0xde, 0xdf };
+		if (!MTLMessagePackWriteLength(data, [object count], 0x80, 16, types)) {
+			if (error != NULL) *error = MTLMessagePackUnsupportedTypeError(object);
+			return NO;
+		}
+
+		__block BOOL success = YES;
+		__block NSError *elementError = nil;
+		[object enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+			NSError *localError = nil;
+			if (!MTLMessagePackWriteObject(data, key, depth + 1, &localError) || !MTLMessagePackWriteObject(data, value, depth + 1, &localError)) {
+				success = NO;
+				elementError = localError;
+				*stop = YES;
+			}
+		}];
+
+		if (!success && error != NULL) *error = elementError;
+		return success;
+	}
+
+	if (error != NULL) *error = MTLMessagePackUnsupportedTypeError(object);
+	return NO;
+}
+
+#pragma mark Reading
+
+// The state of a read from a buffer.
+typedef struct {
+	const uint8_t *bytes;
+	NSUInteger length;
+	NSUInteger offset;
+} MTLMessagePackReader;
+
+static NSError *MTLMessagePackReadError(const MTLMessagePackReader *reader, NSInteger code, NSString *failureReasonFormat) {
+	NSDictionary *userInfo = @{ MTLMessagePackSerializationOffsetErrorKey: @(reader->offset) };
+
+	return [NSError mtl_errorWithDomain:MTLMessagePackSerializationErrorDomain code:code descriptionFormat:NSLocalizedString(@"Could not read MessagePack data", @"") failureReasonFormat:failureReasonFormat arguments:@[ @(reader->offset) ] userInfo:userInfo];
+}
+
+// Returns a pointer to the next `count` bytes and advances past them, or NULL
+// if the data is too short.
+static const uint8_t *MTLMessagePackReadBytes(MTLMessagePackReader *reader, NSUInteger count, NSError **error) {
+	if (count > reader->length - reader->offset) {
+		if (error != NULL) *error = MTLMessagePackReadError(reader, MTLMessagePackSerializationErrorTruncatedData, NSLocalizedString(@"The data ended unexpectedly at offset %@.", @""));
+		return NULL;
+	}
+
+	const uint8_t *bytes = reader->bytes + reader->offset;
+	reader->offset += count;
+
+	return bytes;
+}
+
+static BOOL MTLMessagePackReadBigEndian(MTLMessagePackReader *reader, NSUInteger byteCount, uint64_t *value, NSError **error) {
+	const uint8_t *bytes = MTLMessagePackReadBytes(reader, byteCount, error);
+	if (bytes == NULL) return NO;
+
+	uint64_t result = 0;
+	for (NSUInteger index = 0; index < byteCount; index++) {
+		result = (result << 8) | bytes[index];
+	}
+
+	*value = result;
+	return YES;
+}
+
+static id MTLMessagePackReadObject(MTLMessagePackReader *reader, NSUInteger depth, NSError **error);
+
+static id MTLMessagePackReadString(MTLMessagePackReader *reader, NSUInteger length, NSError **error) {
+	const uint8_t *bytes = MTLMessagePackReadBytes(reader, length, error);
+	if (bytes == NULL) return nil;
+
+	NSString *string = [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding];
+	if (string == nil && error != NULL) {
+		*error = MTLMessagePackReadError(reader, MTLMessagePackSerializationErrorInvalidData, NSLocalizedString(@"The string ending at offset %@ is not valid UTF-8.", @""));
+	}
+
+	return string;
+}
+
+static id MTLMessagePackReadBinary(MTLMessagePackReader *reader, NSUInteger length, NSError **error) {
+	const uint8_t *bytes = MTLMessagePackReadBytes(reader, length, error);
+	if (bytes == NULL) return nil;
+
+	return [NSData dataWithBytes:bytes length:length];
+}
+
+static id MTLMessagePackReadArray(MTLMessagePackReader *reader, NSUInteger count, NSUInteger depth, NSError **error) {
+	// Every element takes at least one byte, so a count beyond the remaining
+	// length cannot be valid, and must not be used to size the array.
+	if (count > reader->length - reader->offset) {
+		if (error != NULL) *error = MTLMessagePackReadError(reader, MTLMessagePackSerializationErrorTruncatedData, NSLocalizedString(@"The array at offset %@ is longer than the data.", @""));
+		return nil;
+	}
+
+	NSMutableArray *array = [[NSMutableArray alloc] initWithCapacity:count];
+	for (NSUInteger index = 0; index < count; index++) {
+		id element = MTLMessagePackReadObject(reader, depth + 1, error);
+		if (element == nil) return nil;
+
+		[array addObject:element];
+	}
+
+	return array;
+}
+
+static id MTLMessagePackReadMap(MTLMessagePackReader *reader, NSUInteger count, NSUInteger depth, NSError **error) {
+	if (count > (reader->length - reader->offset) / 2) {
+		if (error != NULL) *error = MTLMessagePackReadError(reader, MTLMessagePackSerializationErrorTruncatedData, NSLocalizedString(@"The map at offset %@ is longer than the data.", @""));
+		return nil;
+	}
+
+	NSMutableDictionary *dictionary = [[NSMutableDictionary alloc] initWithCapacity:count];
+	for (NSUInteger index = 0; index < count; index++) {
+		id key = MTLMessagePackReadObject(reader, depth + 1, error);
+		if (key == nil) return nil;
+
+		id value = MTLMessagePackReadObject(reader, depth + 1, error);
+		if (value == nil) return nil;
+
+		dictionary[key] = value;
+	}
+
+	return dictionary;
+}
+
+static id MTLMessagePackReadExtension(MTLMessagePackReader *reader, NSUInteger length, NSError **error) {
+	const uint8_t *type = MTLMessagePackReadBytes(reader, 1, error);
+	if (type == NULL) return nil;
+
+	if (*type != MTLMessagePackTimestampType) {
+		if (error != NULL) *error = MTLMessagePackReadError(reader, MTLMessagePackSerializationErrorInvalidData, NSLocalizedString(@"The extension type before offset %@ is not supported.", @""));
+		return nil;
+	}
+
+	int64_t seconds = 0;
+	uint64_t nanoseconds = 0;
+	uint64_t value = 0;
+
+	switch (length) {
+		case 4:
+			if (!MTLMessagePackReadBigEndian(reader, 4, &value, error)) return nil;
+			seconds = (int64_t)value;
+			break;
+
+		case 8:
+			if (!MTLMessagePackReadBigEndian(reader, 8, &value, error)) return nil;
+			nanoseconds = value >> 34;
+			seconds = (int64_t)(value & 0x3ffffffffULL);
+			break;
+
+		case 12:
+			if (!MTLMessagePackReadBigEndian(reader, 4, &nanoseconds, error)) return nil;
+			if (!MTLMessagePackReadBigEndian(reader, 8, &value, error)) return nil;
+			seconds = (int64_t)value;
+			break;
+
+		default:
+			if (error != NULL) *error = MTLMessagePackReadError(reader, MTLMessagePackSerializationErrorInvalidData, NSLocalizedString(@"The timestamp before offset %@ has an invalid length.", @""));
+			return nil;
+	}
+
+	if (nanoseconds >= NSEC_PER_SEC) {
+		if (error != NULL) *error = MTLMessagePackReadError(reader, MTLMessagePackSerializationErrorInvalidData, NSLocalizedString(@"The timestamp before offset %@ has too many nanoseconds.", @""));
+		return nil;
+	}
+
+	return [NSDate dateWithTimeIntervalSince1970:(NSTimeInterval)seconds + (NSTimeInterval)nanoseconds / NSEC_PER_SEC];
+}
+
+static id MTLMessagePackReadObject(MTLMessagePackReader *reader, NSUInteger depth, NSError **error) {
+	if (depth > MTLMessagePackMaximumDepth) {
+		if (error != NULL) *error = MTLMessagePackReadError(reader, MTLMessagePackSerializationErrorInvalidData, NSLocalizedString(@"Collections are nested too deeply at offset %@.", @""));
+		return nil;
+	}
+
+	const uint8_t *typePointer = MTLMessagePackReadBytes(reader, 1, error);
+	if (typePointer == NULL) return nil;
+
+	uint8_t type = *typePointer;
+	uint64_t value = 0;
+
+	if (type <= 0x7f) return @(type);
+	if (type >= 0xe0) return @((int8_t)type);
+	if ((type & 0xf0) == 0x80) return MTLMessagePackReadMap(reader, type & 0x0f, depth, error);
+	if ((type & 0xf0) == 0x90) return MTLMessagePackReadArray(reader, type & 0x0f, depth, error);
+	if ((type & 0xe0) == 0xa0) return MTLMessagePackReadString(reader, type & 0x1f, error);
+
+	switch (type) {
+		case 0xc0:
+			return NSNull.null;
+
+		case 0xc2:
+			return @NO;
+
+		case 0xc3:
+			return @YES;
+
+		case 0xc4:
+		case 0xc5:
+		case 0xc6:
+			if (!MTLMessagePackReadBigEndian(reader, 1 << (type - 0xc4), &value, error)) return nil;
+			return MTLMessagePackReadBinary(reader, (NSUInteger)value, error);
+
+		case 0xc7:
+		case 0xc8:
+		case 0xc9:
+			if (!MTLMessagePackReadBigEndian(reader, 1 << (type - 0xc7), &value, error)) return nil;
+			return MTLMessagePackReadExtension(reader, (NSUInteger)value, error);
+
+		case 0xca: {
+			if (!MTLMessagePackReadBigEndian(reader, 4, &value, error)) return nil;
+
+			uint32_t bits = (uint32_t)value;
+			float number;
+			memcpy(&number, &bits, sizeof(number));
+
+			return @(number);
+		}
+
+		case 0xcb: {
+			if (!MTLMessagePackReadBigEndian(reader, 8, &value, error)) return nil;
+
+			double number;
+			memcpy(&number, &value, sizeof(number));
+
+			return @(number);
+		}
+
+		case 0xcc:
+		case 0xcd:
+		case 0xce:
+		case 0xcf:
+			if (!MTLMessagePackReadBigEndian(reader, 1 << (type - 0xcc), &value, error)) return nil;
+			if (value > INT64_MAX) return @((unsigned long long)value);
+
+			return @((long long)value);
+
+		case 0xd0:
+			if (!MTLMessagePackReadBigEndian(reader, 1, &value, error)) return nil;
+			return @((long long)(int8_t)value);
+
+		case 0xd1:
+			if (!MTLMessagePackReadBigEndian(reader, 2, &value, error)) return nil;
+			return @((long long)(int16_t)value);
+
+		case 0xd2:
+			if (!MTLMessagePackReadBigEndian(reader, 4, &value, error)) return nil;
+			return @((long long)(int32_t)value);
+
+		case 0xd3:
+			if (!MTLMessagePackReadBigEndian(reader, 8, &value, error)) return nil;
+			return @((long long)value);
+
+		case 0xd4:
+		case 0xd5:
+		case 0xd6:
+		case 0xd7:
+		case 0xd8:
+			return MTLMessagePackReadExtension(reader, 1 << (type - 0xd4), error);
+
+		case 0xd9:
+		case 0xda:
+		case 0xdb:
+			if (!MTLMessagePackReadBigEndian(reader, 1 << (type - 0xd9), &value, error)) return nil;
+			return MTLMessagePackReadString(reader, (NSUInteger)value, error);
+
+		case 0xdc:
+		case 0xdd:
+			if (!MTLMessagePackReadBigEndian(reader, 2 << (type - 0xdc), &value, error)) return nil;
+			return MTLMessagePackReadArray(reader, (NSUInteger)value, depth, error);
+
+		case 0xde:
+		case 0xdf:
+			if (!MTLMessagePackReadBigEndian(reader, 2 << (type - 0xde), &value, error)) return nil;
+			return MTLMessagePackReadMap(reader, (NSUInteger)value, depth, error);
+
+		default:
+			// 0xc1 is never used.
+			reader->offset--;
+			if (error != NULL) *error = MTLMessagePackReadError(reader, MTLMessagePackSerializationErrorInvalidData, NSLocalizedString(@"The byte at offset %@ is not a valid type.", @""));
+			return nil;
+	}
+}
+
+@implementation MTLMessagePackSerialization
+
++ (NSData *)dataWithMessagePackObject:(id)object error:(NSError **)error {
+	NSMutableData *data = [[NSMutableData alloc] init];
+	if (!MTLMessagePackWriteObject(data, object, 0, error)) return nil;
+
+	return data;
+}
+
++ (id)messagePackObjectWithData:(NSData *)data error:(NSError **)error {
+	NSParameterAssert(data != nil);
+
+	MTLMessagePackReader reader = {
+		.bytes = data.bytes,
+		.length = data.length,
+		.offset = 0,
+	};
+
+	id object = MTLMessagePackReadObject(&reader, 0, error);
+	if (object == nil) return nil;
+
+	if (reader.offset != reader.length) {
+		if (error != NULL) *error = MTLMessagePackReadError(&reader, MTLMessagePackSerializationErrorInvalidData, NSLocalizedString(@"Unexpected data follows the object at offset %@.", @""));
+		return nil;
+	}
+
+	return object;
+}
+
+@end
@@ -0,0 +1,523 @@
+//
+//  MTLMetrics.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <mach/mach_time.h>
+#import <pthread.h>
+#import <stdatomic.h>
+
+#import "MTLMetrics.h"
+#import "MTLMetricsRecording.h"
+
+BOOL MTLMetricsEnabled = NO;
+
+static const NSUInteger MTLMetricKindCount = MTLMetricKindShapeCacheMiss + 1;
+
+@interface MTLMetricStatistics () <NSCopying>
+
+@property (nonatomic, assign, readwrite) NSUInteger count;
+@property (nonatomic, assign, readwrite) NSUInteger failureCount;
+@property (nonatomic, assign, readwrite) uint64_t totalDuration;
+@property (nonatomic, assign, readwrite) uint64_t maximumDuration;
+
+// Adds one measurement.
+- (void)addDuration:(uint64_t)duration success:(BOOL)success;
+
+// Adds all measurements of `statistics`.
+- (void)addStatistics:(MTLMetricStatistics *)statistics;
+
+@end
+
+// All statistics collected for one kind of work. Instances are mutable, and
+// only accessed while holding the lock of the MTLMetricsThreadStorage they
+// belong to, while synchronized on MTLMetricsThreadStorages(), or after being
+// copied into a snapshot.
+@interface MTLMetricKindStatistics : NSObject <NSCopying>
+
+@property (nonatomic, strong) MTLMetricStatistics *statistics;
+
+// Maps model classes to MTLMetricStatistics, for work done for a class without
+// a particular property.
+@property (nonatomic, strong) NSMutableDictionary *statisticsByModelClass;
+
+// Maps model classes to dictionaries, which map property keys to
+// MTLMetricStatistics.
+@property (nonatomic, strong) NSMutableDictionary *statisticsByModelClassAndPropertyKey;
+
+// Maps error domains to dictionaries, which map NSNumber codes to NSNumber
+// counts.
+@property (nonatomic, strong) NSMutableDictionary *errorCounts;
+
+// Adds one measurement, as described by MTLMetricsRecord().
+- (void)addDuration:(uint64_t)duration modelClass:(Class)modelClass propertyKey:(NSString *)propertyKey success:(BOOL)success error:(NSError *)error;
+
+// Adds all measurements of `kindStatistics`.
+- (void)addKindStatistics:(MTLMetricKindStatistics *)kindStatistics;
+
+@end
+
+// The statistics recorded by one thread.
+//
+// Only the owning thread records into them, so taking `_lock` is uncontended
+// except while a snapshot or reset reads them from another thread.
+@interface MTLMetricsThreadStorage : NSObject {
+@public
+	pthread_mutex_t _lock;
+}
+
+// One MTLMetricKindStatistics per MTLMetricKind, indexed by kind.
+@property (nonatomic, strong, readonly) NSMutableArray *kindStatistics;
+
+// Replaces all statistics with empty ones. The caller must hold `_lock`.
+- (void)reset;
+
+@end
+
+@interface MTLMetricsSnapshot ()
+
+- (instancetype)initWithKindStatistics:(NSArray *)kindStatistics;
+
+// One MTLMetricKindStatistics per MTLMetricKind, indexed by kind.
+@property (nonatomic, copy, readonly) NSArray *kindStatistics;
+
+@end
+
+// Returns one empty MTLMetricKindStatistics per MTLMetricKind.
+static NSMutableArray *MTLMetricsEmptyKindStatistics(void) {
+	NSMutableArray *kindStatistics = [[NSMutableArray alloc] initWithCapacity:MTLMetricKindCount];
+	for (NSUInteger kind = 0; kind < MTLMetricKindCount; kind++) {
+		[kindStatistics addObject:[[MTLMetricKindStatistics alloc] init]];
+	}
+
+	return kindStatistics;
+}
+
+// The statistics of threads which have exited since the last reset. Only
+// accessed while synchronized on MTLMetricsThreadStorages().
+static NSMutableArray *MTLMetricsExitedThreadStatistics;
+
+// The added sinks. Replaced rather than mutated, and only accessed while
+// synchronized on MTLMetricsThreadStorages().
+static NSArray *MTLMetricsSinks;
+
+// The number of added sinks, so that recording can skip taking the lock when
+// there are none.
+static _Atomic(NSUInteger) MTLMetricsSinkCount;
+
+// Owns a +1 reference to the MTLMetricsThreadStorage of the current thread.
+static pthread_key_t MTLMetricsThreadStorageKey;
+
+// Folds the statistics of an exiting thread into
+// MTLMetricsExitedThreadStatistics.
+static void MTLMetricsThreadStorageDestructor(void *value);
+
+// Contains the MTLMetricsThreadStorage of every live thread which has recorded
+// metrics, and is used as the lock for all state shared between threads.
+static NSMutableArray *MTLMetricsThreadStorages(void) {
+	static NSMutableArray *threadStorages;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		threadStorages = [[NSMutableArray alloc] init];
+		MTLMetricsExitedThreadStatistics = MTLMetricsEmptyKindStatistics();
+		pthread_key_create(&MTLMetricsThreadStorageKey, MTLMetricsThreadStorageDestructor);
+	});
+
+	return threadStorages;
+}
+
+static void MTLMetricsThreadStorageDestructor(void *value) {
+	@autoreleasepool {
+		MTLMetricsThreadStorage *threadStorage = CFBridgingRelease(value);
+		NSMutableArray *threadStorages = MTLMetricsThreadStorages();
+
+		@synchronized (threadStorages) {
+			pthread_mutex_lock(&threadStorage->_lock);
+			for (NSUInteger kind = 0; kind < MTLMetricKindCount; kind++) {
+				[MTLMetricsExitedThreadStatistics[kind] addKindStatistics:threadStorage.kindStatistics[kind]];
+			}
+			pthread_mutex_unlock(&threadStorage->_lock);
+
+			[threadStorages removeObjectIdenticalTo:threadStorage];
+		}
+	}
+}
+
+// Returns the statistics of the current thread, creating them if needed.
+static MTLMetricsThreadStorage *MTLMetricsCurrentThreadStorage(void) {
+	NSMutableArray *threadStorages = MTLMetricsThreadStorages();
+
+	void *value = pthread_getspecific(MTLMetricsThreadStorageKey);
+	if (value != NULL) return (__bridge MTLMetricsThreadStorage *)value;
+
+	MTLMetricsThreadStorage *threadStorage = [[MTLMetricsThreadStorage alloc] init];
+	@synchronized (threadStorages) {
+		[threadStorages addObject:threadStorage];
+	}
+
+	pthread_setspecific(MTLMetricsThreadStorageKey, CFBridgingRetain(threadStorage));
+	return threadStorage;
+}
+
+uint64_t MTLMetricsCurrentTime(void) {
+	static mach_timebase_info_data_t timebase;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		mach_timebase_info(&timebase);
+	});
+
+	return mach_absolute_time() * timebase.numer / timebase.denom;
+}
+
+void MTLMetricsRecord(MTLMetricKind kind, Class modelClass, NSString *propertyKey, uint64_t startTime, BOOL success, NSError *error) {
+	NSCParameterAssert(kind < MTLMetricKindCount);
+
+	uint64_t duration = (startTime != 0 ? MTLMetricsCurrentTime() - startTime : 0);
+
+	// Only the first measurement of a model class or property on each thread
+	// allocates, and the lock is not shared with other recording threads.
+	MTLMetricsThreadStorage *threadStorage = MTLMetricsCurrentThreadStorage();
+	pthread_mutex_lock(&threadStorage->_lock);
+	[threadStorage.kindStatistics[kind] addDuration:duration modelClass:modelClass propertyKey:propertyKey success:success error:error];
+	pthread_mutex_unlock(&threadStorage->_lock);
+
+	if (atomic_load_explicit(&MTLMetricsSinkCount, memory_order_relaxed) == 0) return;
+
+	NSArray *sinks = nil;
+	@synchronized (MTLMetricsThreadStorages()) {
+		sinks = MTLMetricsSinks;
+	}
+
+	for (id<MTLMetricsSink> sink in sinks) {
+		[sink recordMetricOfKind:kind modelClass:modelClass propertyKey:propertyKey duration:duration success:success error:error];
+	}
+}
+
+@implementation MTLMetrics
+
+#pragma mark Configuration
+
++ (BOOL)isEnabled {
+	return MTLMetricsEnabled;
+}
+
++ (void)setEnabled:(BOOL)enabled {
+	MTLMetricsEnabled = enabled;
+}
+
++ (void)addSink:(id<MTLMetricsSink>)sink {
+	NSParameterAssert(sink != nil);
+
+	@synchronized (MTLMetricsThreadStorages()) {
+		MTLMetricsSinks = [MTLMetricsSinks ?: @[] arrayByAddingObject:sink];
+		atomic_store_explicit(&MTLMetricsSinkCount, MTLMetricsSinks.count, memory_order_relaxed);
+	}
+}
+
++ (void)removeSink:(id<MTLMetricsSink>)sink {
+	if (sink == nil) return;
+
+	@synchronized (MTLMetricsThreadStorages()) {
+		NSMutableArray *sinks = [MTLMetricsSinks mutableCopy];
+		[sinks removeObjectIdenticalTo:sink];
+
+		MTLMetricsSinks = [sinks copy];
+		atomic_store_explicit(&MTLMetricsSinkCount, MTLMetricsSinks.count, memory_order_relaxed);
+	}
+}
+
+#pragma mark Statistics
+
++ (MTLMetricsSnapshot *)snapshot {
+	NSMutableArray *threadStorages = MTLMetricsThreadStorages();
+
+	@synchronized (threadStorages) {
+		NSArray *kindStatistics = [[NSArray alloc] initWithArray:MTLMetricsExitedThreadStatistics copyItems:YES];
+
+		for (MTLMetricsThreadStorage *threadStorage in threadStorages) {
+			pthread_mutex_lock(&threadStorage->_lock);
+			for (NSUInteger kind = 0; kind < MTLMetricKindCount; kind++) {
+				[kindStatistics[kind] addKindStatistics:threadStorage.kindStatistics[kind]];
+			}
+			pthread_mutex_unlock(&threadStorage->_lock);
+		}
+
+		return [[MTLMetricsSnapshot alloc] initWithKindStatistics:kindStatistics];
+	}
+}
+
++ (void)reset {
+	NSMutableArray *threadStorages = MTLMetricsThreadStorages();
+
+	@synchronized (threadStorages) {
+		MTLMetricsExitedThreadStatistics = MTLMetricsEmptyKindStatistics();
+
+		for (MTLMetricsThreadStorage *threadStorage in threadStorages) {
+			pthread_mutex_lock(&threadStorage->_lock);
+			[threadStorage reset];
+			pthread_mutex_unlock(&threadStorage->_lock);
+		}
+	}
+}
+
+@end
+
+@implementation MTLMetricStatistics
+
+- (void)addDuration:(uint64_t)duration success:(BOOL)success {
+	self.count++;
+	if (!success) self.failureCount++;
+
+	self.totalDuration += duration;
+	self.maximumDuration = MAX(self.maximumDuration, duration);
+}
+
+- (void)addStatistics:(MTLMetricStatistics *)statistics {
+	self.count += statistics.count;
+	self.failureCount += statistics.failureCount;
+	self.totalDuration += statistics.totalDuration;
+	self.maximumDuration = MAX(self.maximumDuration, statistics.maximumDuration);
+}
+
+#pragma mark NSCopying
+
+- (instancetype)copyWithZone:(NSZone *)zone {
+	MTLMetricStatistics *copy = [[self.class allocWithZone:zone] init];
+	[copy addStatistics:self];
+
+	return copy;
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> count: %lu, failures: %lu, total: %llu ns, maximum: %llu ns", self.class, self, (unsigned long)self.count, (unsigned long)self.failureCount, self.totalDuration, self.maximumDuration];
+}
+
+@end
+
+@implementation MTLMetricKindStatistics
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_statistics = [[MTLMetricStatistics alloc] init];
+	_statisticsByModelClass = [[NSMutableDictionary alloc] init];
+	_statisticsByModelClassAndPropertyKey = [[NSMutableDictionary alloc] init];
+	_errorCounts = [[NSMutableDictionary alloc] init];
+
+	return self;
+}
+
+#pragma mark Recording
+
+- (void)addDuration:(uint64_t)duration modelClass:(Class)modelClass propertyKey:(NSString *)propertyKey success:(BOOL)success error:(NSError *)error {
+	[self.statistics addDuration:duration success:success];
+
+	if (modelClass != Nil) {
+		id<NSCopying> classKey = (id<NSCopying>)modelClass;
+
+		if (propertyKey != nil) {
+			NSMutableDictionary *statisticsByPropertyKey = self.statisticsByModelClassAndPropertyKey[classKey];
+			if (statisticsByPropertyKey == nil) {
+				statisticsByPropertyKey = [[NSMutableDictionary alloc] init];
+				self.statisticsByModelClassAndPropertyKey[classKey] = statisticsByPropertyKey;
+			}
+
+			MTLMetricStatistics *statistics = statisticsByPropertyKey[propertyKey];
+			if (statistics == nil) {
+				statistics = [[MTLMetricStatistics alloc] init];
+				statisticsByPropertyKey[propertyKey] = statistics;
+			}
+
+			[statistics addDuration:duration success:success];
+		} else {
+			MTLMetricStatistics *statistics = self.statisticsByModelClass[classKey];
+			if (statistics == nil) {
+				statistics = [[MTLMetricStatistics alloc] init];
+				self.statisticsByModelClass[classKey] = statistics;
+			}
+
+			[statistics addDuration:duration success:success];
+		}
+	}
+
+	if (error != nil) {
+		[self addErrorCount:1 domain:error.domain code:@(error.code)];
+	}
+}
+
+- (void)addKindStatistics:(MTLMetricKindStatistics *)kindStatistics {
+	[self.statistics addStatistics:kindStatistics.statistics];
+
+	[kindStatistics.statisticsByModelClass enumerateKeysAndObjectsUsingBlock:^(id<NSCopying> classKey, MTLMetricStatistics *statistics, BOOL *stop) {
+		MTLMetricStatistics *existingStatistics = self.statisticsByModelClass[classKey];
+		if (existingStatistics == nil) {
+			self.statisticsByModelClass[classKey] = [statistics copy];
+		} else {
+			[existingStatistics addStatistics:statistics];
+		}
+	}];
+
+	[kindStatistics.statisticsByModelClassAndPropertyKey enumerateKeysAndObjectsUsingBlock:^(id<NSCopying> classKey, NSDictionary *statisticsByPropertyKey, BOOL *stop) {
+		NSMutableDictionary *existingStatisticsByPropertyKey = self.statisticsByModelClassAndPropertyKey[classKey];
+		if (existingStatisticsByPropertyKey == nil) {
+			self.statisticsByModelClassAndPropertyKey[classKey] = [[NSMutableDictionary alloc] initWithDictionary:statisticsByPropertyKey copyItems:YES];
+			return;
+		}
+
+		[statisticsByPropertyKey enumerateKeysAndObjectsUsingBlock:^(NSString *propertyKey, MTLMetricStatistics *statistics, BOOL *stop) {
+			MTLMetricStatistics *existingStatistics = existingStatisticsByPropertyKey[propertyKey];
+			if (existingStatistics == nil) {
+				existingStatisticsByPropertyKey[propertyKey] = [statistics copy];
+			} else {
+				[existingStatistics addStatistics:statistics];
+			}
+		}];
+	}];
+
+	[kindStatistics.errorCounts enumerateKeysAndObjectsUsingBlock:^(NSString *domain, NSDictionary *countsByCode, BOOL *stop) {
+		[countsByCode enumerateKeysAndObjectsUsingBlock:^(NSNumber *code, NSNumber *count, BOOL *stop) {
+			[self addErrorCount:count.unsignedIntegerValue domain:domain code:code];
+		}];
+	}];
+}
+
+- (void)addErrorCount:(NSUInteger)count domain:(NSString *)domain code:(NSNumber *)code {
+	NSMutableDictionary *countsByCode = self.errorCounts[domain];
+	if (countsByCode == nil) {
+		countsByCode = [[NSMutableDictionary alloc] init];
+		self.errorCounts[domain] = countsByCode;
+	}
+
+	countsByCode[code] = @([countsByCode[code] unsignedIntegerValue] + count);
+}
+
+#pragma mark NSCopying
+
+- (instancetype)copyWithZone:(NSZone *)zone {
+	MTLMetricKindStatistics *copy = [[self.class allocWithZone:zone] init];
+	copy.statistics = [self.statistics copy];
+	copy.statisticsByModelClass = [[NSMutableDictionary alloc] initWithDictionary:self.statisticsByModelClass copyItems:YES];
+
+	[self.statisticsByModelClassAndPropertyKey enumerateKeysAndObjectsUsingBlock:^(id<NSCopying> modelClass, NSDictionary *statisticsByPropertyKey, BOOL *stop) {
+		copy.statisticsByModelClassAndPropertyKey[modelClass] = [[NSMutableDictionary alloc] initWithDictionary:statisticsByPropertyKey copyItems:YES];
+	}];
+
+	[self.errorCounts enumerateKeysAndObjectsUsingBlock:^(NSString *domain, NSDictionary *countsByCode, BOOL *stop) {
+		copy.errorCounts[domain] = [countsByCode mutableCopy];
+	}];
+
+	return copy;
+}
+
+@end
+
+@implementation MTLMetricsThreadStorage
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	pthread_mutex_init(&_lock, NULL);
+	_kindStatistics = MTLMetricsEmptyKindStatistics();
+
+	return self;
+}
+
+- (void)dealloc {
+	pthread_mutex_destroy(&_lock);
+}
+
+#pragma mark Resetting
+
+- (void)reset {
+	for (NSUInteger kind = 0; kind < MTLMetricKindCount; kind++) {
+		self.kindStatistics[kind] = [[MTLMetricKindStatistics alloc] init];
+	}
+}
+
+@end
+
+@implementation MTLMetricsSnapshot
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithKindStatistics:(NSArray *)kindStatistics {
+	NSParameterAssert(kindStatistics.count == MTLMetricKindCount);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_kindStatistics = [kindStatistics copy];
+
+	NSMutableSet *modelClasses = [NSMutableSet set];
+	for (MTLMetricKindStatistics *statistics in _kindStatistics) {
+		[modelClasses addObjectsFromArray:statistics.statisticsByModelClass.allKeys];
+		[modelClasses addObjectsFromArray:statistics.statisticsByModelClassAndPropertyKey.allKeys];
+	}
+
+	_modelClasses = [modelClasses copy];
+
+	return self;
+}
+
+#pragma mark Statistics
+
+- (MTLMetricStatistics *)statisticsForKind:(MTLMetricKind)kind {
+	NSParameterAssert(kind < MTLMetricKindCount);
+
+	MTLMetricKindStatistics *kindStatistics = self.kindStatistics[kind];
+	return [kindStatistics.statistics copy];
+}
+
+- (MTLMetricStatistics *)statisticsForKind:(MTLMetricKind)kind modelClass:(Class)modelClass {
+	NSParameterAssert(kind < MTLMetricKindCount);
+	NSParameterAssert(modelClass != Nil);
+
+	MTLMetricKindStatistics *kindStatistics = self.kindStatistics[kind];
+	id<NSCopying> classKey = (id<NSCopying>)modelClass;
+
+	MTLMetricStatistics *result = [[MTLMetricStatistics alloc] init];
+	[result addStatistics:kindStatistics.statisticsByModelClass[classKey]];
+
+	for (MTLMetricStatistics *statistics in [kindStatistics.statisticsByModelClassAndPropertyKey[classKey] allValues]) {
+		[result addStatistics:statistics];
+	}
+
+	return result;
+}
+
+- (MTLMetricStatistics *)statisticsForKind:(MTLMetricKind)kind modelClass:(Class)modelClass propertyKey:(NSString *)propertyKey {
+	NSParameterAssert(kind < MTLMetricKindCount);
+	NSParameterAssert(modelClass != Nil);
+	NSParameterAssert(propertyKey != nil);
+
+	MTLMetricKindStatistics *kindStatistics = self.kindStatistics[kind];
+	MTLMetricStatistics *statistics = kindStatistics.statisticsByModelClassAndPropertyKey[(id<NSCopying>)modelClass][propertyKey];
+
+	return [statistics copy] ?: [[MTLMetricStatistics alloc] init];
+}
+
+- (NSDictionary *)errorCountsForKind:(MTLMetricKind)kind {
+	NSParameterAssert(kind < MTLMetricKindCount);
+
+	MTLMetricKindStatistics *kindStatistics = self.kindStatistics[kind];
+
+	NSMutableDictionary *result = [[NSMutableDictionary alloc] initWithCapacity:kindStatistics.errorCounts.count];
+	[kindStatistics.errorCounts enumerateKeysAndObjectsUsingBlock:^(NSString *domain, NSDictionary *countsByCode, BOOL *stop) {
+		result[domain] = [countsByCode copy];
+	}];
+
+	return result;
+}
+
+@end
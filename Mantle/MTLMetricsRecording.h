@@ -0,0 +1,30 @@
+//
+//  MTLMetricsRecording.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "MTLMetrics.h"
+
+// Whether MTLMetrics is enabled. Check this before measuring anything, so that
+// disabled metrics only cost a branch.
+extern BOOL MTLMetricsEnabled;
+
+// Returns a monotonic timestamp in nanoseconds, for passing to
+// MTLMetricsRecord().
+uint64_t MTLMetricsCurrentTime(void);
+
+// Records a measurement with MTLMetrics.
+//
+// kind        - The kind of work which was measured.
+// modelClass  - The model class the work was done for, or Nil.
+// propertyKey - The property the work was done for, or nil.
+// startTime   - The result of MTLMetricsCurrentTime() when the work started, or
+//               0 if the work was not timed.
+// success     - Whether the work succeeded.
+// error       - The error the work failed with, if any.
+void MTLMetricsRecord(MTLMetricKind kind, Class modelClass, NSString *propertyKey, uint64_t startTime, BOOL success, NSError *error);
@@ -0,0 +1,123 @@
+//
+//  MTLModel+Diffing.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <objc/runtime.h>
+
+#import "MTLModel+Diffing.h"
+#import "MTLPropertyAccessor.h"
+
+// Associated with model classes to cache the result of
+// MTLDiffingAccessorsForClass().
+static void *MTLModelCachedDiffingAccessorsKey = &MTLModelCachedDiffingAccessorsKey;
+
+// Returns the accessors of the permanent properties of `modelClass`, sorted by
+// key.
+static NSArray *MTLDiffingAccessorsForClass(Class modelClass) {
+	NSArray *cachedAccessors = objc_getAssociatedObject(modelClass, MTLModelCachedDiffingAccessorsKey);
+	if (cachedAccessors != nil) return cachedAccessors;
+
+	NSArray *allAccessors = [MTLPropertyAccessor accessorsForModelClass:modelClass];
+	NSIndexSet *indexes = [allAccessors indexesOfObjectsPassingTest:^ BOOL (MTLPropertyAccessor *accessor, NSUInteger index, BOOL *stop) {
+		return [modelClass storageBehaviorForPropertyWithKey:accessor.key] == MTLPropertyStoragePermanent;
+	}];
+
+	NSArray *accessors = [allAccessors objectsAtIndexes:indexes];
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(modelClass, MTLModelCachedDiffingAccessorsKey, accessors, OBJC_ASSOCIATION_COPY);
+
+	return accessors;
+}
+
+// Returns whether `value` and `otherValue` should be compared recursively.
+static BOOL MTLDiffingShouldDescend(id value, id otherValue) {
+	if (value == nil || otherValue == nil) return NO;
+
+	if ([value isKindOfClass:MTLModel.class]) return [otherValue isMemberOfClass:[value class]];
+
+	return [value isKindOfClass:NSArray.class] && [otherValue isKindOfClass:NSArray.class] && [value count] == [otherValue count];
+}
+
+static void MTLDiffingAppendChangedKeyPaths(id value, id otherValue, NSString *keyPath, NSMutableArray *keyPaths);
+
+// Appends the key paths of the values that differ between two models of the
+// same class.
+static void MTLDiffingAppendChangedKeyPathsOfModels(MTLModel *model, MTLModel *otherModel, NSString *prefix, NSMutableArray *keyPaths) {
+	for (MTLPropertyAccessor *accessor in MTLDiffingAccessorsForClass(model.class)) {
+		if ([accessor valueOfModel:model isEqualToValueOfModel:otherModel]) continue;
+
+		NSString *keyPath = (prefix != nil ? [NSString stringWithFormat:@"%@.%@", prefix, accessor.key] : accessor.key);
+
+		if (accessor.type != MTLPropertyAccessorTypeObject) {
+			[keyPaths addObject:keyPath];
+			continue;
+		}
+
+		MTLDiffingAppendChangedKeyPaths([accessor objectValueOfModel:model], [accessor objectValueOfModel:otherModel], keyPath, keyPaths);
+	}
+}
+
+// Appends the key paths of the values that differ between `value` and
+// `otherValue`, which are known to be unequal.
+static void MTLDiffingAppendChangedKeyPaths(id value, id otherValue, NSString *keyPath, NSMutableArray *keyPaths) {
+	if (!MTLDiffingShouldDescend(value, otherValue)) {
+		[keyPaths addObject:keyPath];
+		return;
+	}
+
+	NSUInteger previousCount = keyPaths.count;
+
+	if ([value isKindOfClass:MTLModel.class]) {
+		MTLDiffingAppendChangedKeyPathsOfModels(value, otherValue, keyPath, keyPaths);
+	} else {
+		NSUInteger count = [value count];
+		for (NSUInteger index = 0; index < count; index++) {
+			id element = value[index];
+			id otherElement = otherValue[index];
+			if (element == otherElement || [element isEqual:otherElement]) continue;
+
+			NSString *elementKeyPath = [NSString stringWithFormat:@"%@.%lu", keyPath, (unsigned long)index];
+			MTLDiffingAppendChangedKeyPaths(element, otherElement, elementKeyPath, keyPaths);
+		}
+	}
+
+	// The values may be unequal for reasons that are not visible in their
+	// properties or elements, like an overridden -isEqual:.
+	if (keyPaths.count == previousCount) [keyPaths addObject:keyPath];
+}
+
+@implementation MTLModel (Diffing)
+
+- (NSArray *)changedPropertyKeysComparedToModel:(MTLModel *)model {
+	NSParameterAssert(model != nil);
+	NSParameterAssert([model isMemberOfClass:self.class]);
+
+	if (model == self) return @[];
+
+	NSMutableArray *keys = [NSMutableArray array];
+	for (MTLPropertyAccessor *accessor in MTLDiffingAccessorsForClass(self.class)) {
+		if (![accessor valueOfModel:self isEqualToValueOfModel:model]) [keys addObject:accessor.key];
+	}
+
+	return keys;
+}
+
+- (NSArray *)changedKeyPathsComparedToModel:(MTLModel *)model {
+	NSParameterAssert(model != nil);
+	NSParameterAssert([model isMemberOfClass:self.class]);
+
+	if (model == self) return @[];
+
+	NSMutableArray *keyPaths = [NSMutableArray array];
+	MTLDiffingAppendChangedKeyPathsOfModels(self, model, nil, keyPaths);
+
+	return keyPaths;
+}
+
+@end
@@ -52,6 +52,13 @@ static void verifyAllowedClassesByPropertyKey(Class modelClass) {
 	}
 }
 
+@interface MTLModel (NSCodingPrivate)
+
+// Implemented by MTLModel.
+- (NSDictionary *)populatedDictionaryValue;
+
+@end
+
 @implementation MTLModel (NSCoding)
 
 #pragma mark Versioning
@@ -214,7 +221,7 @@ static void verifyAllowedClassesByPropertyKey(Class modelClass) {
 	[coder encodeObject:@(self.class.modelVersion) forKey:MTLModelVersionKey];
 
 	NSDictionary *encodingBehaviors = self.class.encodingBehaviorsByPropertyKey;
-	[self.dictionaryValue enumerateKeysAndObjectsUsingBlock:^(NSString *key, id value, BOOL *stop) {
+	[self.populatedDictionaryValue enumerateKeysAndObjectsUsingBlock:^(NSString *key, id value, BOOL *stop) {
 		@try {
 			// Skip nil values.
 			if ([value isEqual:NSNull.null]) return;
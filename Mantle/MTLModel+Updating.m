@@ -0,0 +1,192 @@
+//
+//  MTLModel+Updating.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLModel+Updating.h"
+#import "MTLPropertyAccessor.h"
+#import "NSError+MTLLazyDescription.h"
+
+NSString * const MTLModelUpdatingErrorDomain = @"MTLModelUpdatingErrorDomain";
+const NSInteger MTLModelUpdatingErrorUnknownKey = 1;
+const NSInteger MTLModelUpdatingErrorInvalidKeyPath = 2;
+
+NSString * const MTLModelUpdatingKeyPathErrorKey = @"MTLModelUpdatingKeyPath";
+
+static NSError *MTLModelUpdatingError(NSInteger code, NSString *keyPath, NSString *failureReasonFormat, NSArray *arguments) {
+	NSDictionary *userInfo = (keyPath != nil ? @{ MTLModelUpdatingKeyPathErrorKey: keyPath } : nil);
+
+	return [NSError mtl_errorWithDomain:MTLModelUpdatingErrorDomain code:code descriptionFormat:NSLocalizedString(@"Could not update model", @"") failureReasonFormat:failureReasonFormat arguments:arguments userInfo:userInfo];
+}
+
+// Sets the property of `accessor` on `model` to its value on `otherModel`,
+// without boxing scalars.
+static void MTLModelUpdatingCarryOverValue(MTLPropertyAccessor *accessor, MTLModel *otherModel, MTLModel *model) {
+	switch (accessor.type) {
+		case MTLPropertyAccessorTypeBool:
+		case MTLPropertyAccessorTypeSignedInteger:
+			[accessor setSignedIntegerValue:[accessor signedIntegerValueOfModel:otherModel] ofModel:model];
+			break;
+
+		case MTLPropertyAccessorTypeUnsignedInteger:
+			[accessor setUnsignedIntegerValue:[accessor unsignedIntegerValueOfModel:otherModel] ofModel:model];
+			break;
+
+		case MTLPropertyAccessorTypeFloatingPoint:
+			[accessor setDoubleValue:[accessor doubleValueOfModel:otherModel] ofModel:model];
+			break;
+
+		case MTLPropertyAccessorTypeObject:
+		case MTLPropertyAccessorTypeUnsupported:
+			[accessor setObjectValue:[accessor objectValueOfModel:otherModel] ofModel:model];
+			break;
+	}
+}
+
+// Returns `container` with the value at `components`, starting at `index`,
+// replaced by `value`. NSNull stands in for nil throughout.
+//
+// Returns `container` itself if nothing changed, or nil if the key path could
+// not be resolved or validation failed.
+static id MTLModelUpdatingValueBySettingValue(id container, id value, NSArray *components, NSUInteger index, NSString *keyPath, NSError **error) {
+	NSString *component = components[index];
+	BOOL isLastComponent = (index + 1 == components.count);
+
+	if ([container isKindOfClass:MTLModel.class]) {
+		MTLModel *model = container;
+
+		if (![[model.class propertyKeys] containsObject:component]) {
+			if (error != NULL) {
+				*error = MTLModelUpdatingError(MTLModelUpdatingErrorUnknownKey, keyPath, NSLocalizedString(@"\"%1$@\" is not a property of %2$@.", @""), @[ component, NSStringFromClass(model.class) ]);
+			}
+
+			return nil;
+		}
+
+		id newValue = value;
+		if (!isLastComponent) {
+			id currentValue = [model valueForKey:component];
+
+			newValue = MTLModelUpdatingValueBySettingValue(currentValue, value, components, index + 1, keyPath, error);
+			if (newValue == nil) return nil;
+
+			// Share the whole path if nothing beneath it changed. Mutable
+			// classes still get a fresh instance below.
+			if (newValue == currentValue && model.class.instancesAreImmutable) return model;
+		}
+
+		return [model modelByUpdatingValues:@{ component: newValue } error:error];
+	}
+
+	if ([container isKindOfClass:NSArray.class]) {
+		NSArray *array = container;
+
+		NSInteger elementIndex = component.integerValue;
+		BOOL isIndex = (component.length > 0 && [component rangeOfCharacterFromSet:NSCharacterSet.decimalDigitCharacterSet.invertedSet].location == NSNotFound);
+
+		if (!isIndex || elementIndex < 0 || (NSUInteger)elementIndex >= array.count) {
+			if (error != NULL) {
+				*error = MTLModelUpdatingError(MTLModelUpdatingErrorInvalidKeyPath, keyPath, NSLocalizedString(@"\"%1$@\" is not an index into an array of %2$@ elements.", @""), @[ component, @(array.count) ]);
+			}
+
+			return nil;
+		}
+
+		id element = array[(NSUInteger)elementIndex];
+
+		id newElement = value;
+		if (!isLastComponent) {
+			newElement = MTLModelUpdatingValueBySettingValue(element, value, components, index + 1, keyPath, error);
+			if (newElement == nil) return nil;
+		}
+
+		// Unchanged arrays are only shared if they can't be mutated.
+		if (newElement == element) return [array copy];
+
+		NSMutableArray *newArray = [array mutableCopy];
+		newArray[(NSUInteger)elementIndex] = newElement;
+
+		return [newArray copy];
+	}
+
+	if (error != NULL) {
+		NSString *className = (container != nil && container != NSNull.null ? NSStringFromClass([container class]) : @"nil");
+
+		*error = MTLModelUpdatingError(MTLModelUpdatingErrorInvalidKeyPath, keyPath, NSLocalizedString(@"\"%1$@\" cannot be resolved on %2$@, which is neither a model nor an array.", @""), @[ component, className ]);
+	}
+
+	return nil;
+}
+
+@implementation MTLModel (Updating)
+
+- (instancetype)modelByUpdatingValues:(NSDictionary *)values error:(NSError **)error {
+	NSParameterAssert(values != nil);
+
+	NSSet *propertyKeys = self.class.propertyKeys;
+	for (NSString *key in values) {
+		if ([propertyKeys containsObject:key]) continue;
+
+		if (error != NULL) {
+			*error = MTLModelUpdatingError(MTLModelUpdatingErrorUnknownKey, key, NSLocalizedString(@"\"%1$@\" is not a property of %2$@.", @""), @[ key, NSStringFromClass(self.class) ]);
+		}
+
+		return nil;
+	}
+
+	NSArray *accessors = [MTLPropertyAccessor accessorsForModelClass:self.class];
+
+	if (self.class.instancesAreImmutable) {
+		BOOL changed = NO;
+
+		for (MTLPropertyAccessor *accessor in accessors) {
+			id value = values[accessor.key];
+			if (value == nil) continue;
+
+			if (value == NSNull.null) value = nil;
+
+			id currentValue = [accessor objectValueOfModel:self];
+			if (currentValue != value && ![currentValue isEqual:value]) {
+				changed = YES;
+				break;
+			}
+		}
+
+		if (!changed) return self;
+	}
+
+	MTLModel *model = [[self.class alloc] init];
+
+	for (MTLPropertyAccessor *accessor in accessors) {
+		if (!accessor.writable || values[accessor.key] != nil) continue;
+
+		MTLModelUpdatingCarryOverValue(accessor, self, model);
+	}
+
+	for (NSString *key in values) {
+		// Mark this as being autoreleased, because validateValue may return
+		// a new object to be stored in this variable (and we don't want ARC to
+		// double-free or leak the old or new values).
+		__autoreleasing id value = values[key];
+		if (value == NSNull.null) value = nil;
+
+		if (![model validateValue:&value forKey:key error:error]) return nil;
+
+		[model setValue:value forKey:key];
+	}
+
+	return model;
+}
+
+- (instancetype)modelBySettingValue:(id)value forKeyPath:(NSString *)keyPath error:(NSError **)error {
+	NSParameterAssert(keyPath != nil);
+
+	NSArray *components = [keyPath componentsSeparatedByString:@"."];
+
+	return MTLModelUpdatingValueBySettingValue(self, value ?: NSNull.null, components, 0, keyPath, error);
+}
+
+@end
@@ -8,6 +8,7 @@
 
 #import "MTLEXTRuntimeExtensions.h"
 #import "MTLEXTScope.h"
+#import "MTLMetricsRecording.h"
 #import "MTLModel.h"
 #import "MTLReflection.h"
 #import "NSError+MTLModelException.h"
@@ -82,6 +83,12 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 // +storageBehaviorForPropertyWithKey returned MTLPropertyStoragePermanent.
 + (NSSet *)permanentPropertyKeys;
 
+// Returns the -dictionaryValue of the receiver, except that subclasses may
+// leave out properties which are nil.
+//
+// Used where NSNull values would be skipped anyway.
+- (NSDictionary *)populatedDictionaryValue;
+
 // Enumerates all properties of the receiver's class hierarchy, starting at the
 // receiver, and continuing up until (but not including) MTLModel.
 //
@@ -174,6 +181,8 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 
 + (NSSet *)propertyKeys {
 	NSSet *cachedKeys = objc_getAssociatedObject(self, MTLModelCachedPropertyKeysKey);
+	if (MTLMetricsEnabled) MTLMetricsRecord(cachedKeys != nil ? MTLMetricKindReflectionCacheHit : MTLMetricKindReflectionCacheMiss, self, nil, 0, YES, nil);
+
 	if (cachedKeys != nil) return cachedKeys;
 
 	NSMutableSet *keys = [NSMutableSet set];
@@ -221,6 +230,10 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 	return [self dictionaryWithValuesForKeys:keys.allObjects];
 }
 
+- (NSDictionary *)populatedDictionaryValue {
+	return self.dictionaryValue;
+}
+
 + (MTLPropertyStorage)storageBehaviorForPropertyWithKey:(NSString *)propertyKey {
 	objc_property_t property = NULL;
 	const char *propertyKeyUTF8String = propertyKey.UTF8String;
@@ -250,6 +263,10 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 	}
 }
 
++ (BOOL)instancesAreImmutable {
+	return NO;
+}
+
 #pragma mark Merging
 
 - (void)mergeValueForKey:(NSString *)key fromModel:(NSObject<MTLModel> *)model {
@@ -295,6 +312,8 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 #pragma mark NSCopying
 
 - (instancetype)copyWithZone:(NSZone *)zone {
+	if (self.class.instancesAreImmutable) return self;
+
 	MTLModel *copy = [[self.class allocWithZone:zone] init];
 	[copy setValuesForKeysWithDictionary:self.dictionaryValue];
 	return copy;
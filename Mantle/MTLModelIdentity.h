@@ -0,0 +1,21 @@
+//
+//  MTLModelIdentity.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "MTLReconciliation.h"
+
+// Returns whether `modelClass` declares any +identityPropertyKeys.
+BOOL MTLModelClassHasIdentity(Class modelClass);
+
+// Returns the identity of `model`, which is the value of its only identity
+// property, or an array of the values of all of them, with nil represented by
+// NSNull.
+//
+// The class of `model` must have +identityPropertyKeys.
+id MTLIdentityOfModel(MTLModel *model);
@@ -0,0 +1,205 @@
+//
+//  MTLPayloadCache.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <CommonCrypto/CommonDigest.h>
+#import <malloc/malloc.h>
+#import <objc/runtime.h>
+
+#import "MTLLRUCache.h"
+#import "MTLModel.h"
+#import "MTLPayloadCache.h"
+#import "MTLPayloadCacheSharing.h"
+
+// The key of the associated object marking objects returned from any cache.
+static void *MTLPayloadCacheSharedObjectKey = &MTLPayloadCacheSharedObjectKey;
+
+BOOL MTLPayloadCacheIsSharedObject(id object) {
+	return object != nil && objc_getAssociatedObject(object, MTLPayloadCacheSharedObjectKey) != nil;
+}
+
+// Adds the estimated size of `object`, and of the objects it contains, to
+// `size`, counting every object in `visitedObjects` only once.
+static void MTLPayloadCacheAddEstimatedSize(id object, NSHashTable *visitedObjects, NSUInteger *size) {
+	if (object == nil || [visitedObjects containsObject:object]) return;
+	[visitedObjects addObject:object];
+
+	// Tagged pointers and constants are not allocated, and count as 0.
+	*size += malloc_size((__bridge const void *)object);
+
+	// Strings decoded from payloads store their characters inline, so only
+	// data is assumed to keep its bytes in a separate buffer.
+	if ([object isKindOfClass:NSData.class]) {
+		*size += [object length];
+	} else if ([object isKindOfClass:NSArray.class] || [object isKindOfClass:NSSet.class] || [object isKindOfClass:NSOrderedSet.class]) {
+		*size += [object count] * sizeof(id);
+
+		for (id element in object) {
+			MTLPayloadCacheAddEstimatedSize(element, visitedObjects, size);
+		}
+	} else if ([object isKindOfClass:NSDictionary.class]) {
+		*size += [object count] * 2 * sizeof(id);
+
+		[object enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+			MTLPayloadCacheAddEstimatedSize(key, visitedObjects, size);
+			MTLPayloadCacheAddEstimatedSize(value, visitedObjects, size);
+		}];
+	} else if ([object isKindOfClass:MTLModel.class]) {
+		for (id value in [object dictionaryValue].objectEnumerator) {
+			MTLPayloadCacheAddEstimatedSize(value, visitedObjects, size);
+		}
+	}
+}
+
+// Returns the approximate number of bytes kept alive by `object`, following
+// collections and the properties of models.
+static NSUInteger MTLPayloadCacheEstimatedSize(id object) {
+	NSHashTable *visitedObjects = [[NSHashTable alloc] initWithOptions:NSPointerFunctionsOpaqueMemory | NSPointerFunctionsObjectPointerPersonality capacity:0];
+
+	NSUInteger size = 0;
+	MTLPayloadCacheAddEstimatedSize(object, visitedObjects, &size);
+
+	return MAX(size, (NSUInteger)1);
+}
+
+// Writes the SHA-256 digest of `payload` to `digest`, in chunks which fit
+// CC_LONG.
+static void MTLPayloadDigest(NSData *payload, uint8_t digest[CC_SHA256_DIGEST_LENGTH]) {
+	CC_SHA256_CTX context;
+	CC_SHA256_Init(&context);
+
+	const uint8_t *bytes = payload.bytes;
+	NSUInteger remainingLength = payload.length;
+
+	while (remainingLength > 0) {
+		CC_LONG chunkLength = (CC_LONG)MIN(remainingLength, (NSUInteger)UINT32_MAX);
+		CC_SHA256_Update(&context, bytes, chunkLength);
+
+		bytes += chunkLength;
+		remainingLength -= chunkLength;
+	}
+
+	CC_SHA256_Final(digest, &context);
+}
+
+// Identifies a payload decoded into a model class with a configuration.
+//
+// Only the SHA-256 digest of the payload is kept, so that keys do not hold on
+// to the payloads themselves.
+@interface MTLPayloadCacheKey : NSObject <NSCopying> {
+@public
+	Class _modelClass;
+	id _configuration;
+	uint8_t _payloadDigest[CC_SHA256_DIGEST_LENGTH];
+}
+
+@end
+
+@implementation MTLPayloadCacheKey
+
+- (instancetype)copyWithZone:(NSZone *)zone {
+	return self;
+}
+
+- (NSUInteger)hash {
+	NSUInteger hash;
+	memcpy(&hash, _payloadDigest, sizeof(hash));
+
+	return hash ^ [_configuration hash];
+}
+
+- (BOOL)isEqual:(MTLPayloadCacheKey *)key {
+	if (self == key) return YES;
+	if (![key isKindOfClass:MTLPayloadCacheKey.class]) return NO;
+
+	if (memcmp(_payloadDigest, key->_payloadDigest, sizeof(_payloadDigest)) != 0 || _modelClass != key->_modelClass) return NO;
+
+	return _configuration == key->_configuration || [_configuration isEqual:key->_configuration];
+}
+
+@end
+
+@interface MTLPayloadCache ()
+
+@property (nonatomic, strong, readonly) MTLLRUCache *cache;
+
+@end
+
+@implementation MTLPayloadCache
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	return [self initWithTotalByteLimit:64 * 1024 * 1024];
+}
+
+- (instancetype)initWithTotalByteLimit:(NSUInteger)totalByteLimit {
+	NSParameterAssert(totalByteLimit > 0);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_totalByteLimit = totalByteLimit;
+	_cache = [[MTLLRUCache alloc] initWithCountLimit:0 totalCostLimit:totalByteLimit];
+
+	return self;
+}
+
+#pragma mark Statistics
+
+- (NSUInteger)totalBytes {
+	return self.cache.totalCost;
+}
+
+- (NSUInteger)count {
+	return self.cache.count;
+}
+
+- (NSUInteger)hitCount {
+	return self.cache.hitCount;
+}
+
+- (NSUInteger)missCount {
+	return self.cache.missCount;
+}
+
+#pragma mark Caching
+
+- (id)objectForPayload:(NSData *)payload modelClass:(Class)modelClass decodingWithBlock:(id (^)(void))block {
+	return [self objectForPayload:payload modelClass:modelClass configuration:nil decodingWithBlock:block];
+}
+
+- (id)objectForPayload:(NSData *)payload modelClass:(Class)modelClass configuration:(id)configuration decodingWithBlock:(id (^)(void))block {
+	NSParameterAssert(payload != nil);
+	NSParameterAssert(modelClass != nil);
+	NSParameterAssert(block != nil);
+
+	MTLPayloadCacheKey *key = [[MTLPayloadCacheKey alloc] init];
+	key->_modelClass = modelClass;
+	key->_configuration = configuration;
+	MTLPayloadDigest(payload, key->_payloadDigest);
+
+	id object = [self.cache objectForKey:key];
+	if (object != nil) return object;
+
+	object = block();
+	if (object == nil) return nil;
+
+	NSUInteger cost = MTLPayloadCacheEstimatedSize(object);
+	if (cost > self.totalByteLimit) return object;
+
+	objc_setAssociatedObject(object, MTLPayloadCacheSharedObjectKey, @YES, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+	[self.cache setObject:object forKey:key cost:cost];
+
+	return object;
+}
+
+- (void)removeAllObjects {
+	[self.cache removeAllObjects];
+}
+
+@end
@@ -0,0 +1,13 @@
+//
+//  MTLPayloadCacheSharing.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// Returns whether `object` was ever returned from an MTLPayloadCache, and may
+// therefore be shared with other callers, even if it was evicted since.
+BOOL MTLPayloadCacheIsSharedObject(id object);
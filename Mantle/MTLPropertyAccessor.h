@@ -0,0 +1,94 @@
+//
+//  MTLPropertyAccessor.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/// The kinds of values a property holds, as far as MTLPropertyAccessor is
+/// concerned.
+///
+/// MTLPropertyAccessorTypeObject          - An object of any class.
+/// MTLPropertyAccessorTypeBool            - A BOOL or bool.
+/// MTLPropertyAccessorTypeSignedInteger   - A signed integer of any width.
+/// MTLPropertyAccessorTypeUnsignedInteger - An unsigned integer of any width.
+/// MTLPropertyAccessorTypeFloatingPoint   - A float or double.
+/// MTLPropertyAccessorTypeUnsupported     - Any other type, like a struct or
+///                                          a pointer, which can only be
+///                                          accessed through KVC.
+typedef enum : NSUInteger {
+	MTLPropertyAccessorTypeObject,
+	MTLPropertyAccessorTypeBool,
+	MTLPropertyAccessorTypeSignedInteger,
+	MTLPropertyAccessorTypeUnsignedInteger,
+	MTLPropertyAccessorTypeFloatingPoint,
+	MTLPropertyAccessorTypeUnsupported
+} MTLPropertyAccessorType;
+
+/// Reads and writes one property of a model class directly through its
+/// accessor methods or instance variable, so that scalars are never boxed into
+/// NSNumbers, and no KVC lookup happens per access.
+///
+/// Accessors are immutable and may be used from any thread.
+@interface MTLPropertyAccessor : NSObject
+
+/// Returns accessors for all of the +propertyKeys of `modelClass`, sorted by
+/// key.
+///
+/// The accessors are cached per class, so this is cheap after the first call.
+///
+/// modelClass - A class conforming to <MTLModel>. This argument must not be
+///              nil.
++ (NSArray *)accessorsForModelClass:(Class)modelClass;
+
+/// The key of the property.
+@property (nonatomic, copy, readonly) NSString *key;
+
+/// The kind of value the property holds.
+@property (nonatomic, assign, readonly) MTLPropertyAccessorType type;
+
+/// The declared class of an object property, or Nil if the property is of type
+/// `id` or not an object.
+@property (nonatomic, strong, readonly) Class objectClass;
+
+/// The width of a scalar property in bytes, or 0 for objects.
+@property (nonatomic, assign, readonly) size_t scalarSize;
+
+/// Whether the property can be set, either through a setter or by writing its
+/// instance variable.
+@property (nonatomic, assign, readonly, getter = isWritable) BOOL writable;
+
+/// Returns the value of an object property, or the boxed value of any other
+/// property.
+- (id)objectValueOfModel:(id)model;
+
+/// Returns the value of a bool, integer or floating-point property, converted
+/// as if by a C cast.
+- (long long)signedIntegerValueOfModel:(id)model;
+- (unsigned long long)unsignedIntegerValueOfModel:(id)model;
+- (double)doubleValueOfModel:(id)model;
+
+/// Returns whether the property has equal values on two models.
+///
+/// Scalars are compared unboxed, with NaN equal to NaN like in NSNumber.
+/// Objects are compared by pointer first, and only then with -isEqual:.
+- (BOOL)valueOfModel:(id)model isEqualToValueOfModel:(id)otherModel;
+
+/// Sets the value of an object property, or the unboxed value of any other
+/// property.
+///
+/// Must only be called if the receiver is writable.
+- (void)setObjectValue:(id)value ofModel:(id)model;
+
+/// Sets the value of a bool, integer or floating-point property, converted as
+/// if by a C cast.
+///
+/// Must only be called if the receiver is writable.
+- (void)setSignedIntegerValue:(long long)value ofModel:(id)model;
+- (void)setUnsignedIntegerValue:(unsigned long long)value ofModel:(id)model;
+- (void)setDoubleValue:(double)value ofModel:(id)model;
+
+@end
@@ -0,0 +1,341 @@
+//
+//  MTLPropertyAccessor.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <math.h>
+#import <objc/runtime.h>
+
+#import "MTLEXTRuntimeExtensions.h"
+#import "MTLEXTScope.h"
+#import "MTLModel.h"
+#import "MTLPropertyAccessor.h"
+
+// Associated with model classes to cache the result of
+// +accessorsForModelClass:.
+static void *MTLPropertyAccessorCachedAccessorsKey = &MTLPropertyAccessorCachedAccessorsKey;
+
+// Expands `CASE` for every scalar type encoding which is supported, with the
+// encoding character and the C type.
+#define MTLPropertyAccessorScalarTypes(CASE) \
+	CASE('c', char) \
+	CASE('s', short) \
+	CASE('i', int) \
+	CASE('l', long) \
+	CASE('q', long long) \
+	CASE('C', unsigned char) \
+	CASE('S', unsigned short) \
+	CASE('I', unsigned int) \
+	CASE('L', unsigned long) \
+	CASE('Q', unsigned long long) \
+	CASE('B', bool) \
+	CASE('f', float) \
+	CASE('d', double)
+
+@interface MTLPropertyAccessor () {
+	// The type encoding of a scalar property, or '@' for objects.
+	char _encoding;
+
+	// The class the accessor was created for, whose methods are cached below.
+	Class _modelClass;
+
+	SEL _getter;
+	IMP _getterIMP;
+
+	// The setter, if the class implements one.
+	SEL _setter;
+	IMP _setterIMP;
+
+	// The offset of the property's instance variable, if it has one, and the
+	// class does not implement a setter.
+	ptrdiff_t _ivarOffset;
+	BOOL _hasIvar;
+}
+
+- (instancetype)initWithProperty:(objc_property_t)property key:(NSString *)key modelClass:(Class)modelClass;
+
+@end
+
+@implementation MTLPropertyAccessor
+
+#pragma mark Lifecycle
+
++ (NSArray *)accessorsForModelClass:(Class)modelClass {
+	NSParameterAssert(modelClass != nil);
+	NSParameterAssert([modelClass conformsToProtocol:@protocol(MTLModel)]);
+
+	NSArray *cachedAccessors = objc_getAssociatedObject(modelClass, MTLPropertyAccessorCachedAccessorsKey);
+	if (cachedAccessors != nil) return cachedAccessors;
+
+	NSArray *keys = [[modelClass propertyKeys].allObjects sortedArrayUsingSelector:@selector(compare:)];
+	NSMutableArray *accessors = [NSMutableArray arrayWithCapacity:keys.count];
+
+	for (NSString *key in keys) {
+		objc_property_t property = class_getProperty(modelClass, key.UTF8String);
+		if (property == NULL) continue;
+
+		[accessors addObject:[[self alloc] initWithProperty:property key:key modelClass:modelClass]];
+	}
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(modelClass, MTLPropertyAccessorCachedAccessorsKey, accessors, OBJC_ASSOCIATION_COPY);
+
+	return [accessors copy];
+}
+
+- (instancetype)initWithProperty:(objc_property_t)property key:(NSString *)key modelClass:(Class)modelClass {
+	self = [super init];
+	if (self == nil) return nil;
+
+	mtl_propertyAttributes *attributes = mtl_copyPropertyAttributes(property);
+	@onExit {
+		free(attributes);
+	};
+
+	_key = [key copy];
+	_modelClass = modelClass;
+	_encoding = (strlen(attributes->type) == 1 ? attributes->type[0] : 0);
+
+	_getter = attributes->getter;
+	_getterIMP = class_getMethodImplementation(modelClass, _getter);
+
+	if ([modelClass instancesRespondToSelector:attributes->setter]) {
+		_setter = attributes->setter;
+		_setterIMP = class_getMethodImplementation(modelClass, _setter);
+	} else if (attributes->ivar != NULL) {
+		Ivar ivar = class_getInstanceVariable(modelClass, attributes->ivar);
+		if (ivar != NULL) {
+			_ivarOffset = ivar_getOffset(ivar);
+			_hasIvar = YES;
+		}
+	}
+
+	if (*(attributes->type) == *(@encode(id))) {
+		_type = MTLPropertyAccessorTypeObject;
+		_objectClass = attributes->objectClass;
+		_encoding = '@';
+	} else if (strcmp(attributes->type, @encode(BOOL)) == 0 || _encoding == 'B') {
+		_type = MTLPropertyAccessorTypeBool;
+	} else if (_encoding == 'f' || _encoding == 'd') {
+		_type = MTLPropertyAccessorTypeFloatingPoint;
+	} else if (_encoding != 0 && strchr("csilq", _encoding) != NULL) {
+		_type = MTLPropertyAccessorTypeSignedInteger;
+	} else if (_encoding != 0 && strchr("CSILQ", _encoding) != NULL) {
+		_type = MTLPropertyAccessorTypeUnsignedInteger;
+	} else {
+		_type = MTLPropertyAccessorTypeUnsupported;
+		_encoding = 0;
+	}
+
+	switch (_encoding) {
+		#define MTLPropertyAccessorSizeCase(CHARACTER, TYPE) \
+			case CHARACTER: _scalarSize = sizeof(TYPE); break;
+
+		MTLPropertyAccessorScalarTypes(MTLPropertyAccessorSizeCase)
+
+		#undef MTLPropertyAccessorSizeCase
+
+		default:
+			break;
+	}
+
+	// Objects are set through KVC, which can also assign instance variables.
+	_writable = (_setterIMP != NULL || _hasIvar);
+	if (_type == MTLPropertyAccessorTypeObject || _type == MTLPropertyAccessorTypeUnsupported) {
+		_writable = _writable || [modelClass accessInstanceVariablesDirectly];
+	}
+
+	return self;
+}
+
+#pragma mark Method Lookup
+
+// Returns the getter of `model`, which may be a subclass overriding it.
+- (IMP)getterForModel:(id)model {
+	return (object_getClass(model) == _modelClass ? _getterIMP : [model methodForSelector:_getter]);
+}
+
+// Returns the setter of `model`, or NULL if the instance variable should be
+// written instead.
+- (IMP)setterForModel:(id)model {
+	if (_setterIMP == NULL) return NULL;
+
+	return (object_getClass(model) == _modelClass ? _setterIMP : [model methodForSelector:_setter]);
+}
+
+#pragma mark Reading
+
+- (id)objectValueOfModel:(id)model {
+	NSParameterAssert(model != nil);
+
+	if (_type == MTLPropertyAccessorTypeObject) {
+		return ((id (*)(id, SEL))[self getterForModel:model])(model, _getter);
+	}
+
+	return [model valueForKey:self.key];
+}
+
+#define MTLPropertyAccessorReadCase(CHARACTER, TYPE) \
+	case CHARACTER: \
+		return (MTLPropertyAccessorResultType)((TYPE (*)(id, SEL))getter)(model, _getter);
+
+- (long long)signedIntegerValueOfModel:(id)model {
+	NSParameterAssert(model != nil);
+
+	typedef long long MTLPropertyAccessorResultType;
+	IMP getter = [self getterForModel:model];
+
+	switch (_encoding) {
+		MTLPropertyAccessorScalarTypes(MTLPropertyAccessorReadCase)
+
+		default:
+			return [[model valueForKey:self.key] longLongValue];
+	}
+}
+
+- (unsigned long long)unsignedIntegerValueOfModel:(id)model {
+	NSParameterAssert(model != nil);
+
+	typedef unsigned long long MTLPropertyAccessorResultType;
+	IMP getter = [self getterForModel:model];
+
+	switch (_encoding) {
+		MTLPropertyAccessorScalarTypes(MTLPropertyAccessorReadCase)
+
+		default:
+			return [[model valueForKey:self.key] unsignedLongLongValue];
+	}
+}
+
+- (double)doubleValueOfModel:(id)model {
+	NSParameterAssert(model != nil);
+
+	typedef double MTLPropertyAccessorResultType;
+	IMP getter = [self getterForModel:model];
+
+	switch (_encoding) {
+		MTLPropertyAccessorScalarTypes(MTLPropertyAccessorReadCase)
+
+		default:
+			return [[model valueForKey:self.key] doubleValue];
+	}
+}
+
+#undef MTLPropertyAccessorReadCase
+
+#pragma mark Comparison
+
+#define MTLPropertyAccessorCompareCase(CHARACTER, TYPE) \
+	case CHARACTER: { \
+		TYPE value = ((TYPE (*)(id, SEL))getter)(model, _getter); \
+		TYPE otherValue = ((TYPE (*)(id, SEL))otherGetter)(otherModel, _getter); \
+		return value == otherValue || (isnan((double)value) && isnan((double)otherValue)); \
+	}
+
+- (BOOL)valueOfModel:(id)model isEqualToValueOfModel:(id)otherModel {
+	NSParameterAssert(model != nil);
+	NSParameterAssert(otherModel != nil);
+
+	IMP getter = [self getterForModel:model];
+	IMP otherGetter = [self getterForModel:otherModel];
+
+	switch (_encoding) {
+		MTLPropertyAccessorScalarTypes(MTLPropertyAccessorCompareCase)
+
+		case '@': {
+			id value = ((id (*)(id, SEL))getter)(model, _getter);
+			id otherValue = ((id (*)(id, SEL))otherGetter)(otherModel, _getter);
+
+			return value == otherValue || [value isEqual:otherValue];
+		}
+
+		default: {
+			id value = [model valueForKey:self.key];
+			id otherValue = [otherModel valueForKey:self.key];
+
+			return value == otherValue || [value isEqual:otherValue];
+		}
+	}
+}
+
+#undef MTLPropertyAccessorCompareCase
+
+#pragma mark Writing
+
+- (void)setObjectValue:(id)value ofModel:(id)model {
+	NSParameterAssert(model != nil);
+	NSAssert(self.writable, @"Property \"%@\" of %@ cannot be set", self.key, _modelClass);
+
+	IMP setter = [self setterForModel:model];
+	if (_type == MTLPropertyAccessorTypeObject && setter != NULL) {
+		((void (*)(id, SEL, id))setter)(model, _setter, value);
+	} else if (value == nil && _type != MTLPropertyAccessorTypeObject) {
+		[model setNilValueForKey:self.key];
+	} else {
+		[model setValue:value forKey:self.key];
+	}
+}
+
+#define MTLPropertyAccessorWriteCase(CHARACTER, TYPE) \
+	case CHARACTER: { \
+		TYPE scalar = (TYPE)value; \
+		if (setter != NULL) { \
+			((void (*)(id, SEL, TYPE))setter)(model, _setter, scalar); \
+		} else { \
+			memcpy((uint8_t *)(__bridge void *)model + _ivarOffset, &scalar, sizeof(scalar)); \
+		} \
+		break; \
+	}
+
+- (void)setSignedIntegerValue:(long long)value ofModel:(id)model {
+	NSParameterAssert(model != nil);
+	NSAssert(self.writable, @"Property \"%@\" of %@ cannot be set", self.key, _modelClass);
+
+	if (_type == MTLPropertyAccessorTypeBool) value = (value != 0);
+	IMP setter = [self setterForModel:model];
+
+	switch (_encoding) {
+		MTLPropertyAccessorScalarTypes(MTLPropertyAccessorWriteCase)
+
+		default:
+			[self setObjectValue:@(value) ofModel:model];
+	}
+}
+
+- (void)setUnsignedIntegerValue:(unsigned long long)value ofModel:(id)model {
+	NSParameterAssert(model != nil);
+	NSAssert(self.writable, @"Property \"%@\" of %@ cannot be set", self.key, _modelClass);
+
+	if (_type == MTLPropertyAccessorTypeBool) value = (value != 0);
+	IMP setter = [self setterForModel:model];
+
+	switch (_encoding) {
+		MTLPropertyAccessorScalarTypes(MTLPropertyAccessorWriteCase)
+
+		default:
+			[self setObjectValue:@(value) ofModel:model];
+	}
+}
+
+- (void)setDoubleValue:(double)value ofModel:(id)model {
+	NSParameterAssert(model != nil);
+	NSAssert(self.writable, @"Property \"%@\" of %@ cannot be set", self.key, _modelClass);
+
+	if (_type == MTLPropertyAccessorTypeBool) value = (value != 0);
+	IMP setter = [self setterForModel:model];
+
+	switch (_encoding) {
+		MTLPropertyAccessorScalarTypes(MTLPropertyAccessorWriteCase)
+
+		default:
+			[self setObjectValue:@(value) ofModel:model];
+	}
+}
+
+#undef MTLPropertyAccessorWriteCase
+
+@end
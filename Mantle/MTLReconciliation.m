@@ -0,0 +1,131 @@
+//
+//  MTLReconciliation.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <objc/runtime.h>
+
+#import "MTLModel+Diffing.h"
+#import "MTLModelIdentity.h"
+#import "MTLPropertyAccessor.h"
+#import "MTLReconciliation.h"
+
+// Associated with model classes to cache the result of
+// MTLIdentityAccessorsForClass().
+static void *MTLModelCachedIdentityAccessorsKey = &MTLModelCachedIdentityAccessorsKey;
+
+// Returns the accessors of the +identityPropertyKeys of `modelClass`, in the
+// order of the keys.
+static NSArray *MTLIdentityAccessorsForClass(Class modelClass) {
+	NSArray *cachedAccessors = objc_getAssociatedObject(modelClass, MTLModelCachedIdentityAccessorsKey);
+	if (cachedAccessors != nil) return cachedAccessors;
+
+	NSArray *keys = [modelClass identityPropertyKeys];
+	NSCAssert(keys.count > 0, @"%@ must override +identityPropertyKeys to be reconciled", modelClass);
+
+	NSMutableDictionary *accessorsByKey = [NSMutableDictionary dictionary];
+	for (MTLPropertyAccessor *accessor in [MTLPropertyAccessor accessorsForModelClass:modelClass]) {
+		accessorsByKey[accessor.key] = accessor;
+	}
+
+	NSMutableArray *accessors = [NSMutableArray arrayWithCapacity:keys.count];
+	for (NSString *key in keys) {
+		MTLPropertyAccessor *accessor = accessorsByKey[key];
+		NSCAssert(accessor != nil, @"Identity key \"%@\" is not a property of %@", key, modelClass);
+
+		[accessors addObject:accessor];
+	}
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(modelClass, MTLModelCachedIdentityAccessorsKey, accessors, OBJC_ASSOCIATION_COPY);
+
+	return [accessors copy];
+}
+
+BOOL MTLModelClassHasIdentity(Class modelClass) {
+	if (objc_getAssociatedObject(modelClass, MTLModelCachedIdentityAccessorsKey) != nil) return YES;
+
+	return [modelClass respondsToSelector:@selector(identityPropertyKeys)] && [modelClass identityPropertyKeys].count > 0;
+}
+
+id MTLIdentityOfModel(MTLModel *model) {
+	NSArray *accessors = MTLIdentityAccessorsForClass(model.class);
+
+	if (accessors.count == 1) {
+		return [accessors[0] objectValueOfModel:model] ?: NSNull.null;
+	}
+
+	NSMutableArray *identity = [NSMutableArray arrayWithCapacity:accessors.count];
+	for (MTLPropertyAccessor *accessor in accessors) {
+		[identity addObject:[accessor objectValueOfModel:model] ?: NSNull.null];
+	}
+
+	return identity;
+}
+
+@implementation MTLModel (Identity)
+
++ (NSArray *)identityPropertyKeys {
+	return nil;
+}
+
+@end
+
+@implementation MTLReconciliation
+
+#pragma mark Lifecycle
+
++ (instancetype)reconciliationWithExistingModels:(NSArray *)existingModels incomingModels:(NSArray *)incomingModels {
+	NSParameterAssert(existingModels != nil);
+	NSParameterAssert(incomingModels != nil);
+
+	NSMutableDictionary *existingModelsByIdentity = [[NSMutableDictionary alloc] initWithCapacity:existingModels.count];
+	for (MTLModel *model in existingModels) {
+		existingModelsByIdentity[MTLIdentityOfModel(model)] = model;
+	}
+
+	NSMutableArray *models = [[NSMutableArray alloc] initWithCapacity:incomingModels.count];
+	NSMutableArray *insertedModels = [NSMutableArray array];
+	NSMutableArray *updatedModels = [NSMutableArray array];
+
+	// Existing models which have been matched, by pointer.
+	NSHashTable *matchedModels = [[NSHashTable alloc] initWithOptions:NSPointerFunctionsObjectPointerPersonality capacity:incomingModels.count];
+
+	for (MTLModel *incomingModel in incomingModels) {
+		MTLModel *existingModel = existingModelsByIdentity[MTLIdentityOfModel(incomingModel)];
+
+		if (existingModel == nil || ![incomingModel isMemberOfClass:existingModel.class]) {
+			[insertedModels addObject:incomingModel];
+			[models addObject:incomingModel];
+			continue;
+		}
+
+		[matchedModels addObject:existingModel];
+		[models addObject:existingModel];
+
+		if (existingModel == incomingModel) continue;
+		if ([existingModel changedPropertyKeysComparedToModel:incomingModel].count == 0) continue;
+
+		[existingModel mergeValuesForKeysFromModel:incomingModel];
+		[updatedModels addObject:existingModel];
+	}
+
+	NSMutableArray *removedModels = [NSMutableArray array];
+	for (MTLModel *model in existingModels) {
+		if (![matchedModels containsObject:model]) [removedModels addObject:model];
+	}
+
+	MTLReconciliation *reconciliation = [[self alloc] init];
+	reconciliation->_models = [models copy];
+	reconciliation->_insertedModels = [insertedModels copy];
+	reconciliation->_updatedModels = [updatedModels copy];
+	reconciliation->_removedModels = [removedModels copy];
+
+	return reconciliation;
+}
+
+@end
@@ -0,0 +1,826 @@
+//
+//  MTLSQLiteAdapter.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <sqlite3.h>
+
+#import "MTLEXTScope.h"
+#import "MTLLRUCache.h"
+#import "MTLModel.h"
+#import "MTLPropertyAccessor.h"
+#import "MTLSQLiteAdapter.h"
+#import "MTLTransformerErrorHandling.h"
+#import "NSError+MTLLazyDescription.h"
+
+NSString * const MTLSQLiteAdapterErrorDomain = @"MTLSQLiteAdapterErrorDomain";
+const NSInteger MTLSQLiteAdapterErrorSQLite = 1;
+const NSInteger MTLSQLiteAdapterErrorUnsupportedValue = 2;
+const NSInteger MTLSQLiteAdapterErrorInvalidMapping = 3;
+
+NSString * const MTLSQLiteAdapterResultCodeErrorKey = @"MTLSQLiteAdapterResultCode";
+
+// The number of statements with custom predicates cached per adapter.
+static const NSUInteger MTLSQLiteAdapterPredicateStatementLimit = 64;
+
+static NSError *MTLSQLiteError(sqlite3 *database, int resultCode) {
+	NSString *message = @(database != NULL ? sqlite3_errmsg(database) : sqlite3_errstr(resultCode));
+
+	return [NSError mtl_errorWithDomain:MTLSQLiteAdapterErrorDomain code:MTLSQLiteAdapterErrorSQLite descriptionFormat:NSLocalizedString(@"SQLite error", @"") failureReasonFormat:@"%@" arguments:@[ message ] userInfo:@{ MTLSQLiteAdapterResultCodeErrorKey: @(resultCode) }];
+}
+
+static NSError *MTLSQLiteUnsupportedValueError(NSString *key, Class modelClass, id value) {
+	return [NSError mtl_errorWithDomain:MTLSQLiteAdapterErrorDomain code:MTLSQLiteAdapterErrorUnsupportedValue descriptionFormat:NSLocalizedString(@"Could not convert value", @"") failureReasonFormat:NSLocalizedString(@"The value of \"%@\" of %@ (%@) is not supported by SQLite.", @"") arguments:@[ key, NSStringFromClass(modelClass), [value class] ?: NSNull.null ] userInfo:nil];
+}
+
+// Returns `identifier` as a quoted SQL identifier.
+static NSString *MTLSQLiteQuotedIdentifier(NSString *identifier) {
+	return [NSString stringWithFormat:@"\"%@\"", [identifier stringByReplacingOccurrencesOfString:@"\"" withString:@"\"\""]];
+}
+
+#pragma mark Statements
+
+// Owns a prepared statement, which is finalized when the receiver is
+// deallocated.
+@interface MTLSQLiteStatement : NSObject {
+@public
+	sqlite3_stmt *_statement;
+}
+
++ (instancetype)statementWithSQL:(NSString *)SQL database:(sqlite3 *)database error:(NSError **)error;
+
+@end
+
+@implementation MTLSQLiteStatement
+
++ (instancetype)statementWithSQL:(NSString *)SQL database:(sqlite3 *)database error:(NSError **)error {
+	sqlite3_stmt *statement = NULL;
+	int result = sqlite3_prepare_v2(database, SQL.UTF8String, -1, &statement, NULL);
+	if (result != SQLITE_OK) {
+		if (error != NULL) *error = MTLSQLiteError(database, result);
+		return nil;
+	}
+
+	MTLSQLiteStatement *wrapper = [[self alloc] init];
+	wrapper->_statement = statement;
+
+	return wrapper;
+}
+
+- (void)dealloc {
+	sqlite3_finalize(_statement);
+}
+
+@end
+
+// Binds the UTF-8 bytes of `string`, including any NUL characters.
+static int MTLSQLiteBindString(sqlite3_stmt *statement, int index, NSString *string) {
+	const char *UTF8String = string.UTF8String;
+	if (UTF8String == NULL) return SQLITE_MISMATCH;
+
+	return sqlite3_bind_text64(statement, index, UTF8String, [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding], SQLITE_TRANSIENT, SQLITE_UTF8);
+}
+
+// Binds an object of one of the natively supported classes.
+static int MTLSQLiteBindObject(sqlite3_stmt *statement, int index, id value) {
+	if (value == nil || [value isEqual:NSNull.null]) return sqlite3_bind_null(statement, index);
+
+	if ([value isKindOfClass:NSString.class]) return MTLSQLiteBindString(statement, index, value);
+
+	if ([value isKindOfClass:NSNumber.class]) {
+		const char *objCType = [value objCType];
+		if (strcmp(objCType, @encode(float)) == 0 || strcmp(objCType, @encode(double)) == 0) {
+			return sqlite3_bind_double(statement, index, [value doubleValue]);
+		}
+
+		// SQLite integers are signed, so larger unsigned values would be
+		// stored wrapped around.
+		if (strcmp(objCType, @encode(unsigned long long)) == 0 || strcmp(objCType, @encode(unsigned long)) == 0) {
+			if ([value unsignedLongLongValue] > INT64_MAX) return SQLITE_MISMATCH;
+		}
+
+		return sqlite3_bind_int64(statement, index, [value longLongValue]);
+	}
+
+	if ([value isKindOfClass:NSData.class]) {
+		// Empty data must not be bound with a NULL pointer, which would store
+		// NULL instead.
+		const void *bytes = [value bytes] ?: "";
+		return sqlite3_bind_blob64(statement, index, bytes, [value length], SQLITE_TRANSIENT);
+	}
+
+	if ([value isKindOfClass:NSDate.class]) {
+		return sqlite3_bind_double(statement, index, [value timeIntervalSince1970]);
+	}
+
+	if ([value isKindOfClass:NSURL.class]) {
+		return MTLSQLiteBindString(statement, index, [value absoluteString]);
+	}
+
+	return SQLITE_MISMATCH;
+}
+
+// Returns the value of a column as an NSNumber, NSString or NSData, or nil if
+// it is NULL.
+static id MTLSQLiteColumnObject(sqlite3_stmt *statement, int index) {
+	switch (sqlite3_column_type(statement, index)) {
+		case SQLITE_INTEGER:
+			return @(sqlite3_column_int64(statement, index));
+
+		case SQLITE_FLOAT:
+			return @(sqlite3_column_double(statement, index));
+
+		case SQLITE_TEXT: {
+			const unsigned char *text = sqlite3_column_text(statement, index);
+			return [[NSString alloc] initWithBytes:text length:(NSUInteger)sqlite3_column_bytes(statement, index) encoding:NSUTF8StringEncoding];
+		}
+
+		case SQLITE_BLOB: {
+			const void *bytes = sqlite3_column_blob(statement, index);
+			return [NSData dataWithBytes:bytes length:(NSUInteger)sqlite3_column_bytes(statement, index)];
+		}
+
+		default:
+			return nil;
+	}
+}
+
+#pragma mark Table Plans
+
+// Everything needed to store and load one model class, which is computed once
+// per adapter.
+@interface MTLSQLiteTablePlan : NSObject
+
+@property (nonatomic, strong, readonly) Class modelClass;
+@property (nonatomic, copy, readonly) NSString *tableName;
+
+// The mapped accessors, sorted by key, and their column names and transformers
+// (or NSNull) at the same indexes.
+@property (nonatomic, copy, readonly) NSArray *accessors;
+@property (nonatomic, copy, readonly) NSArray *columnNames;
+@property (nonatomic, copy, readonly) NSArray *transformers;
+
+// The column names of the primary key.
+@property (nonatomic, copy, readonly) NSArray *primaryKeyColumnNames;
+
+// Created lazily. Only accessed while synchronized on the adapter.
+@property (nonatomic, strong) MTLSQLiteStatement *insertStatement;
+@property (nonatomic, strong) MTLSQLiteStatement *upsertStatement;
+@property (nonatomic, strong) MTLSQLiteStatement *updateStatement;
+@property (nonatomic, strong) MTLSQLiteStatement *selectStatement;
+
++ (instancetype)planForModelClass:(Class)modelClass error:(NSError **)error;
+
+// The SQL inserting all mapped columns, in the order of `accessors`.
+- (NSString *)insertSQL;
+
+// The SQL inserting all mapped columns, or updating them in place if a row
+// with the same primary key exists.
+//
+// Requires SQLite 3.24 or later, and a primary key.
+- (NSString *)upsertSQL;
+
+// The SQL updating all mapped columns of the row with the same primary key.
+// Parameters are numbered in the order of `accessors`, like for inserts.
+//
+// Requires a primary key.
+- (NSString *)updateSQL;
+
+// The SQL selecting all mapped columns, in the order of `accessors`.
+- (NSString *)selectSQLWithPredicate:(NSString *)predicate;
+
+@end
+
+@implementation MTLSQLiteTablePlan
+
++ (instancetype)planForModelClass:(Class)modelClass error:(NSError **)error {
+	NSParameterAssert([modelClass conformsToProtocol:@protocol(MTLSQLiteSerializing)]);
+
+	NSDictionary *columnNamesByPropertyKey = [modelClass SQLiteColumnNamesByPropertyKey];
+	NSSet *propertyKeys = [modelClass propertyKeys];
+
+	for (NSString *key in columnNamesByPropertyKey) {
+		if ([propertyKeys containsObject:key]) continue;
+
+		if (error != NULL) {
+			*error = [NSError mtl_errorWithDomain:MTLSQLiteAdapterErrorDomain code:MTLSQLiteAdapterErrorInvalidMapping descriptionFormat:NSLocalizedString(@"Invalid SQLite mapping", @"") failureReasonFormat:NSLocalizedString(@"%1$@ could not be mapped to SQLite because \"%2$@\" is not a property of %1$@.", @"") arguments:@[ NSStringFromClass(modelClass), key ] userInfo:nil];
+		}
+
+		return nil;
+	}
+
+	NSMutableArray *accessors = [NSMutableArray array];
+	NSMutableArray *columnNames = [NSMutableArray array];
+	NSMutableArray *transformers = [NSMutableArray array];
+
+	for (MTLPropertyAccessor *accessor in [MTLPropertyAccessor accessorsForModelClass:modelClass]) {
+		NSString *columnName = columnNamesByPropertyKey[accessor.key];
+		if (columnName == nil) continue;
+
+		NSValueTransformer *transformer = nil;
+		if ([modelClass respondsToSelector:@selector(SQLiteTransformerForKey:)]) {
+			transformer = [modelClass SQLiteTransformerForKey:accessor.key];
+		}
+
+		[accessors addObject:accessor];
+		[columnNames addObject:columnName];
+		[transformers addObject:transformer ?: NSNull.null];
+	}
+
+	NSMutableArray *primaryKeyColumnNames = [NSMutableArray array];
+	if ([modelClass respondsToSelector:@selector(SQLitePrimaryKeyPropertyKeys)]) {
+		for (NSString *key in [modelClass SQLitePrimaryKeyPropertyKeys]) {
+			NSString *columnName = columnNamesByPropertyKey[key];
+			if (columnName == nil) {
+				if (error != NULL) {
+					*error = [NSError mtl_errorWithDomain:MTLSQLiteAdapterErrorDomain code:MTLSQLiteAdapterErrorInvalidMapping descriptionFormat:NSLocalizedString(@"Invalid SQLite mapping", @"") failureReasonFormat:NSLocalizedString(@"The primary key \"%@\" of %@ has no column.", @"") arguments:@[ key, NSStringFromClass(modelClass) ] userInfo:nil];
+				}
+
+				return nil;
+			}
+
+			[primaryKeyColumnNames addObject:columnName];
+		}
+	}
+
+	MTLSQLiteTablePlan *plan = [[self alloc] init];
+	plan->_modelClass = modelClass;
+	plan->_tableName = [[modelClass SQLiteTableName] copy];
+	plan->_accessors = [accessors copy];
+	plan->_columnNames = [columnNames copy];
+	plan->_transformers = [transformers copy];
+	plan->_primaryKeyColumnNames = [primaryKeyColumnNames copy];
+
+	return plan;
+}
+
+- (NSString *)quotedColumnList {
+	NSMutableArray *quotedNames = [NSMutableArray arrayWithCapacity:self.columnNames.count];
+	for (NSString *name in self.columnNames) {
+		[quotedNames addObject:MTLSQLiteQuotedIdentifier(name)];
+	}
+
+	return [quotedNames componentsJoinedByString:@", "];
+}
+
+// The column names which are updated when a row with the same primary key
+// exists. If every column is part of the primary key, these are set to their
+// current values, so that the statement still matches the row.
+- (NSArray *)updatedColumnNames {
+	NSMutableArray *columnNames = [self.columnNames mutableCopy];
+	[columnNames removeObjectsInArray:self.primaryKeyColumnNames];
+
+	return (columnNames.count > 0 ? columnNames : self.primaryKeyColumnNames);
+}
+
+- (NSString *)insertSQL {
+	NSMutableArray *parameters = [NSMutableArray arrayWithCapacity:self.columnNames.count];
+	for (NSUInteger index = 0; index < self.columnNames.count; index++) {
+		[parameters addObject:[NSString stringWithFormat:@"?%lu", (unsigned long)index + 1]];
+	}
+
+	return [NSString stringWithFormat:@"INSERT INTO %@ (%@) VALUES (%@)", MTLSQLiteQuotedIdentifier(self.tableName), self.quotedColumnList, [parameters componentsJoinedByString:@", "]];
+}
+
+- (NSString *)upsertSQL {
+	NSParameterAssert(self.primaryKeyColumnNames.count > 0);
+
+	NSMutableArray *quotedKeyNames = [NSMutableArray arrayWithCapacity:self.primaryKeyColumnNames.count];
+	for (NSString *name in self.primaryKeyColumnNames) {
+		[quotedKeyNames addObject:MTLSQLiteQuotedIdentifier(name)];
+	}
+
+	NSMutableArray *assignments = [NSMutableArray array];
+	for (NSString *name in self.updatedColumnNames) {
+		NSString *quotedName = MTLSQLiteQuotedIdentifier(name);
+		[assignments addObject:[NSString stringWithFormat:@"%1$@ = excluded.%1$@", quotedName]];
+	}
+
+	return [NSString stringWithFormat:@"%@ ON CONFLICT (%@) DO UPDATE SET %@", self.insertSQL, [quotedKeyNames componentsJoinedByString:@", "], [assignments componentsJoinedByString:@", "]];
+}
+
+- (NSString *)updateSQL {
+	NSParameterAssert(self.primaryKeyColumnNames.count > 0);
+
+	NSString * (^assignment)(NSString *) = ^(NSString *name) {
+		NSUInteger parameter = [self.columnNames indexOfObject:name] + 1;
+		return [NSString stringWithFormat:@"%@ = ?%lu", MTLSQLiteQuotedIdentifier(name), (unsigned long)parameter];
+	};
+
+	NSMutableArray *assignments = [NSMutableArray array];
+	for (NSString *name in self.updatedColumnNames) {
+		[assignments addObject:assignment(name)];
+	}
+
+	NSMutableArray *conditions = [NSMutableArray array];
+	for (NSString *name in self.primaryKeyColumnNames) {
+		[conditions addObject:assignment(name)];
+	}
+
+	return [NSString stringWithFormat:@"UPDATE %@ SET %@ WHERE %@", MTLSQLiteQuotedIdentifier(self.tableName), [assignments componentsJoinedByString:@", "], [conditions componentsJoinedByString:@" AND "]];
+}
+
+- (NSString *)selectSQLWithPredicate:(NSString *)predicate {
+	NSString *SQL = [NSString stringWithFormat:@"SELECT %@ FROM %@", self.quotedColumnList, MTLSQLiteQuotedIdentifier(self.tableName)];
+	if (predicate == nil) return SQL;
+
+	return [SQL stringByAppendingFormat:@" WHERE %@", predicate];
+}
+
+- (NSString *)createTableSQL {
+	NSMutableArray *definitions = [NSMutableArray arrayWithCapacity:self.columnNames.count + 1];
+
+	[self.accessors enumerateObjectsUsingBlock:^(MTLPropertyAccessor *accessor, NSUInteger index, BOOL *stop) {
+		NSString *type = @"";
+
+		if (self.transformers[index] == NSNull.null) {
+			switch (accessor.type) {
+				case MTLPropertyAccessorTypeBool:
+				case MTLPropertyAccessorTypeSignedInteger:
+				case MTLPropertyAccessorTypeUnsignedInteger:
+					type = @" INTEGER";
+					break;
+
+				case MTLPropertyAccessorTypeFloatingPoint:
+					type = @" REAL";
+					break;
+
+				case MTLPropertyAccessorTypeObject: {
+					Class objectClass = accessor.objectClass;
+					if ([objectClass isSubclassOfClass:NSString.class] || [objectClass isSubclassOfClass:NSURL.class]) {
+						type = @" TEXT";
+					} else if ([objectClass isSubclassOfClass:NSData.class]) {
+						type = @" BLOB";
+					} else if ([objectClass isSubclassOfClass:NSDate.class]) {
+						type = @" REAL";
+					} else if ([objectClass isSubclassOfClass:NSNumber.class]) {
+						type = @" NUMERIC";
+					}
+
+					break;
+				}
+
+				case MTLPropertyAccessorTypeUnsupported:
+					break;
+			}
+		}
+
+		[definitions addObject:[MTLSQLiteQuotedIdentifier(self.columnNames[index]) stringByAppendingString:type]];
+	}];
+
+	if (self.primaryKeyColumnNames.count > 0) {
+		NSMutableArray *quotedNames = [NSMutableArray array];
+		for (NSString *name in self.primaryKeyColumnNames) {
+			[quotedNames addObject:MTLSQLiteQuotedIdentifier(name)];
+		}
+
+		[definitions addObject:[NSString stringWithFormat:@"PRIMARY KEY (%@)", [quotedNames componentsJoinedByString:@", "]]];
+	}
+
+	return [NSString stringWithFormat:@"CREATE TABLE IF NOT EXISTS %@ (%@)", MTLSQLiteQuotedIdentifier(self.tableName), [definitions componentsJoinedByString:@", "]];
+}
+
+@end
+
+#pragma mark Binding
+
+// Binds the mapped properties of `model` to the parameters of an insert
+// statement of `plan`, without boxing scalars.
+static BOOL MTLSQLiteBindModel(MTLSQLiteTablePlan *plan, sqlite3_stmt *statement, id model, sqlite3 *database, NSError **error) {
+	NSArray *accessors = plan.accessors;
+	NSArray *transformers = plan.transformers;
+
+	for (NSUInteger index = 0; index < accessors.count; index++) {
+		MTLPropertyAccessor *accessor = accessors[index];
+		NSValueTransformer *transformer = transformers[index];
+		int parameter = (int)index + 1;
+		int result = SQLITE_OK;
+
+		if ((id)transformer == NSNull.null) {
+			switch (accessor.type) {
+				case MTLPropertyAccessorTypeBool:
+				case MTLPropertyAccessorTypeSignedInteger:
+					result = sqlite3_bind_int64(statement, parameter, [accessor signedIntegerValueOfModel:model]);
+					break;
+
+				case MTLPropertyAccessorTypeUnsignedInteger: {
+					// SQLite integers are signed, so larger values would be
+					// stored wrapped around.
+					unsigned long long value = [accessor unsignedIntegerValueOfModel:model];
+					if (value > INT64_MAX) {
+						if (error != NULL) *error = MTLSQLiteUnsupportedValueError(accessor.key, plan.modelClass, @(value));
+						return NO;
+					}
+
+					result = sqlite3_bind_int64(statement, parameter, (sqlite3_int64)value);
+					break;
+				}
+
+				case MTLPropertyAccessorTypeFloatingPoint:
+					result = sqlite3_bind_double(statement, parameter, [accessor doubleValueOfModel:model]);
+					break;
+
+				case MTLPropertyAccessorTypeObject:
+				case MTLPropertyAccessorTypeUnsupported: {
+					id value = [accessor objectValueOfModel:model];
+					result = MTLSQLiteBindObject(statement, parameter, value);
+
+					if (result == SQLITE_MISMATCH) {
+						if (error != NULL) *error = MTLSQLiteUnsupportedValueError(accessor.key, plan.modelClass, value);
+						return NO;
+					}
+
+					break;
+				}
+			}
+		} else {
+			id value = [accessor objectValueOfModel:model];
+
+			if (![transformer.class allowsReverseTransformation]) {
+				if (error != NULL) *error = MTLSQLiteUnsupportedValueError(accessor.key, plan.modelClass, value);
+				return NO;
+			}
+
+			if ([transformer respondsToSelector:@selector(reverseTransformedValue:success:error:)]) {
+				BOOL success = YES;
+				value = [(id<MTLTransformerErrorHandling>)transformer reverseTransformedValue:value success:&success error:error];
+				if (!success) return NO;
+			} else {
+				value = [transformer reverseTransformedValue:value];
+			}
+
+			result = MTLSQLiteBindObject(statement, parameter, value);
+			if (result == SQLITE_MISMATCH) {
+				if (error != NULL) *error = MTLSQLiteUnsupportedValueError(accessor.key, plan.modelClass, value);
+				return NO;
+			}
+		}
+
+		if (result != SQLITE_OK) {
+			if (error != NULL) *error = MTLSQLiteError(database, result);
+			return NO;
+		}
+	}
+
+	return YES;
+}
+
+// Sets the value of one column of the current row on `model`, without boxing
+// scalars.
+static BOOL MTLSQLiteSetColumn(sqlite3_stmt *statement, int column, MTLPropertyAccessor *accessor, NSValueTransformer *transformer, id model, NSError **error) {
+	int columnType = sqlite3_column_type(statement, column);
+	if (columnType == SQLITE_NULL) return YES;
+
+	if ((id)transformer != NSNull.null) {
+		id value = MTLSQLiteColumnObject(statement, column);
+
+		if ([transformer respondsToSelector:@selector(transformedValue:success:error:)]) {
+			BOOL success = YES;
+			value = [(id<MTLTransformerErrorHandling>)transformer transformedValue:value success:&success error:error];
+			if (!success) return NO;
+		} else {
+			value = [transformer transformedValue:value];
+		}
+
+		[accessor setObjectValue:value ofModel:model];
+		return YES;
+	}
+
+	switch (accessor.type) {
+		case MTLPropertyAccessorTypeBool:
+		case MTLPropertyAccessorTypeSignedInteger:
+			if (columnType == SQLITE_FLOAT) {
+				[accessor setDoubleValue:sqlite3_column_double(statement, column) ofModel:model];
+			} else {
+				[accessor setSignedIntegerValue:sqlite3_column_int64(statement, column) ofModel:model];
+			}
+
+			return YES;
+
+		case MTLPropertyAccessorTypeUnsignedInteger:
+			if (columnType == SQLITE_FLOAT) {
+				[accessor setDoubleValue:sqlite3_column_double(statement, column) ofModel:model];
+			} else {
+				sqlite3_int64 value = sqlite3_column_int64(statement, column);
+				if (value < 0) {
+					if (error != NULL) *error = MTLSQLiteUnsupportedValueError(accessor.key, [model class], @(value));
+					return NO;
+				}
+
+				[accessor setUnsignedIntegerValue:(unsigned long long)value ofModel:model];
+			}
+
+			return YES;
+
+		case MTLPropertyAccessorTypeFloatingPoint:
+			[accessor setDoubleValue:sqlite3_column_double(statement, column) ofModel:model];
+			return YES;
+
+		case MTLPropertyAccessorTypeObject:
+		case MTLPropertyAccessorTypeUnsupported:
+			break;
+	}
+
+	Class objectClass = accessor.objectClass;
+	id value = nil;
+
+	if ([objectClass isSubclassOfClass:NSDate.class]) {
+		// Text would otherwise be parsed as a number, silently turning
+		// anything but a number into 1970.
+		if (columnType != SQLITE_INTEGER && columnType != SQLITE_FLOAT) {
+			if (error != NULL) *error = MTLSQLiteUnsupportedValueError(accessor.key, [model class], MTLSQLiteColumnObject(statement, column));
+			return NO;
+		}
+
+		value = [NSDate dateWithTimeIntervalSince1970:sqlite3_column_double(statement, column)];
+	} else if ([objectClass isSubclassOfClass:NSURL.class]) {
+		id string = MTLSQLiteColumnObject(statement, column);
+		if ([string isKindOfClass:NSString.class]) value = [NSURL URLWithString:string];
+	} else {
+		value = MTLSQLiteColumnObject(statement, column);
+	}
+
+	if (accessor.type == MTLPropertyAccessorTypeUnsupported || (objectClass != Nil && ![value isKindOfClass:objectClass])) {
+		if (error != NULL) *error = MTLSQLiteUnsupportedValueError(accessor.key, [model class], value);
+		return NO;
+	}
+
+	[accessor setObjectValue:value ofModel:model];
+	return YES;
+}
+
+@interface MTLSQLiteAdapter () {
+	sqlite3 *_database;
+}
+
+// Maps model classes to MTLSQLiteTablePlan objects. Only accessed while
+// synchronized on the receiver.
+@property (nonatomic, strong, readonly) NSMutableDictionary *plansByModelClass;
+
+// Caches MTLSQLiteStatement objects keyed by @[ modelClass, predicate ].
+@property (nonatomic, strong, readonly) MTLLRUCache *predicateStatements;
+
+@end
+
+@implementation MTLSQLiteAdapter
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	return [self initWithURL:nil error:NULL];
+}
+
+- (instancetype)initWithURL:(NSURL *)URL error:(NSError **)error {
+	NSParameterAssert(URL == nil || URL.isFileURL);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_URL = [URL copy];
+	_plansByModelClass = [[NSMutableDictionary alloc] init];
+	_predicateStatements = [[MTLLRUCache alloc] initWithCountLimit:MTLSQLiteAdapterPredicateStatementLimit totalCostLimit:0];
+
+	const char *path = (URL != nil ? URL.fileSystemRepresentation : ":memory:");
+	int result = sqlite3_open_v2(path, &_database, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX, NULL);
+	if (result != SQLITE_OK) {
+		if (error != NULL) *error = MTLSQLiteError(_database, result);
+		return nil;
+	}
+
+	sqlite3_busy_timeout(_database, 1000);
+
+	return self;
+}
+
+- (void)dealloc {
+	// Cached statements may outlive the connection, which is closed once they
+	// are finalized.
+	sqlite3_close_v2(_database);
+}
+
+#pragma mark Plans
+
+// Must be called while synchronized on the receiver.
+- (MTLSQLiteTablePlan *)planForModelClass:(Class)modelClass error:(NSError **)error {
+	MTLSQLiteTablePlan *plan = self.plansByModelClass[modelClass];
+	if (plan != nil) return plan;
+
+	plan = [MTLSQLiteTablePlan planForModelClass:modelClass error:error];
+	if (plan != nil) self.plansByModelClass[(id<NSCopying>)modelClass] = plan;
+
+	return plan;
+}
+
+#pragma mark Execution
+
+- (BOOL)executeSQL:(NSString *)SQL error:(NSError **)error {
+	NSParameterAssert(SQL != nil);
+
+	@synchronized (self) {
+		int result = sqlite3_exec(_database, SQL.UTF8String, NULL, NULL, NULL);
+		if (result != SQLITE_OK) {
+			if (error != NULL) *error = MTLSQLiteError(_database, result);
+			return NO;
+		}
+
+		return YES;
+	}
+}
+
+- (BOOL)createTableForModelClass:(Class)modelClass error:(NSError **)error {
+	NSParameterAssert(modelClass != nil);
+
+	@synchronized (self) {
+		MTLSQLiteTablePlan *plan = [self planForModelClass:modelClass error:error];
+		if (plan == nil) return NO;
+
+		return [self executeSQL:plan.createTableSQL error:error];
+	}
+}
+
+- (BOOL)performTransaction:(BOOL (^)(NSError **error))block error:(NSError **)error {
+	NSParameterAssert(block != nil);
+
+	@synchronized (self) {
+		// Savepoints behave like transactions at the outermost level, and can
+		// also be nested.
+		if (![self executeSQL:@"SAVEPOINT mtl_transaction" error:error]) return NO;
+
+		NSError *blockError = nil;
+		if (block(&blockError)) {
+			if ([self executeSQL:@"RELEASE mtl_transaction" error:&blockError]) return YES;
+		}
+
+		sqlite3_exec(_database, "ROLLBACK TO mtl_transaction; RELEASE mtl_transaction", NULL, NULL, NULL);
+
+		if (error != NULL) *error = blockError;
+		return NO;
+	}
+}
+
+#pragma mark Writing
+
+// Binds `model` to `statement` and executes it.
+//
+// changed - If not NULL, this is set to whether a row was inserted or updated.
+//
+// Must be called while synchronized on the receiver.
+- (BOOL)executeStatement:(MTLSQLiteStatement *)statement plan:(MTLSQLiteTablePlan *)plan model:(id<MTLSQLiteSerializing>)model changed:(BOOL *)changed error:(NSError **)error {
+	sqlite3_stmt *preparedStatement = statement->_statement;
+	BOOL success = MTLSQLiteBindModel(plan, preparedStatement, model, _database, error);
+
+	if (success) {
+		int result = sqlite3_step(preparedStatement);
+		if (result != SQLITE_DONE) {
+			if (error != NULL) *error = MTLSQLiteError(_database, result);
+			success = NO;
+		} else if (changed != NULL) {
+			*changed = sqlite3_changes(_database) > 0;
+		}
+	}
+
+	sqlite3_reset(preparedStatement);
+	sqlite3_clear_bindings(preparedStatement);
+
+	return success;
+}
+
+// Must be called while synchronized on the receiver.
+- (BOOL)writeModel:(id<MTLSQLiteSerializing>)model saving:(BOOL)saving error:(NSError **)error {
+	MTLSQLiteTablePlan *plan = [self planForModelClass:model.class error:error];
+	if (plan == nil) return NO;
+
+	// Without a primary key, there is no existing row to update.
+	if (saving && plan.primaryKeyColumnNames.count > 0) {
+		// Unlike INSERT OR REPLACE, updating in place keeps the rowid and any
+		// unmapped columns of the row, and does not run delete triggers or
+		// foreign key actions.
+		if (sqlite3_libversion_number() >= 3024000) {
+			if (plan.upsertStatement == nil) {
+				plan.upsertStatement = [MTLSQLiteStatement statementWithSQL:plan.upsertSQL database:_database error:error];
+				if (plan.upsertStatement == nil) return NO;
+			}
+
+			return [self executeStatement:plan.upsertStatement plan:plan model:model changed:NULL error:error];
+		}
+
+		// Older versions do not support upserts, so the row is updated
+		// first, and only inserted if it did not exist.
+		if (plan.updateStatement == nil) {
+			plan.updateStatement = [MTLSQLiteStatement statementWithSQL:plan.updateSQL database:_database error:error];
+			if (plan.updateStatement == nil) return NO;
+		}
+
+		BOOL updated = NO;
+		if (![self executeStatement:plan.updateStatement plan:plan model:model changed:&updated error:error]) return NO;
+		if (updated) return YES;
+	}
+
+	if (plan.insertStatement == nil) {
+		plan.insertStatement = [MTLSQLiteStatement statementWithSQL:plan.insertSQL database:_database error:error];
+		if (plan.insertStatement == nil) return NO;
+	}
+
+	return [self executeStatement:plan.insertStatement plan:plan model:model changed:NULL error:error];
+}
+
+- (BOOL)writeModels:(NSArray *)models saving:(BOOL)saving error:(NSError **)error {
+	NSParameterAssert(models != nil);
+
+	return [self performTransaction:^(NSError **transactionError) {
+		for (id<MTLSQLiteSerializing> model in models) {
+			if (![self writeModel:model saving:saving error:transactionError]) return NO;
+		}
+
+		return YES;
+	} error:error];
+}
+
+- (BOOL)insertModels:(NSArray *)models error:(NSError **)error {
+	return [self writeModels:models saving:NO error:error];
+}
+
+- (BOOL)saveModels:(NSArray *)models error:(NSError **)error {
+	return [self writeModels:models saving:YES error:error];
+}
+
+#pragma mark Reading
+
+- (NSArray *)modelsOfClass:(Class)modelClass where:(NSString *)predicate arguments:(NSArray *)arguments error:(NSError **)error {
+	NSParameterAssert(modelClass != nil);
+
+	@synchronized (self) {
+		MTLSQLiteTablePlan *plan = [self planForModelClass:modelClass error:error];
+		if (plan == nil) return nil;
+
+		MTLSQLiteStatement *statement = nil;
+		if (predicate == nil) {
+			statement = plan.selectStatement;
+		} else {
+			statement = [self.predicateStatements objectForKey:@[ modelClass, predicate ]];
+		}
+
+		if (statement == nil) {
+			statement = [MTLSQLiteStatement statementWithSQL:[plan selectSQLWithPredicate:predicate] database:_database error:error];
+			if (statement == nil) return nil;
+
+			if (predicate == nil) {
+				plan.selectStatement = statement;
+			} else {
+				[self.predicateStatements setObject:statement forKey:@[ modelClass, predicate ] cost:1];
+			}
+		}
+
+		sqlite3_stmt *preparedStatement = statement->_statement;
+		@onExit {
+			sqlite3_reset(preparedStatement);
+			sqlite3_clear_bindings(preparedStatement);
+		};
+
+		for (NSUInteger index = 0; index < arguments.count; index++) {
+			int result = MTLSQLiteBindObject(preparedStatement, (int)index + 1, arguments[index]);
+			if (result == SQLITE_MISMATCH) {
+				if (error != NULL) *error = MTLSQLiteUnsupportedValueError([NSString stringWithFormat:@"argument %lu", (unsigned long)index + 1], modelClass, arguments[index]);
+				return nil;
+			} else if (result != SQLITE_OK) {
+				if (error != NULL) *error = MTLSQLiteError(_database, result);
+				return nil;
+			}
+		}
+
+		NSArray *accessors = plan.accessors;
+		NSArray *transformers = plan.transformers;
+		NSUInteger columnCount = accessors.count;
+		NSMutableArray *models = [NSMutableArray array];
+
+		while (YES) {
+			int result = sqlite3_step(preparedStatement);
+			if (result == SQLITE_DONE) break;
+
+			if (result != SQLITE_ROW) {
+				if (error != NULL) *error = MTLSQLiteError(_database, result);
+				return nil;
+			}
+
+			id<MTLModel> model = [[modelClass alloc] init];
+
+			for (NSUInteger column = 0; column < columnCount; column++) {
+				MTLPropertyAccessor *accessor = accessors[column];
+				if (!accessor.writable) continue;
+
+				if (!MTLSQLiteSetColumn(preparedStatement, (int)column, accessor, transformers[column], model, error)) return nil;
+			}
+
+			if (![model validate:error]) return nil;
+
+			[models addObject:model];
+		}
+
+		return models;
+	}
+}
+
+@end
@@ -0,0 +1,644 @@
+//
+//  MTLSparseModel.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <objc/runtime.h>
+
+#import "MTLEXTRuntimeExtensions.h"
+#import "MTLEXTScope.h"
+#import "MTLSparseModel.h"
+
+// Associated with sparse model classes to cache their MTLSparseModelLayout.
+static void *MTLSparseModelCachedLayoutKey = &MTLSparseModelCachedLayoutKey;
+
+// Associated with sparse model classes to cache their
+// MTLSparseModelStorageBehaviors.
+static void *MTLSparseModelCachedStorageBehaviorsKey = &MTLSparseModelCachedStorageBehaviorsKey;
+
+// The number of slots described by each word of a presence bitmap.
+static const NSUInteger MTLSparseModelBitsPerWord = 64;
+
+// Expands `CASE` for every scalar type encoding which can be stored sparsely,
+// with the encoding character, the C type and the NSNumber method unboxing it.
+#define MTLSparseModelScalarTypes(CASE) \
+	CASE('c', char, charValue) \
+	CASE('s', short, shortValue) \
+	CASE('i', int, intValue) \
+	CASE('l', long, longValue) \
+	CASE('q', long long, longLongValue) \
+	CASE('C', unsigned char, unsignedCharValue) \
+	CASE('S', unsigned short, unsignedShortValue) \
+	CASE('I', unsigned int, unsignedIntValue) \
+	CASE('L', unsigned long, unsignedLongValue) \
+	CASE('Q', unsigned long long, unsignedLongLongValue) \
+	CASE('B', bool, boolValue) \
+	CASE('f', float, floatValue) \
+	CASE('d', double, doubleValue)
+
+// Returns the encoding a property of the given type is stored with, which is
+// '@' for objects, or 0 if it cannot be stored sparsely.
+static char MTLSparseModelEncodingOfType(const char *type) {
+	if (type[0] == '@') return '@';
+	if (strlen(type) != 1 || strchr("csilqCSILQBfd", type[0]) == NULL) return 0;
+
+	return type[0];
+}
+
+// Returns the value an unpopulated slot with the given encoding has in a
+// -dictionaryValue.
+static id MTLSparseModelDefaultValue(char encoding) {
+	switch (encoding) {
+		#define MTLSparseModelDefaultValueCase(CHARACTER, TYPE, METHOD) \
+			case CHARACTER: \
+				return @((TYPE)0);
+
+		MTLSparseModelScalarTypes(MTLSparseModelDefaultValueCase)
+
+		#undef MTLSparseModelDefaultValueCase
+
+		default:
+			return NSNull.null;
+	}
+}
+
+@interface MTLModel (MTLSparseModelPrivate)
+
+// Implemented by MTLModel.
++ (NSSet *)permanentPropertyKeys;
+- (NSDictionary *)populatedDictionaryValue;
+
+@end
+
+// Describes where the sparse properties of a model class are stored.
+//
+// The slots of a subclass start with those of its superclass, so that the
+// accessors of a superclass work the same for all of its subclasses.
+@interface MTLSparseModelLayout : NSObject
+
+- (instancetype)initWithModelClass:(Class)modelClass superclassLayout:(MTLSparseModelLayout *)superclassLayout;
+
+// The key of the property stored in each slot.
+@property (nonatomic, copy, readonly) NSArray *keys;
+
+// The slot of each sparse property, keyed by property key.
+@property (nonatomic, copy, readonly) NSDictionary *slotsByKey;
+
+// The accessors of the sparse properties, keyed by selector name. Each value is
+// twice the slot of the property, plus one for setters.
+@property (nonatomic, copy, readonly) NSDictionary *accessorsBySelectorName;
+
+// The encoding of each slot, as returned by MTLSparseModelEncodingOfType().
+@property (nonatomic, copy, readonly) NSData *encodings;
+
+// Whether each slot copies the objects it is set to, as a BOOL per slot.
+@property (nonatomic, copy, readonly) NSData *copyingSlots;
+
+// The number of words in the presence bitmap of an instance.
+@property (nonatomic, assign, readonly) NSUInteger wordCount;
+
+@end
+
+// Caches which slots and other properties of a sparse model class take part in
+// which of MTLModel's behaviors, according to its
+// +storageBehaviorForPropertyWithKey:.
+@interface MTLSparseModelStorageBehaviors : NSObject
+
+- (instancetype)initWithModelClass:(Class)modelClass layout:(MTLSparseModelLayout *)layout;
+
+// The slots of the sparse properties in +propertyKeys, as a presence bitmap.
+@property (nonatomic, copy, readonly) NSData *includedMask;
+
+// The slots of the sparse properties with permanent storage, as a presence
+// bitmap.
+@property (nonatomic, copy, readonly) NSData *permanentMask;
+
+// The keys of the properties in +propertyKeys which are not stored sparsely.
+@property (nonatomic, copy, readonly) NSArray *regularKeys;
+
+// The keys of the properties with permanent storage which are not stored
+// sparsely.
+@property (nonatomic, copy, readonly) NSArray *regularPermanentKeys;
+
+// The values all included sparse properties have in a -dictionaryValue when
+// they are unpopulated.
+@property (nonatomic, copy, readonly) NSDictionary *defaultDictionaryValue;
+
+@end
+
+@interface MTLSparseModel () {
+	// The layout of the receiver's class, once a value has been stored.
+	MTLSparseModelLayout *_layout;
+
+	// One bit per slot of the layout, set for the slots which hold a value, or
+	// NULL if no value has been stored yet.
+	uint64_t *_presence;
+
+	// The values of the populated slots, ordered by slot, each retained.
+	CFTypeRef *_values;
+	NSUInteger _valueCount;
+	NSUInteger _valueCapacity;
+}
+
+// Returns the layout of the receiver's sparse properties.
++ (MTLSparseModelLayout *)sparseLayout;
+
+// Returns the storage behaviors of the receiver's sparse properties.
++ (MTLSparseModelStorageBehaviors *)sparseStorageBehaviors;
+
+@end
+
+@implementation MTLSparseModelLayout
+
+- (instancetype)initWithModelClass:(Class)modelClass superclassLayout:(MTLSparseModelLayout *)superclassLayout {
+	NSParameterAssert(modelClass != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	NSMutableArray *keys = [NSMutableArray arrayWithArray:superclassLayout.keys ?: @[]];
+	NSMutableDictionary *slotsByKey = [NSMutableDictionary dictionaryWithDictionary:superclassLayout.slotsByKey ?: @{}];
+	NSMutableDictionary *accessors = [NSMutableDictionary dictionaryWithDictionary:superclassLayout.accessorsBySelectorName ?: @{}];
+	NSMutableData *encodings = [NSMutableData dataWithData:superclassLayout.encodings ?: [NSData data]];
+	NSMutableData *copyingSlots = [NSMutableData dataWithData:superclassLayout.copyingSlots ?: [NSData data]];
+
+	unsigned count = 0;
+	objc_property_t *properties = class_copyPropertyList(modelClass, &count);
+	@onExit {
+		free(properties);
+	};
+
+	// Assign slots in key order, so that they don't depend on the order of
+	// declarations.
+	NSMutableArray *propertyKeys = [NSMutableArray arrayWithCapacity:count];
+	for (unsigned index = 0; index < count; index++) {
+		[propertyKeys addObject:@(property_getName(properties[index]))];
+	}
+
+	[propertyKeys sortUsingSelector:@selector(compare:)];
+
+	for (NSString *key in propertyKeys) {
+		// Redeclared properties keep the slot of the superclass.
+		if (slotsByKey[key] != nil) continue;
+
+		objc_property_t property = class_getProperty(modelClass, key.UTF8String);
+		if (property == NULL) continue;
+
+		mtl_propertyAttributes *attributes = mtl_copyPropertyAttributes(property);
+		@onExit {
+			free(attributes);
+		};
+
+		if (!attributes->dynamic || attributes->weak) continue;
+
+		char encoding = MTLSparseModelEncodingOfType(attributes->type);
+		if (encoding == 0) continue;
+
+		NSUInteger slot = keys.count;
+		BOOL copies = (attributes->memoryManagementPolicy == mtl_propertyMemoryManagementPolicyCopy);
+
+		[keys addObject:key];
+		slotsByKey[key] = @(slot);
+		[encodings appendBytes:&encoding length:sizeof(encoding)];
+		[copyingSlots appendBytes:&copies length:sizeof(copies)];
+
+		accessors[NSStringFromSelector(attributes->getter)] = @(slot * 2);
+		accessors[NSStringFromSelector(attributes->setter)] = @(slot * 2 + 1);
+	}
+
+	_keys = [keys copy];
+	_slotsByKey = [slotsByKey copy];
+	_accessorsBySelectorName = [accessors copy];
+	_encodings = [encodings copy];
+	_copyingSlots = [copyingSlots copy];
+	_wordCount = (keys.count + MTLSparseModelBitsPerWord - 1) / MTLSparseModelBitsPerWord;
+
+	return self;
+}
+
+@end
+
+@implementation MTLSparseModelStorageBehaviors
+
+- (instancetype)initWithModelClass:(Class)modelClass layout:(MTLSparseModelLayout *)layout {
+	NSParameterAssert(modelClass != nil);
+	NSParameterAssert(layout != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	NSMutableData *includedMask = [NSMutableData dataWithLength:layout.wordCount * sizeof(uint64_t)];
+	NSMutableData *permanentMask = [NSMutableData dataWithLength:layout.wordCount * sizeof(uint64_t)];
+	uint64_t *includedWords = includedMask.mutableBytes;
+	uint64_t *permanentWords = permanentMask.mutableBytes;
+
+	NSMutableArray *regularKeys = [NSMutableArray array];
+	NSMutableArray *regularPermanentKeys = [NSMutableArray array];
+	NSMutableDictionary *defaultDictionaryValue = [NSMutableDictionary dictionary];
+
+	const char *encodings = layout.encodings.bytes;
+	NSSet *permanentKeys = [modelClass permanentPropertyKeys];
+
+	for (NSString *key in [modelClass propertyKeys]) {
+		BOOL permanent = [permanentKeys containsObject:key];
+
+		NSNumber *slotNumber = layout.slotsByKey[key];
+		if (slotNumber == nil) {
+			[regularKeys addObject:key];
+			if (permanent) [regularPermanentKeys addObject:key];
+
+			continue;
+		}
+
+		NSUInteger slot = slotNumber.unsignedIntegerValue;
+		uint64_t bit = 1ULL << (slot % MTLSparseModelBitsPerWord);
+
+		includedWords[slot / MTLSparseModelBitsPerWord] |= bit;
+		if (permanent) permanentWords[slot / MTLSparseModelBitsPerWord] |= bit;
+
+		defaultDictionaryValue[key] = MTLSparseModelDefaultValue(encodings[slot]);
+	}
+
+	_includedMask = [includedMask copy];
+	_permanentMask = [permanentMask copy];
+	_regularKeys = [regularKeys copy];
+	_regularPermanentKeys = [regularPermanentKeys copy];
+	_defaultDictionaryValue = [defaultDictionaryValue copy];
+
+	return self;
+}
+
+@end
+
+@implementation MTLSparseModel
+
+#pragma mark Storage
+
+// Returns the index in `_values` at which the value of `slot` is or would be
+// stored.
+static NSUInteger MTLSparseModelValueIndex(MTLSparseModel *model, NSUInteger slot) {
+	NSUInteger word = slot / MTLSparseModelBitsPerWord;
+	NSUInteger index = 0;
+
+	for (NSUInteger precedingWord = 0; precedingWord < word; precedingWord++) {
+		index += (NSUInteger)__builtin_popcountll(model->_presence[precedingWord]);
+	}
+
+	uint64_t precedingBits = model->_presence[word] & ((1ULL << (slot % MTLSparseModelBitsPerWord)) - 1);
+	return index + (NSUInteger)__builtin_popcountll(precedingBits);
+}
+
+// Returns the value of `slot`, or nil if the slot is unpopulated.
+static id MTLSparseModelValueForSlot(MTLSparseModel *model, NSUInteger slot) {
+	if (model->_presence == NULL) return nil;
+
+	uint64_t bit = 1ULL << (slot % MTLSparseModelBitsPerWord);
+	if ((model->_presence[slot / MTLSparseModelBitsPerWord] & bit) == 0) return nil;
+
+	return (__bridge id)model->_values[MTLSparseModelValueIndex(model, slot)];
+}
+
+// Stores `value` in `slot`, or depopulates the slot if `value` is nil.
+static void MTLSparseModelSetValueForSlot(MTLSparseModel *model, NSUInteger slot, id value) {
+	if (model->_presence == NULL) {
+		if (value == nil) return;
+
+		model->_layout = [model.class sparseLayout];
+		model->_presence = calloc(model->_layout.wordCount, sizeof(*model->_presence));
+	}
+
+	uint64_t *word = &model->_presence[slot / MTLSparseModelBitsPerWord];
+	uint64_t bit = 1ULL << (slot % MTLSparseModelBitsPerWord);
+	NSUInteger index = MTLSparseModelValueIndex(model, slot);
+
+	if ((*word & bit) != 0) {
+		// Released last, in case it is the new value.
+		CFTypeRef oldValue = model->_values[index];
+
+		if (value != nil) {
+			model->_values[index] = CFBridgingRetain(value);
+		} else {
+			memmove(&model->_values[index], &model->_values[index + 1], (model->_valueCount - index - 1) * sizeof(*model->_values));
+			model->_valueCount--;
+			*word &= ~bit;
+		}
+
+		CFRelease(oldValue);
+		return;
+	}
+
+	if (value == nil) return;
+
+	if (model->_valueCount == model->_valueCapacity) {
+		model->_valueCapacity = MAX(model->_valueCapacity * 2, (NSUInteger)4);
+		model->_values = realloc(model->_values, model->_valueCapacity * sizeof(*model->_values));
+	}
+
+	memmove(&model->_values[index + 1], &model->_values[index], (model->_valueCount - index) * sizeof(*model->_values));
+	model->_values[index] = CFBridgingRetain(value);
+	model->_valueCount++;
+	*word |= bit;
+}
+
+// Depopulates all slots.
+static void MTLSparseModelRemoveAllValues(MTLSparseModel *model) {
+	for (NSUInteger index = 0; index < model->_valueCount; index++) {
+		CFRelease(model->_values[index]);
+	}
+
+	model->_valueCount = 0;
+	if (model->_presence != NULL) memset(model->_presence, 0, model->_layout.wordCount * sizeof(*model->_presence));
+}
+
+// Invokes `block` with the slot and value of every populated slot which is
+// also set in `mask`, in slot order.
+static void MTLSparseModelEnumerateValues(MTLSparseModel *model, NSData *mask, void (^block)(NSUInteger slot, id value)) {
+	if (model->_presence == NULL) return;
+
+	const uint64_t *maskWords = mask.bytes;
+	NSUInteger index = 0;
+
+	for (NSUInteger word = 0; word < model->_layout.wordCount; word++) {
+		uint64_t bits = model->_presence[word];
+
+		while (bits != 0) {
+			NSUInteger bit = (NSUInteger)__builtin_ctzll(bits);
+			bits &= bits - 1;
+
+			if ((maskWords[word] & (1ULL << bit)) != 0) {
+				block(word * MTLSparseModelBitsPerWord + bit, (__bridge id)model->_values[index]);
+			}
+
+			index++;
+		}
+	}
+}
+
+// Returns whether two models of the same class have equal values in all slots
+// which are set in `mask`.
+static BOOL MTLSparseModelValuesAreEqual(MTLSparseModel *model, MTLSparseModel *otherModel, NSData *mask) {
+	const uint64_t *maskWords = mask.bytes;
+	NSUInteger wordCount = mask.length / sizeof(*maskWords);
+	NSUInteger index = 0;
+	NSUInteger otherIndex = 0;
+
+	for (NSUInteger word = 0; word < wordCount; word++) {
+		uint64_t bits = (model->_presence != NULL ? model->_presence[word] : 0);
+		uint64_t otherBits = (otherModel->_presence != NULL ? otherModel->_presence[word] : 0);
+
+		if (((bits ^ otherBits) & maskWords[word]) != 0) return NO;
+
+		uint64_t remainingBits = bits | otherBits;
+		while (remainingBits != 0) {
+			uint64_t bit = remainingBits & -remainingBits;
+			remainingBits &= remainingBits - 1;
+
+			if ((maskWords[word] & bit) != 0) {
+				id value = (__bridge id)model->_values[index];
+				id otherValue = (__bridge id)otherModel->_values[otherIndex];
+
+				if (value != otherValue && ![value isEqual:otherValue]) return NO;
+			}
+
+			if ((bits & bit) != 0) index++;
+			if ((otherBits & bit) != 0) otherIndex++;
+		}
+	}
+
+	return YES;
+}
+
+#pragma mark Accessors
+
+// Returns an implementation of the getter of `slot`.
+static IMP MTLSparseModelGetterForSlot(NSUInteger slot, char encoding) {
+	switch (encoding) {
+		case '@':
+			return imp_implementationWithBlock(^ id (MTLSparseModel *model) {
+				return MTLSparseModelValueForSlot(model, slot);
+			});
+
+		#define MTLSparseModelGetterCase(CHARACTER, TYPE, METHOD) \
+			case CHARACTER: \
+				return imp_implementationWithBlock(^ TYPE (MTLSparseModel *model) { \
+					return [MTLSparseModelValueForSlot(model, slot) METHOD]; \
+				});
+
+		MTLSparseModelScalarTypes(MTLSparseModelGetterCase)
+
+		#undef MTLSparseModelGetterCase
+
+		default:
+			return NULL;
+	}
+}
+
+// Returns an implementation of the setter of `slot`.
+//
+// Scalars equal to zero depopulate the slot, just like nil objects, so that
+// equal models always populate the same slots.
+static IMP MTLSparseModelSetterForSlot(NSUInteger slot, char encoding, BOOL copies) {
+	switch (encoding) {
+		case '@':
+			if (copies) {
+				return imp_implementationWithBlock(^(MTLSparseModel *model, id value) {
+					MTLSparseModelSetValueForSlot(model, slot, [value copy]);
+				});
+			}
+
+			return imp_implementationWithBlock(^(MTLSparseModel *model, id value) {
+				MTLSparseModelSetValueForSlot(model, slot, value);
+			});
+
+		#define MTLSparseModelSetterCase(CHARACTER, TYPE, METHOD) \
+			case CHARACTER: \
+				return imp_implementationWithBlock(^(MTLSparseModel *model, TYPE value) { \
+					MTLSparseModelSetValueForSlot(model, slot, (value != 0 ? @(value) : nil)); \
+				});
+
+		MTLSparseModelScalarTypes(MTLSparseModelSetterCase)
+
+		#undef MTLSparseModelSetterCase
+
+		default:
+			return NULL;
+	}
+}
+
++ (BOOL)resolveInstanceMethod:(SEL)selector {
+	MTLSparseModelLayout *layout = self.sparseLayout;
+
+	NSNumber *accessor = layout.accessorsBySelectorName[NSStringFromSelector(selector)];
+	if (accessor == nil) return [super resolveInstanceMethod:selector];
+
+	NSUInteger slot = accessor.unsignedIntegerValue / 2;
+	BOOL isSetter = (accessor.unsignedIntegerValue % 2 == 1);
+	char encoding = ((const char *)layout.encodings.bytes)[slot];
+
+	if (isSetter) {
+		BOOL copies = ((const BOOL *)layout.copyingSlots.bytes)[slot];
+		NSString *types = [NSString stringWithFormat:@"v@:%c", encoding];
+
+		class_addMethod(self, selector, MTLSparseModelSetterForSlot(slot, encoding, copies), types.UTF8String);
+	} else {
+		NSString *types = [NSString stringWithFormat:@"%c@:", encoding];
+
+		class_addMethod(self, selector, MTLSparseModelGetterForSlot(slot, encoding), types.UTF8String);
+	}
+
+	return YES;
+}
+
+#pragma mark Lifecycle
+
+- (void)dealloc {
+	for (NSUInteger index = 0; index < _valueCount; index++) {
+		CFRelease(_values[index]);
+	}
+
+	free(_values);
+	free(_presence);
+}
+
+#pragma mark Reflection
+
++ (MTLSparseModelLayout *)sparseLayout {
+	MTLSparseModelLayout *cachedLayout = objc_getAssociatedObject(self, MTLSparseModelCachedLayoutKey);
+	if (cachedLayout != nil) return cachedLayout;
+
+	MTLSparseModelLayout *superclassLayout = (self == MTLSparseModel.class ? nil : [self.superclass sparseLayout]);
+	MTLSparseModelLayout *layout = [[MTLSparseModelLayout alloc] initWithModelClass:self superclassLayout:superclassLayout];
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(self, MTLSparseModelCachedLayoutKey, layout, OBJC_ASSOCIATION_RETAIN);
+
+	return layout;
+}
+
++ (MTLSparseModelStorageBehaviors *)sparseStorageBehaviors {
+	MTLSparseModelStorageBehaviors *cachedBehaviors = objc_getAssociatedObject(self, MTLSparseModelCachedStorageBehaviorsKey);
+	if (cachedBehaviors != nil) return cachedBehaviors;
+
+	MTLSparseModelStorageBehaviors *behaviors = [[MTLSparseModelStorageBehaviors alloc] initWithModelClass:self layout:self.sparseLayout];
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(self, MTLSparseModelCachedStorageBehaviorsKey, behaviors, OBJC_ASSOCIATION_RETAIN);
+
+	return behaviors;
+}
+
++ (NSArray *)sparsePropertyKeys {
+	return [self.sparseLayout.keys sortedArrayUsingSelector:@selector(compare:)];
+}
+
+- (NSUInteger)populatedSparsePropertyCount {
+	return _valueCount;
+}
+
+#pragma mark MTLModel
+
++ (MTLPropertyStorage)storageBehaviorForPropertyWithKey:(NSString *)propertyKey {
+	// MTLModel ignores readonly properties without instance variables, which
+	// includes all readonly sparse properties.
+	if (self.sparseLayout.slotsByKey[propertyKey] != nil) return MTLPropertyStoragePermanent;
+
+	return [super storageBehaviorForPropertyWithKey:propertyKey];
+}
+
+- (NSDictionary *)dictionaryValue {
+	MTLSparseModelStorageBehaviors *behaviors = self.class.sparseStorageBehaviors;
+	NSArray *keys = self.class.sparseLayout.keys;
+
+	NSMutableDictionary *dictionaryValue = [behaviors.defaultDictionaryValue mutableCopy];
+	MTLSparseModelEnumerateValues(self, behaviors.includedMask, ^(NSUInteger slot, id value) {
+		dictionaryValue[keys[slot]] = value;
+	});
+
+	if (behaviors.regularKeys.count > 0) {
+		[dictionaryValue addEntriesFromDictionary:[self dictionaryWithValuesForKeys:behaviors.regularKeys]];
+	}
+
+	return dictionaryValue;
+}
+
+- (NSDictionary *)populatedDictionaryValue {
+	// Omits unpopulated sparse properties, so that archives only grow with the
+	// populated ones.
+	MTLSparseModelStorageBehaviors *behaviors = self.class.sparseStorageBehaviors;
+	NSArray *keys = self.class.sparseLayout.keys;
+
+	NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:_valueCount + behaviors.regularKeys.count];
+	MTLSparseModelEnumerateValues(self, behaviors.includedMask, ^(NSUInteger slot, id value) {
+		dictionaryValue[keys[slot]] = value;
+	});
+
+	if (behaviors.regularKeys.count > 0) {
+		[dictionaryValue addEntriesFromDictionary:[self dictionaryWithValuesForKeys:behaviors.regularKeys]];
+	}
+
+	return dictionaryValue;
+}
+
+#pragma mark NSCopying
+
+- (instancetype)copyWithZone:(NSZone *)zone {
+	if (self.class.instancesAreImmutable) return self;
+
+	MTLSparseModelStorageBehaviors *behaviors = self.class.sparseStorageBehaviors;
+
+	// Like MTLModel, replace anything -init may have set.
+	MTLSparseModel *copy = [[self.class allocWithZone:zone] init];
+	MTLSparseModelRemoveAllValues(copy);
+
+	MTLSparseModelEnumerateValues(self, behaviors.includedMask, ^(NSUInteger slot, id value) {
+		MTLSparseModelSetValueForSlot(copy, slot, value);
+	});
+
+	if (behaviors.regularKeys.count > 0) {
+		[copy setValuesForKeysWithDictionary:[self dictionaryWithValuesForKeys:behaviors.regularKeys]];
+	}
+
+	return copy;
+}
+
+#pragma mark NSObject
+
+- (NSUInteger)hash {
+	MTLSparseModelStorageBehaviors *behaviors = self.class.sparseStorageBehaviors;
+
+	__block NSUInteger value = 0;
+	MTLSparseModelEnumerateValues(self, behaviors.permanentMask, ^(NSUInteger slot, id slotValue) {
+		value ^= [slotValue hash];
+	});
+
+	for (NSString *key in behaviors.regularPermanentKeys) {
+		value ^= [[self valueForKey:key] hash];
+	}
+
+	return value;
+}
+
+- (BOOL)isEqual:(MTLSparseModel *)model {
+	if (self == model) return YES;
+	if (![model isMemberOfClass:self.class]) return NO;
+
+	MTLSparseModelStorageBehaviors *behaviors = self.class.sparseStorageBehaviors;
+	if (!MTLSparseModelValuesAreEqual(self, model, behaviors.permanentMask)) return NO;
+
+	for (NSString *key in behaviors.regularPermanentKeys) {
+		id selfValue = [self valueForKey:key];
+		id modelValue = [model valueForKey:key];
+
+		BOOL valuesEqual = ((selfValue == nil && modelValue == nil) || [selfValue isEqual:modelValue]);
+		if (!valuesEqual) return NO;
+	}
+
+	return YES;
+}
+
+@end
@@ -0,0 +1,90 @@
+//
+//  MTLStringInterningPool.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLStringInterningPool.h"
+
+// Strings longer than this are unlikely to repeat, and are not interned.
+static const NSUInteger MTLStringInterningPoolMaximumStringLength = 1024;
+
+// The byte limit of +sharedPool.
+static const NSUInteger MTLStringInterningPoolSharedByteLimit = 1024 * 1024;
+
+@interface MTLStringInterningPool ()
+
+// The interned strings. Only accessed while synchronized on the receiver.
+@property (nonatomic, strong, readonly) NSMutableSet *strings;
+
+@property (atomic, assign, readwrite) NSUInteger byteCount;
+
+@end
+
+@implementation MTLStringInterningPool
+
+#pragma mark Lifecycle
+
++ (instancetype)sharedPool {
+	static MTLStringInterningPool *sharedPool;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		sharedPool = [[self alloc] initWithByteLimit:MTLStringInterningPoolSharedByteLimit];
+	});
+
+	return sharedPool;
+}
+
+- (instancetype)init {
+	return [self initWithByteLimit:0];
+}
+
+- (instancetype)initWithByteLimit:(NSUInteger)byteLimit {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_byteLimit = byteLimit;
+	_strings = [[NSMutableSet alloc] init];
+
+	return self;
+}
+
+#pragma mark Interning
+
+- (NSUInteger)count {
+	@synchronized (self) {
+		return self.strings.count;
+	}
+}
+
+- (NSString *)internedString:(NSString *)string {
+	if (string == nil) return nil;
+
+	NSUInteger length = string.length;
+	if (length > MTLStringInterningPoolMaximumStringLength) return string;
+
+	@synchronized (self) {
+		NSString *existing = [self.strings member:string];
+		if (existing != nil) return existing;
+
+		NSUInteger byteCount = self.byteCount + length * sizeof(unichar);
+		if (self.byteLimit > 0 && byteCount > self.byteLimit) return string;
+
+		NSString *interned = [string copy];
+		[self.strings addObject:interned];
+		self.byteCount = byteCount;
+
+		return interned;
+	}
+}
+
+- (void)removeAllStrings {
+	@synchronized (self) {
+		[self.strings removeAllObjects];
+		self.byteCount = 0;
+	}
+}
+
+@end
@@ -0,0 +1,384 @@
+//
+//  MTLTrace.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <mach/mach_time.h>
+#import <pthread.h>
+#import <stdatomic.h>
+#import <unistd.h>
+
+#import "MTLTrace.h"
+#import "MTLTraceRecording.h"
+
+// The number of events kept by each thread, and for all exited threads
+// together, unless +setEventsPerBuffer: is used. Each event takes 24 bytes.
+#ifndef MTL_TRACE_DEFAULT_EVENTS_PER_BUFFER
+#define MTL_TRACE_DEFAULT_EVENTS_PER_BUFFER 4096
+#endif
+
+// One begin or end event.
+typedef struct {
+	// The result of mach_absolute_time().
+	uint64_t time;
+
+	// Classes are never deallocated, so this does not need to be retained.
+	__unsafe_unretained Class modelClass;
+
+	uint32_t threadID;
+	uint8_t stage;
+
+	// Either 'B' or 'E'.
+	char phase;
+} MTLTraceEvent;
+
+// Where an event is stored in a ring buffer.
+//
+// The recording thread can overwrite a slot while another thread exports it,
+// so all fields are atomic. Exporting checks the count of the buffer
+// afterwards to discard slots which may have been overwritten.
+typedef struct {
+	_Atomic uint64_t time;
+	_Atomic uintptr_t modelClass;
+
+	// The thread ID, stage and phase, as packed by MTLTraceRecord().
+	_Atomic uint64_t details;
+} MTLTraceEventSlot;
+
+// The ring buffer of one thread, which is freed when the thread exits.
+typedef struct MTLTraceBuffer {
+	// The next buffer in the list of all buffers.
+	struct MTLTraceBuffer *next;
+
+	// The number of events ever written. Only modified by the thread which is
+	// recording into the buffer, after it has written the event.
+	_Atomic uint64_t count;
+
+	// The number of slots in `events`, which never changes.
+	uint64_t capacity;
+
+	MTLTraceEventSlot events[];
+} MTLTraceBuffer;
+
+// Guards MTLTraceBuffers and MTLTraceExitedThreadEvents. Taken when a thread
+// records its first event or exits, and while exporting, but never while
+// recording.
+static pthread_mutex_t MTLTraceBuffersLock = PTHREAD_MUTEX_INITIALIZER;
+
+// The list of the buffers of all live threads which have recorded events.
+static MTLTraceBuffer *MTLTraceBuffers;
+
+// The most recent events of threads which have exited, oldest first from
+// MTLTraceExitedThreadEventCount % MTLTraceExitedThreadEventCapacity, or NULL
+// if no thread has exited yet.
+static MTLTraceEvent *MTLTraceExitedThreadEvents;
+static uint64_t MTLTraceExitedThreadEventCount;
+static uint64_t MTLTraceExitedThreadEventCapacity;
+
+// The capacity of buffers created from now on.
+static _Atomic NSUInteger MTLTraceEventsPerBuffer = MTL_TRACE_DEFAULT_EVENTS_PER_BUFFER;
+
+// Events recorded before this time are discarded when exporting.
+static _Atomic uint64_t MTLTraceResetTime;
+
+// The buffer of the current thread.
+static __thread MTLTraceBuffer *MTLTraceCurrentThreadBuffer;
+
+// Used to free the buffer of a thread when it exits.
+static pthread_key_t MTLTraceBufferKey;
+
+#if !MTL_TRACE_DISABLED
+BOOL MTLTraceEnabled = NO;
+#endif
+
+// Copies the events of `buffer` which were recorded since `resetTime` into
+// `events`, which must have room for the capacity of `buffer`.
+//
+// Returns the number of events copied.
+static NSUInteger MTLTraceCopyEvents(MTLTraceBuffer *buffer, MTLTraceEvent *events, uint64_t resetTime) {
+	uint64_t capacity = buffer->capacity;
+	uint64_t end = atomic_load_explicit(&buffer->count, memory_order_acquire);
+	uint64_t start = (end > capacity ? end - capacity : 0);
+
+	for (uint64_t index = start; index < end; index++) {
+		MTLTraceEventSlot *slot = &buffer->events[index % capacity];
+		uint64_t details = atomic_load_explicit(&slot->details, memory_order_relaxed);
+
+		events[index - start] = (MTLTraceEvent){
+			.time = atomic_load_explicit(&slot->time, memory_order_relaxed),
+			.modelClass = (__bridge Class)(void *)atomic_load_explicit(&slot->modelClass, memory_order_relaxed),
+			.threadID = (uint32_t)(details >> 16),
+			.stage = (uint8_t)(details >> 8),
+			.phase = (char)details,
+		};
+	}
+
+	// Skip any events which the recording thread may have overwritten while
+	// they were being copied, including the one it may be writing now. This
+	// pairs with the fence in MTLTraceRecord().
+	atomic_thread_fence(memory_order_acquire);
+	uint64_t countAfterCopy = atomic_load_explicit(&buffer->count, memory_order_relaxed);
+
+	uint64_t firstValid = start;
+	if (countAfterCopy >= capacity) firstValid = MAX(start, countAfterCopy - capacity + 1);
+
+	NSUInteger count = 0;
+	for (uint64_t index = firstValid; index < end; index++) {
+		MTLTraceEvent event = events[index - start];
+		if (event.time < resetTime) continue;
+
+		events[count++] = event;
+	}
+
+	return count;
+}
+
+static void MTLTraceFreeBuffer(void *value) {
+	MTLTraceBuffer *buffer = value;
+
+	// Destructors run on the exiting thread, which may still record events
+	// from other destructors, into a new buffer.
+	MTLTraceCurrentThreadBuffer = NULL;
+
+	// Only keep the events which are still going to be exported.
+	MTLTraceEvent *events = malloc(sizeof(MTLTraceEvent) * buffer->capacity);
+	NSUInteger count = (events != NULL ? MTLTraceCopyEvents(buffer, events, atomic_load(&MTLTraceResetTime)) : 0);
+
+	pthread_mutex_lock(&MTLTraceBuffersLock);
+
+	for (MTLTraceBuffer **link = &MTLTraceBuffers; *link != NULL; link = &(*link)->next) {
+		if (*link == buffer) {
+			*link = buffer->next;
+			break;
+		}
+	}
+
+	if (count > 0 && MTLTraceExitedThreadEvents == NULL) {
+		uint64_t capacity = atomic_load_explicit(&MTLTraceEventsPerBuffer, memory_order_relaxed);
+
+		MTLTraceExitedThreadEvents = calloc(capacity, sizeof(MTLTraceEvent));
+		if (MTLTraceExitedThreadEvents != NULL) MTLTraceExitedThreadEventCapacity = capacity;
+	}
+
+	if (MTLTraceExitedThreadEvents != NULL) {
+		for (NSUInteger index = 0; index < count; index++) {
+			MTLTraceExitedThreadEvents[MTLTraceExitedThreadEventCount++ % MTLTraceExitedThreadEventCapacity] = events[index];
+		}
+	}
+
+	pthread_mutex_unlock(&MTLTraceBuffersLock);
+
+	free(events);
+	free(buffer);
+}
+
+static MTLTraceBuffer *MTLTraceCreateBuffer(void) {
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		pthread_key_create(&MTLTraceBufferKey, MTLTraceFreeBuffer);
+	});
+
+	uint64_t capacity = atomic_load_explicit(&MTLTraceEventsPerBuffer, memory_order_relaxed);
+
+	MTLTraceBuffer *buffer = calloc(1, sizeof(*buffer) + sizeof(MTLTraceEventSlot) * capacity);
+	if (buffer == NULL) return NULL;
+
+	atomic_init(&buffer->count, 0);
+	buffer->capacity = capacity;
+
+	pthread_mutex_lock(&MTLTraceBuffersLock);
+	buffer->next = MTLTraceBuffers;
+	MTLTraceBuffers = buffer;
+	pthread_mutex_unlock(&MTLTraceBuffersLock);
+
+	pthread_setspecific(MTLTraceBufferKey, buffer);
+	return buffer;
+}
+
+static void MTLTraceRecord(MTLTraceStage stage, Class modelClass, char phase) {
+	MTLTraceBuffer *buffer = MTLTraceCurrentThreadBuffer;
+	if (buffer == NULL) {
+		buffer = MTLTraceCreateBuffer();
+		if (buffer == NULL) return;
+
+		MTLTraceCurrentThreadBuffer = buffer;
+	}
+
+	// Only this thread writes to the buffer, so the count can't change under
+	// us.
+	uint64_t count = atomic_load_explicit(&buffer->count, memory_order_relaxed);
+
+	// Makes sure that an exporting thread which sees any part of this event
+	// also sees that the slot is being overwritten.
+	atomic_thread_fence(memory_order_release);
+
+	uint32_t threadID = pthread_mach_thread_np(pthread_self());
+
+	MTLTraceEventSlot *slot = &buffer->events[count % buffer->capacity];
+	atomic_store_explicit(&slot->time, mach_absolute_time(), memory_order_relaxed);
+	atomic_store_explicit(&slot->modelClass, (uintptr_t)(__bridge void *)modelClass, memory_order_relaxed);
+	atomic_store_explicit(&slot->details, ((uint64_t)threadID << 16) | ((uint64_t)stage << 8) | (uint8_t)phase, memory_order_relaxed);
+
+	atomic_store_explicit(&buffer->count, count + 1, memory_order_release);
+}
+
+void MTLTraceBegin(MTLTraceStage stage, Class modelClass) {
+	MTLTraceRecord(stage, modelClass, 'B');
+}
+
+void MTLTraceEnd(MTLTraceStage stage, Class modelClass) {
+	MTLTraceRecord(stage, modelClass, 'E');
+}
+
+static NSString *MTLTraceStageName(uint8_t stage) {
+	switch (stage) {
+		case MTLTraceStageDecode: return @"decode";
+		case MTLTraceStageClassDispatch: return @"class dispatch";
+		case MTLTraceStageKeyPathExtraction: return @"key path extraction";
+		case MTLTraceStageTransform: return @"transform";
+		case MTLTraceStageModelInitialization: return @"model initialization";
+		case MTLTraceStageValidation: return @"validation";
+		case MTLTraceStageEncode: return @"encode";
+		case MTLTraceStageDictionaryValue: return @"dictionary value";
+		case MTLTraceStageReverseTransform: return @"reverse transform";
+		case MTLTraceStageKeyPathInsertion: return @"key path insertion";
+		default: return @"unknown";
+	}
+}
+
+@implementation MTLTrace
+
+#pragma mark Configuration
+
++ (BOOL)isEnabled {
+	return MTLTraceEnabled;
+}
+
++ (void)setEnabled:(BOOL)enabled {
+	#if !MTL_TRACE_DISABLED
+	MTLTraceEnabled = enabled;
+	#endif
+}
+
++ (NSUInteger)eventsPerBuffer {
+	return atomic_load(&MTLTraceEventsPerBuffer);
+}
+
++ (void)setEventsPerBuffer:(NSUInteger)eventsPerBuffer {
+	NSParameterAssert(eventsPerBuffer > 0);
+
+	atomic_store(&MTLTraceEventsPerBuffer, eventsPerBuffer);
+}
+
++ (void)reset {
+	atomic_store(&MTLTraceResetTime, mach_absolute_time());
+}
+
+#pragma mark Exporting
+
++ (NSArray *)chromeTraceEvents {
+	mach_timebase_info_data_t timebase;
+	mach_timebase_info(&timebase);
+
+	uint64_t resetTime = atomic_load(&MTLTraceResetTime);
+	NSNumber *processID = @(getpid());
+
+	NSMutableArray *result = [NSMutableArray array];
+
+	// Allocated once all buffers are locked, with room for the largest.
+	__block MTLTraceEvent *events = NULL;
+
+	// Appends the first `count` of `events`.
+	void (^appendEvents)(NSUInteger) = ^(NSUInteger count) {
+		// Track which events have begun, so that end events whose beginning
+		// was overwritten are left out.
+		NSMutableDictionary *depthsByThreadID = [NSMutableDictionary dictionary];
+
+		for (NSUInteger index = 0; index < count; index++) {
+			MTLTraceEvent event = events[index];
+
+			NSNumber *threadID = @(event.threadID);
+			NSUInteger depth = [depthsByThreadID[threadID] unsignedIntegerValue];
+
+			if (event.phase == 'E') {
+				if (depth == 0) continue;
+				depthsByThreadID[threadID] = @(depth - 1);
+			} else {
+				depthsByThreadID[threadID] = @(depth + 1);
+			}
+
+			double microseconds = (double)event.time * timebase.numer / timebase.denom / NSEC_PER_USEC;
+
+			[result addObject:@{
+				@"name": MTLTraceStageName(event.stage),
+				@"cat": @"Mantle",
+				@"ph": (event.phase == 'B' ? @"B" : @"E"),
+				@"ts": @(microseconds),
+				@"pid": processID,
+				@"tid": threadID,
+				@"args": @{ @"class": (event.modelClass != Nil ? NSStringFromClass(event.modelClass) : @"") },
+			}];
+		}
+	};
+
+	// Holding the lock keeps exiting threads from freeing their buffers while
+	// they are being read.
+	pthread_mutex_lock(&MTLTraceBuffersLock);
+
+	// Buffers may have different capacities, if +setEventsPerBuffer: was used
+	// in between their creation.
+	uint64_t capacity = MTLTraceExitedThreadEventCapacity;
+	for (MTLTraceBuffer *buffer = MTLTraceBuffers; buffer != NULL; buffer = buffer->next) {
+		capacity = MAX(capacity, buffer->capacity);
+	}
+
+	events = malloc(sizeof(MTLTraceEvent) * MAX(capacity, (uint64_t)1));
+	if (events == NULL) {
+		pthread_mutex_unlock(&MTLTraceBuffersLock);
+		return result;
+	}
+
+	if (MTLTraceExitedThreadEvents != NULL) {
+		uint64_t end = MTLTraceExitedThreadEventCount;
+		uint64_t start = (end > MTLTraceExitedThreadEventCapacity ? end - MTLTraceExitedThreadEventCapacity : 0);
+
+		NSUInteger count = 0;
+		for (uint64_t index = start; index < end; index++) {
+			MTLTraceEvent event = MTLTraceExitedThreadEvents[index % MTLTraceExitedThreadEventCapacity];
+			if (event.time < resetTime) continue;
+
+			events[count++] = event;
+		}
+
+		appendEvents(count);
+	}
+
+	for (MTLTraceBuffer *buffer = MTLTraceBuffers; buffer != NULL; buffer = buffer->next) {
+		appendEvents(MTLTraceCopyEvents(buffer, events, resetTime));
+	}
+
+	pthread_mutex_unlock(&MTLTraceBuffersLock);
+
+	free(events);
+
+	return result;
+}
+
++ (BOOL)writeChromeTraceToURL:(NSURL *)URL error:(NSError **)error {
+	NSParameterAssert(URL != nil);
+
+	NSDictionary *trace = @{
+		@"traceEvents": [self chromeTraceEvents],
+		@"displayTimeUnit": @"ns",
+	};
+
+	NSData *data = [NSJSONSerialization dataWithJSONObject:trace options:0 error:error];
+	if (data == nil) return NO;
+
+	return [data writeToURL:URL options:NSDataWritingAtomic error:error];
+}
+
+@end
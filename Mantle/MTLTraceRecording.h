@@ -0,0 +1,35 @@
+//
+//  MTLTraceRecording.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "MTLTrace.h"
+
+#if MTL_TRACE_DISABLED
+
+// Lets the compiler remove every trace point.
+#define MTLTraceEnabled NO
+
+#else
+
+// Whether MTLTrace is enabled. Capture this once before beginning a stage and
+// use the captured value to decide whether to end it, so that every begin event
+// has a matching end event.
+extern BOOL MTLTraceEnabled;
+
+#endif
+
+// Records the beginning of a stage on the current thread.
+//
+// stage      - The stage which is beginning.
+// modelClass - The model class the stage is working on, or Nil.
+void MTLTraceBegin(MTLTraceStage stage, Class modelClass);
+
+// Records the end of a stage on the current thread, which must match the most
+// recent unfinished call to MTLTraceBegin().
+void MTLTraceEnd(MTLTraceStage stage, Class modelClass);
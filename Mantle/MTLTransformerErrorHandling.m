@@ -13,3 +13,5 @@ NSString * const MTLTransformerErrorHandlingErrorDomain = @"MTLTransformerErrorH
 const NSInteger MTLTransformerErrorHandlingErrorInvalidInput = 1;
 
 NSString * const MTLTransformerErrorHandlingInputValueErrorKey = @"MTLTransformerErrorHandlingInputValueErrorKey";
+
+NSString * const MTLTransformerErrorHandlingIndexErrorKey = @"MTLTransformerErrorHandlingIndexErrorKey";
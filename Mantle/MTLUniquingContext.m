@@ -0,0 +1,84 @@
+//
+//  MTLUniquingContext.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLModel+Diffing.h"
+#import "MTLModelIdentity.h"
+#import "MTLUniquingContext.h"
+
+@interface MTLUniquingContext ()
+
+// Maps @[ modelClass, identity ] to weakly held canonical instances. Only
+// accessed while synchronized on the receiver.
+@property (nonatomic, strong, readonly) NSMapTable *modelsByKey;
+
+@end
+
+@implementation MTLUniquingContext
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_modelsByKey = [NSMapTable strongToWeakObjectsMapTable];
+
+	return self;
+}
+
+#pragma mark Uniquing
+
+- (id)uniqueModel:(MTLModel *)model {
+	NSParameterAssert(model != nil);
+
+	if (![model isKindOfClass:MTLModel.class] || !MTLModelClassHasIdentity(model.class)) return model;
+
+	// Models missing any part of their identity cannot be told apart, so they
+	// must not all share one instance.
+	id identity = MTLIdentityOfModel(model);
+	if (identity == NSNull.null || ([identity isKindOfClass:NSArray.class] && [identity containsObject:NSNull.null])) return model;
+
+	NSArray *key = @[ model.class, identity ];
+
+	@synchronized (self) {
+		MTLModel *canonicalModel = [self.modelsByKey objectForKey:key];
+		if (canonicalModel == nil) {
+			[self.modelsByKey setObject:model forKey:key];
+			return model;
+		}
+
+		if (canonicalModel == model || [canonicalModel changedPropertyKeysComparedToModel:model].count == 0) return canonicalModel;
+
+		// The canonical instance may be read on other threads, or shared
+		// through a payload cache, so it is replaced instead of mutated. -copy
+		// would return the canonical instance itself for immutable classes.
+		MTLModel *mergedModel = [[canonicalModel.class alloc] init];
+		[mergedModel setValuesForKeysWithDictionary:canonicalModel.dictionaryValue];
+		[mergedModel mergeValuesForKeysFromModel:model];
+		[self.modelsByKey setObject:mergedModel forKey:key];
+
+		return mergedModel;
+	}
+}
+
+- (id)existingModelOfClass:(Class)modelClass identity:(id)identity {
+	NSParameterAssert(modelClass != nil);
+	NSParameterAssert(identity != nil);
+
+	@synchronized (self) {
+		return [self.modelsByKey objectForKey:@[ modelClass, identity ]];
+	}
+}
+
+- (void)removeAllModels {
+	@synchronized (self) {
+		[self.modelsByKey removeAllObjects];
+	}
+}
+
+@end
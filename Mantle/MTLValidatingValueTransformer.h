@@ -0,0 +1,25 @@
+//
+//  MTLValidatingValueTransformer.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLValueTransformer.h"
+
+/// The transformer returned by +mtl_validatingTransformerForClass:, which
+/// passes through nil and instances of a class, and fails for anything else.
+///
+/// Knowing the class allows MTLJSONAdapter to skip the transformer for values
+/// whose type is already known to satisfy it.
+@interface MTLValidatingValueTransformer : MTLValueTransformer
+
+/// Returns a transformer validating that values are kinds of `validatedClass`,
+/// which must not be nil.
++ (instancetype)transformerValidatingClass:(Class)validatedClass;
+
+/// The class which values must be kinds of.
+@property (nonatomic, strong, readonly) Class validatedClass;
+
+@end
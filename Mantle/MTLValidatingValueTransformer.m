@@ -0,0 +1,34 @@
+//
+//  MTLValidatingValueTransformer.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLValidatingValueTransformer.h"
+#import "NSError+MTLLazyDescription.h"
+
+@implementation MTLValidatingValueTransformer
+
++ (instancetype)transformerValidatingClass:(Class)validatedClass {
+	NSParameterAssert(validatedClass != nil);
+
+	MTLValidatingValueTransformer *transformer = [self transformerUsingForwardBlock:^ id (id value, BOOL *success, NSError **error) {
+		if (value != nil && ![value isKindOfClass:validatedClass]) {
+			if (error != NULL) {
+				*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Value did not match expected type", @"") failureReasonFormat:NSLocalizedString(@"Expected %1$@ to be of class %2$@ but got %3$@", @"") arguments:@[ value, validatedClass, [value class] ] inputValue:value];
+			}
+			*success = NO;
+			return nil;
+		}
+
+		return value;
+	}];
+
+	transformer->_validatedClass = validatedClass;
+
+	return transformer;
+}
+
+@end
@@ -7,6 +7,8 @@
 //
 
 #import "MTLValueTransformer.h"
+#import "MTLAutoreleasePoolChunking.h"
+#import "NSError+MTLLazyDescription.h"
 
 //
 // Any MTLValueTransformer supporting reverse transformation. Necessary because
@@ -22,6 +24,63 @@
 
 @end
 
+// Invokes `block` for each of `values`, as specified by
+// -[MTLTransformerBatchHandling transformedValues:success:error:].
+static NSPointerArray *MTLTransformValuesUsingBlock(NSArray *values, MTLValueTransformerBlock block, BOOL *outerSuccess, NSError * __autoreleasing *outerError) {
+	NSCParameterAssert(values != nil);
+
+	NSUInteger count = values.count;
+	NSPointerArray *transformedValues = [NSPointerArray strongObjectsPointerArray];
+
+	// Errors must outlive the autorelease pools.
+	NSError *failureError = nil;
+	NSUInteger failedIndex = NSNotFound;
+
+	for (NSUInteger start = 0; start < count && failedIndex == NSNotFound; start += MTLAutoreleasePoolChunkSize) {
+		@autoreleasepool {
+			NSUInteger end = MIN(start + MTLAutoreleasePoolChunkSize, count);
+			for (NSUInteger index = start; index < end; index++) {
+				NSError *error = nil;
+				BOOL success = YES;
+
+				id transformedValue = block(values[index], &success, &error);
+				if (!success) {
+					failureError = error;
+					failedIndex = index;
+					break;
+				}
+
+				[transformedValues addPointer:(__bridge void *)transformedValue];
+			}
+		}
+	}
+
+	if (failedIndex != NSNotFound) {
+		if (outerSuccess != NULL) *outerSuccess = NO;
+		if (outerError != NULL) *outerError = [NSError mtl_transformerErrorWithValues:values failedAtIndex:failedIndex underlyingError:failureError];
+
+		return nil;
+	}
+
+	if (outerSuccess != NULL) *outerSuccess = YES;
+
+	return transformedValues;
+}
+
+// Returns `block`, or a block messaging `transformer` if its class overrides
+// the `selector` it inherits from `baseClass`, so that subclasses see every
+// value of a batch.
+static MTLValueTransformerBlock MTLBatchBlockForTransformer(MTLValueTransformer *transformer, SEL selector, Class baseClass, MTLValueTransformerBlock block) {
+	IMP imp = [transformer methodForSelector:selector];
+	if (imp == [baseClass instanceMethodForSelector:selector]) return block;
+
+	id (*function)(id, SEL, id, BOOL *, NSError **) = (__typeof__(function))imp;
+
+	return ^(id value, BOOL *success, NSError **error) {
+		return function(transformer, selector, value, success, error);
+	};
+}
+
 @implementation MTLValueTransformer
 
 #pragma mark Lifecycle
@@ -79,6 +138,14 @@
 	return transformedValue;
 }
 
+#pragma mark MTLTransformerBatchHandling
+
+- (NSPointerArray *)transformedValues:(NSArray *)values success:(BOOL *)success error:(NSError * __autoreleasing *)error {
+	MTLValueTransformerBlock block = MTLBatchBlockForTransformer(self, @selector(transformedValue:success:error:), MTLValueTransformer.class, self.forwardBlock);
+
+	return MTLTransformValuesUsingBlock(values, block, success, error);
+}
+
 @end
 
 @implementation MTLReversibleValueTransformer
@@ -115,6 +182,14 @@
 	return transformedValue;
 }
 
+#pragma mark MTLTransformerBatchHandling
+
+- (NSPointerArray *)reverseTransformedValues:(NSArray *)values success:(BOOL *)success error:(NSError * __autoreleasing *)error {
+	MTLValueTransformerBlock block = MTLBatchBlockForTransformer(self, @selector(reverseTransformedValue:success:error:), MTLReversibleValueTransformer.class, self.reverseBlock);
+
+	return MTLTransformValuesUsingBlock(values, block, success, error);
+}
+
 @end
 
 
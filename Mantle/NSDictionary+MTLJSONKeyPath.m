@@ -9,10 +9,19 @@
 #import "NSDictionary+MTLJSONKeyPath.h"
 
 #import "MTLJSONAdapter.h"
+#import "NSError+MTLLazyDescription.h"
 
 @implementation NSDictionary (MTLJSONKeyPath)
 
 - (id)mtl_valueForJSONKeyPath:(NSString *)JSONKeyPath success:(BOOL *)success error:(NSError * __autoreleasing *)error {
+	// Most key paths have a single component, which can be looked up without
+	// splitting the key path into a temporary array.
+	if ([JSONKeyPath rangeOfString:@"." options:NSLiteralSearch].location == NSNotFound) {
+		if (success != NULL) *success = YES;
+
+		return self[JSONKeyPath];
+	}
+
 	NSArray *components = [JSONKeyPath componentsSeparatedByString:@"."];
 
 	id result = self;
@@ -23,12 +32,14 @@
 
 		if (![result isKindOfClass:NSDictionary.class]) {
 			if (error != NULL) {
+				// The dictionary may be arbitrarily large, so only describe it if
+				// the error is actually presented.
 				NSDictionary *userInfo = @{
-					NSLocalizedDescriptionKey: NSLocalizedString(@"Invalid JSON dictionary", @""),
-					NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"JSON key path %1$@ could not resolved because an incompatible JSON dictionary was supplied: \"%2$@\"", @""), JSONKeyPath, self]
+					MTLJSONAdapterJSONKeyPathErrorKey: JSONKeyPath,
+					MTLJSONAdapterJSONDictionaryErrorKey: self
 				};
 
-				*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONDictionary userInfo:userInfo];
+				*error = [NSError mtl_errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONDictionary descriptionFormat:NSLocalizedString(@"Invalid JSON dictionary", @"") failureReasonFormat:NSLocalizedString(@"JSON key path %1$@ could not resolved because an incompatible JSON dictionary was supplied: \"%2$@\"", @"") arguments:@[ JSONKeyPath, self ] userInfo:userInfo];
 			}
 
 			if (success != NULL) *success = NO;
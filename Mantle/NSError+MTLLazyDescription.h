@@ -0,0 +1,70 @@
+//
+//  NSError+MTLLazyDescription.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@interface NSError (MTLLazyDescription)
+
+/// Creates a new error whose localized description and failure reason are only
+/// formatted when they are first read through -localizedDescription or
+/// -localizedFailureReason.
+///
+/// This allows structured information about a failure (like the offending
+/// value) to be stored cheaply, without paying for a -description of a
+/// potentially large object graph unless the message is actually needed. The
+/// messages are included in -userInfo under NSLocalizedDescriptionKey and
+/// NSLocalizedFailureReasonErrorKey, so reading -userInfo formats them too.
+/// Use -mtl_userInfoValueForKey: to read other keys without formatting.
+///
+/// The format strings must already be localized, using NSLocalizedString with
+/// a literal key where they are written, and may only contain `%@`, `%n$@` and
+/// `%%` specifiers.
+///
+/// domain              - The error domain. This argument must not be nil.
+/// code                - The error code.
+/// descriptionFormat   - The format of the localized description. This
+///                       argument must not be nil.
+/// failureReasonFormat - The format of the localized failure reason, or nil.
+/// arguments           - The objects substituted into both formats, which
+///                       each start with the first argument. May be nil if
+///                       neither format contains specifiers.
+/// userInfo            - Additional userInfo entries, which are available
+///                       without formatting. May be nil.
+///
+/// Returns an error.
++ (instancetype)mtl_errorWithDomain:(NSString *)domain code:(NSInteger)code descriptionFormat:(NSString *)descriptionFormat failureReasonFormat:(NSString *)failureReasonFormat arguments:(NSArray *)arguments userInfo:(NSDictionary *)userInfo;
+
+/// Creates a lazily formatted error in MTLTransformerErrorHandlingErrorDomain
+/// with MTLTransformerErrorHandlingErrorInvalidInput as its code.
+///
+/// inputValue - The invalid input, which is associated with
+///              MTLTransformerErrorHandlingInputValueErrorKey. May be nil.
+///
+/// See +mtl_errorWithDomain:code:descriptionFormat:failureReasonFormat:arguments:userInfo:
+/// for the other arguments.
++ (instancetype)mtl_transformerErrorWithDescriptionFormat:(NSString *)descriptionFormat failureReasonFormat:(NSString *)failureReasonFormat arguments:(NSArray *)arguments inputValue:(id)inputValue;
+
+/// Creates a lazily formatted error in MTLTransformerErrorHandlingErrorDomain
+/// describing that an element of a collection could not be transformed.
+///
+/// values          - The collection being transformed, which is associated
+///                   with MTLTransformerErrorHandlingInputValueErrorKey. This
+///                   argument must not be nil.
+/// index           - The index of the element which could not be transformed,
+///                   which is associated with
+///                   MTLTransformerErrorHandlingIndexErrorKey.
+/// underlyingError - The error of the element's transformation, if any.
++ (instancetype)mtl_transformerErrorWithValues:(id)values failedAtIndex:(NSUInteger)index underlyingError:(NSError *)underlyingError;
+
+/// Returns the userInfo value for `key`, without formatting the messages of
+/// lazily formatted errors.
+///
+/// key - The userInfo key to read. This argument must not be nil.
+- (id)mtl_userInfoValueForKey:(NSString *)key;
+
+@end
@@ -0,0 +1,205 @@
+//
+//  NSError+MTLLazyDescription.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLTransformerErrorHandling.h"
+
+#import "NSError+MTLLazyDescription.h"
+
+// Substitutes `arguments` into a format containing only `%@`, `%n$@` and `%%`
+// specifiers. Unknown specifiers and out-of-range arguments are copied into the
+// result verbatim.
+static NSString *MTLStringWithFormatArguments(NSString *format, NSArray *arguments) {
+	NSUInteger length = format.length;
+	NSMutableString *result = [[NSMutableString alloc] initWithCapacity:length];
+
+	NSUInteger nextArgument = 0;
+	NSUInteger index = 0;
+
+	while (index < length) {
+		NSRange percent = [format rangeOfString:@"%" options:NSLiteralSearch range:NSMakeRange(index, length - index)];
+		if (percent.location == NSNotFound) {
+			[result appendString:[format substringFromIndex:index]];
+			break;
+		}
+
+		[result appendString:[format substringWithRange:NSMakeRange(index, percent.location - index)]];
+
+		// Find the end of the specifier, parsing an optional position like
+		// "2$" along the way.
+		NSUInteger cursor = percent.location + 1;
+		NSUInteger position = 0;
+		while (cursor < length) {
+			unichar character = [format characterAtIndex:cursor];
+			if (character < '0' || character > '9') break;
+
+			position = position * 10 + (character - '0');
+			cursor++;
+		}
+
+		BOOL positional = (position > 0 && cursor < length && [format characterAtIndex:cursor] == '$');
+		if (positional) {
+			cursor++;
+		} else {
+			cursor = percent.location + 1;
+		}
+
+		unichar conversion = (cursor < length ? [format characterAtIndex:cursor] : 0);
+		NSUInteger argumentIndex = (positional ? position - 1 : nextArgument);
+
+		if (conversion == '%' && !positional) {
+			[result appendString:@"%"];
+		} else if (conversion == '@' && argumentIndex < arguments.count) {
+			[result appendString:[arguments[argumentIndex] description] ?: @"(null)"];
+			if (!positional) nextArgument++;
+		} else {
+			// Not a supported specifier, so copy it as is.
+			cursor = MIN(cursor, length - 1);
+			[result appendString:[format substringWithRange:NSMakeRange(percent.location, cursor + 1 - percent.location)]];
+		}
+
+		index = cursor + 1;
+	}
+
+	return result;
+}
+
+// An error which formats its localized description and failure reason on
+// first access.
+@interface MTLLazyDescriptionError : NSError {
+	NSString *_descriptionFormat;
+	NSString *_failureReasonFormat;
+	NSArray *_arguments;
+
+	// The formatted messages, and the userInfo including them, once they have
+	// been read. Only accessed while synchronized on the receiver.
+	NSString *_formattedDescription;
+	NSString *_formattedFailureReason;
+	NSDictionary *_userInfoWithMessages;
+}
+
+- (instancetype)initWithDomain:(NSString *)domain code:(NSInteger)code descriptionFormat:(NSString *)descriptionFormat failureReasonFormat:(NSString *)failureReasonFormat arguments:(NSArray *)arguments userInfo:(NSDictionary *)userInfo;
+
+@end
+
+@implementation MTLLazyDescriptionError
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithDomain:(NSString *)domain code:(NSInteger)code descriptionFormat:(NSString *)descriptionFormat failureReasonFormat:(NSString *)failureReasonFormat arguments:(NSArray *)arguments userInfo:(NSDictionary *)userInfo {
+	self = [super initWithDomain:domain code:code userInfo:userInfo];
+	if (self == nil) return nil;
+
+	_descriptionFormat = [descriptionFormat copy];
+	_failureReasonFormat = [failureReasonFormat copy];
+	_arguments = [arguments copy];
+
+	return self;
+}
+
+#pragma mark NSError
+
+// The messages are only added to the userInfo when it is read, like they would
+// be by NSError. Mantle itself reads structured keys through
+// -mtl_userInfoValueForKey: instead, which never formats them.
+- (NSDictionary *)userInfo {
+	@synchronized (self) {
+		if (_userInfoWithMessages != nil) return _userInfoWithMessages;
+	}
+
+	NSDictionary *userInfo = [super userInfo];
+	NSString *description = self.localizedDescription;
+	NSString *failureReason = self.localizedFailureReason;
+
+	NSMutableDictionary *userInfoWithMessages = [userInfo mutableCopy] ?: [[NSMutableDictionary alloc] initWithCapacity:2];
+	userInfoWithMessages[NSLocalizedDescriptionKey] = description;
+	if (failureReason != nil) userInfoWithMessages[NSLocalizedFailureReasonErrorKey] = failureReason;
+
+	@synchronized (self) {
+		if (_userInfoWithMessages == nil) _userInfoWithMessages = [userInfoWithMessages copy];
+
+		return _userInfoWithMessages;
+	}
+}
+
+- (id)mtl_userInfoValueForKey:(NSString *)key {
+	return [super userInfo][key];
+}
+
+- (NSString *)localizedDescription {
+	NSString *description = [super userInfo][NSLocalizedDescriptionKey];
+	if (description != nil) return description;
+
+	@synchronized (self) {
+		if (_formattedDescription == nil) {
+			_formattedDescription = MTLStringWithFormatArguments(_descriptionFormat, _arguments);
+		}
+
+		return _formattedDescription;
+	}
+}
+
+- (NSString *)localizedFailureReason {
+	NSString *failureReason = [super userInfo][NSLocalizedFailureReasonErrorKey];
+	if (failureReason != nil || _failureReasonFormat == nil) return failureReason;
+
+	@synchronized (self) {
+		if (_formattedFailureReason == nil) {
+			_formattedFailureReason = MTLStringWithFormatArguments(_failureReasonFormat, _arguments);
+		}
+
+		return _formattedFailureReason;
+	}
+}
+
+#pragma mark NSCoding
+
+- (Class)classForCoder {
+	return NSError.class;
+}
+
+- (id)replacementObjectForCoder:(NSCoder *)coder {
+	// Archive a plain error with the formatted messages in its userInfo, so
+	// that they survive unarchiving.
+	return [NSError errorWithDomain:self.domain code:self.code userInfo:self.userInfo];
+}
+
+@end
+
+@implementation NSError (MTLLazyDescription)
+
+- (id)mtl_userInfoValueForKey:(NSString *)key {
+	NSParameterAssert(key != nil);
+
+	return self.userInfo[key];
+}
+
++ (instancetype)mtl_errorWithDomain:(NSString *)domain code:(NSInteger)code descriptionFormat:(NSString *)descriptionFormat failureReasonFormat:(NSString *)failureReasonFormat arguments:(NSArray *)arguments userInfo:(NSDictionary *)userInfo {
+	NSParameterAssert(domain != nil);
+	NSParameterAssert(descriptionFormat != nil);
+
+	return [[MTLLazyDescriptionError alloc] initWithDomain:domain code:code descriptionFormat:descriptionFormat failureReasonFormat:failureReasonFormat arguments:arguments userInfo:userInfo];
+}
+
++ (instancetype)mtl_transformerErrorWithDescriptionFormat:(NSString *)descriptionFormat failureReasonFormat:(NSString *)failureReasonFormat arguments:(NSArray *)arguments inputValue:(id)inputValue {
+	NSDictionary *userInfo = (inputValue != nil ? @{ MTLTransformerErrorHandlingInputValueErrorKey: inputValue } : nil);
+
+	return [self mtl_errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput descriptionFormat:descriptionFormat failureReasonFormat:failureReasonFormat arguments:arguments userInfo:userInfo];
+}
+
++ (instancetype)mtl_transformerErrorWithValues:(id)values failedAtIndex:(NSUInteger)index underlyingError:(NSError *)underlyingError {
+	NSParameterAssert(values != nil);
+
+	NSMutableDictionary *userInfo = [[NSMutableDictionary alloc] initWithCapacity:3];
+	userInfo[MTLTransformerErrorHandlingInputValueErrorKey] = values;
+	userInfo[MTLTransformerErrorHandlingIndexErrorKey] = @(index);
+	userInfo[NSUnderlyingErrorKey] = underlyingError;
+
+	return [self mtl_errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput descriptionFormat:NSLocalizedString(@"Could not transform array", @"") failureReasonFormat:NSLocalizedString(@"Could not transform value at index %@", @"") arguments:@[ @(index) ] userInfo:userInfo];
+}
+
+@end
@@ -7,13 +7,342 @@
 //
 
 #import "NSValueTransformer+MTLPredefinedTransformerAdditions.h"
+#import "MTLAutoreleasePoolChunking.h"
+#import "MTLDataEncoding.h"
 #import "MTLJSONAdapter.h"
 #import "MTLModel.h"
+#import "MTLTransformerBatchHandling.h"
+#import "MTLValidatingValueTransformer.h"
 #import "MTLValueTransformer.h"
+#import "NSError+MTLLazyDescription.h"
 
 NSString * const MTLURLValueTransformerName = @"MTLURLValueTransformerName";
 NSString * const MTLUUIDValueTransformerName = @"MTLUUIDValueTransformerName";
 NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerName";
+NSString * const MTLBase64ValueTransformerName = @"MTLBase64ValueTransformerName";
+NSString * const MTLBase64URLValueTransformerName = @"MTLBase64URLValueTransformerName";
+NSString * const MTLHexValueTransformerName = @"MTLHexValueTransformerName";
+
+// Creates a transformer between strings and data, using the given functions.
+// `encodingName` describes the encoding in errors.
+static MTLValueTransformer *MTLDataEncodingTransformer(NSString *encodingName, NSData *(^decode)(NSString *string), NSString *(^encode)(NSData *data)) {
+	return [MTLValueTransformer
+		transformerUsingForwardBlock:^ id (NSString *string, BOOL *success, NSError **error) {
+			if (string == nil) return nil;
+
+			if (![string isKindOfClass:NSString.class]) {
+				if (error != NULL) {
+					*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert %1$@ string to data", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSString, got: %2$@.", @"") arguments:@[ encodingName, string ] inputValue:string];
+				}
+				*success = NO;
+				return nil;
+			}
+
+			NSData *data = decode(string);
+			if (data == nil) {
+				if (error != NULL) {
+					*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert %1$@ string to data", @"") failureReasonFormat:NSLocalizedString(@"Input %1$@ string was malformed", @"") arguments:@[ encodingName ] inputValue:string];
+				}
+				*success = NO;
+				return nil;
+			}
+
+			return data;
+		}
+		reverseBlock:^ id (NSData *data, BOOL *success, NSError **error) {
+			if (data == nil) return nil;
+
+			if (![data isKindOfClass:NSData.class]) {
+				if (error != NULL) {
+					*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert data to %1$@ string", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSData, got: %2$@.", @"") arguments:@[ encodingName, data ] inputValue:data];
+				}
+				*success = NO;
+				return nil;
+			}
+
+			return encode(data);
+		}];
+}
+
+// Transforms the elements of `values` using `transformer` in the given
+// direction.
+//
+// NSNull elements are kept as they are, without being passed to the
+// transformer, while nil results are left out. If `batches` is set, all other
+// elements are transformed with a single MTLTransformerBatchHandling message.
+static NSArray *MTLMapArray(NSArray *values, NSValueTransformer *transformer, BOOL reverse, BOOL batches, BOOL handlesErrors, BOOL *success, NSError **error) {
+	NSMutableArray *transformedValues = [NSMutableArray arrayWithCapacity:values.count];
+
+	if (batches) {
+		NSArray *batch = values;
+		NSIndexSet *batchIndexes = nil;
+		if ([values indexOfObjectIdenticalTo:NSNull.null] != NSNotFound) {
+			batchIndexes = [values indexesOfObjectsPassingTest:^(id value, NSUInteger index, BOOL *stop) {
+				return (BOOL)(value != NSNull.null);
+			}];
+
+			batch = [values objectsAtIndexes:batchIndexes];
+		}
+
+		NSError *batchError = nil;
+		BOOL batchSuccess = YES;
+		NSPointerArray *results = (reverse
+			? [(id<MTLTransformerBatchHandling>)transformer reverseTransformedValues:batch success:&batchSuccess error:&batchError]
+			: [(id<MTLTransformerBatchHandling>)transformer transformedValues:batch success:&batchSuccess error:&batchError]);
+
+		if (!batchSuccess) {
+			if (error != NULL) {
+				NSNumber *batchIndex = [batchError mtl_userInfoValueForKey:MTLTransformerErrorHandlingIndexErrorKey];
+				if (batchIndex == nil) {
+					*error = batchError;
+				} else {
+					// Report the index of the element in `values`, rather than
+					// in the batch.
+					__block NSUInteger index = batchIndex.unsignedIntegerValue;
+					if (batchIndexes != nil) {
+						__block NSUInteger position = 0;
+						[batchIndexes enumerateIndexesUsingBlock:^(NSUInteger valueIndex, BOOL *stop) {
+							if (position++ < batchIndex.unsignedIntegerValue) return;
+
+							index = valueIndex;
+							*stop = YES;
+						}];
+					}
+
+					*error = [NSError mtl_transformerErrorWithValues:values failedAtIndex:index underlyingError:[batchError mtl_userInfoValueForKey:NSUnderlyingErrorKey]];
+				}
+			}
+			*success = NO;
+			return nil;
+		}
+
+		NSUInteger resultIndex = 0;
+		for (id value in values) {
+			if (value == NSNull.null) {
+				[transformedValues addObject:NSNull.null];
+				continue;
+			}
+
+			id transformedValue = (__bridge id)[results pointerAtIndex:resultIndex++];
+			if (transformedValue == nil) continue;
+
+			[transformedValues addObject:transformedValue];
+		}
+
+		return transformedValues;
+	}
+
+	NSUInteger count = values.count;
+
+	// Errors must outlive the autorelease pools.
+	NSError *underlyingError = nil;
+	NSUInteger failedIndex = NSNotFound;
+
+	for (NSUInteger start = 0; start < count && failedIndex == NSNotFound; start += MTLAutoreleasePoolChunkSize) {
+		@autoreleasepool {
+			NSUInteger end = MIN(start + MTLAutoreleasePoolChunkSize, count);
+			for (NSUInteger index = start; index < end; index++) {
+				id value = values[index];
+				if (value == NSNull.null) {
+					[transformedValues addObject:NSNull.null];
+					continue;
+				}
+
+				id transformedValue = nil;
+				if (handlesErrors) {
+					NSError *elementError = nil;
+					transformedValue = (reverse
+						? [(id<MTLTransformerErrorHandling>)transformer reverseTransformedValue:value success:success error:&elementError]
+						: [(id<MTLTransformerErrorHandling>)transformer transformedValue:value success:success error:&elementError]);
+
+					if (*success == NO) {
+						underlyingError = elementError;
+						failedIndex = index;
+						break;
+					}
+				} else {
+					transformedValue = (reverse ? [transformer reverseTransformedValue:value] : [transformer transformedValue:value]);
+				}
+
+				if (transformedValue == nil) continue;
+
+				[transformedValues addObject:transformedValue];
+			}
+		}
+	}
+
+	if (failedIndex != NSNotFound) {
+		if (error != NULL) {
+			*error = [NSError mtl_transformerErrorWithValues:values failedAtIndex:failedIndex underlyingError:underlyingError];
+		}
+		return nil;
+	}
+
+	return transformedValues;
+}
+
+// The number of objects copied out of an array at a time while packing
+// numbers.
+static const NSUInteger MTLPackedNumberBatchSize = 256;
+
+// Returns the size in bytes of a single element of the given type.
+static size_t MTLPackedNumberSize(MTLPackedNumberType type) {
+	switch (type) {
+		case MTLPackedNumberTypeDouble:
+			return sizeof(double);
+
+		case MTLPackedNumberTypeFloat:
+			return sizeof(float);
+
+		case MTLPackedNumberTypeInt32:
+			return sizeof(int32_t);
+
+		case MTLPackedNumberTypeInt64:
+			return sizeof(int64_t);
+	}
+
+	return 0;
+}
+
+// Reads `number` as an integer, if it holds one exactly and in the range of
+// int64_t.
+static BOOL MTLPackedNumberIntegerValue(NSNumber *number, int64_t *value) {
+	switch (number.objCType[0]) {
+		case 'f':
+		case 'd': {
+			double doubleValue = number.doubleValue;
+
+			// Unlike INT64_MAX, 2^63 is exactly representable as a double.
+			if (!(doubleValue >= -0x1p63 && doubleValue < 0x1p63) || doubleValue != trunc(doubleValue)) return NO;
+
+			*value = (int64_t)doubleValue;
+			return YES;
+		}
+
+		case 'Q':
+		case 'L':
+			if (number.unsignedLongLongValue > INT64_MAX) return NO;
+
+			*value = (int64_t)number.unsignedLongLongValue;
+			return YES;
+
+		default:
+			*value = number.longLongValue;
+			return YES;
+	}
+}
+
+// Converts `object` to an element of `type`, and stores it at `element`.
+//
+// Returns NO if `object` is not an NSNumber, or if converting it would change
+// its value (other than by rounding it to a float).
+static BOOL MTLPackNumber(id object, MTLPackedNumberType type, void *element) {
+	if (![object isKindOfClass:NSNumber.class]) return NO;
+
+	NSNumber *number = object;
+
+	switch (type) {
+		case MTLPackedNumberTypeDouble:
+			*(double *)element = number.doubleValue;
+			return YES;
+
+		case MTLPackedNumberTypeFloat: {
+			double value = number.doubleValue;
+			if (isfinite(value) && fabs(value) > FLT_MAX) return NO;
+
+			*(float *)element = (float)value;
+			return YES;
+		}
+
+		case MTLPackedNumberTypeInt32: {
+			int64_t value;
+			if (!MTLPackedNumberIntegerValue(number, &value) || value < INT32_MIN || value > INT32_MAX) return NO;
+
+			*(int32_t *)element = (int32_t)value;
+			return YES;
+		}
+
+		case MTLPackedNumberTypeInt64:
+			return MTLPackedNumberIntegerValue(number, (int64_t *)element);
+	}
+
+	return NO;
+}
+
+// Packs `numbers` into a buffer of `type` elements.
+//
+// Returns nil and sets `invalidIndex` to the index of the first element which
+// is not an NSNumber, or whose value `type` cannot hold, if any.
+static NSData *MTLPackNumbers(NSArray *numbers, MTLPackedNumberType type, NSUInteger *invalidIndex) {
+	NSUInteger count = numbers.count;
+	size_t elementSize = MTLPackedNumberSize(type);
+	NSMutableData *data = [NSMutableData dataWithLength:count * elementSize];
+	char *bytes = data.mutableBytes;
+
+	__unsafe_unretained id objects[MTLPackedNumberBatchSize];
+
+	for (NSUInteger start = 0; start < count; start += MTLPackedNumberBatchSize) {
+		NSUInteger length = MIN(MTLPackedNumberBatchSize, count - start);
+		[numbers getObjects:objects range:NSMakeRange(start, length)];
+
+		for (NSUInteger i = 0; i < length; i++) {
+			if (!MTLPackNumber(objects[i], type, bytes + (start + i) * elementSize)) {
+				*invalidIndex = start + i;
+				return nil;
+			}
+		}
+	}
+
+	return data;
+}
+
+// Unpacks a buffer of `type` elements into an array of NSNumbers.
+//
+// The buffer may not be suitably aligned for `type` (e.g., if it is a range of
+// a larger buffer), so every element is copied out before it is read.
+static NSArray *MTLUnpackNumbers(NSData *data, MTLPackedNumberType type) {
+	size_t elementSize = MTLPackedNumberSize(type);
+	NSUInteger count = data.length / elementSize;
+	const char *bytes = data.bytes;
+
+	NSMutableArray *numbers = [[NSMutableArray alloc] initWithCapacity:count];
+
+	switch (type) {
+		case MTLPackedNumberTypeDouble:
+			for (NSUInteger i = 0; i < count; i++) {
+				double element;
+				memcpy(&element, bytes + i * elementSize, elementSize);
+				[numbers addObject:@(element)];
+			}
+			break;
+
+		case MTLPackedNumberTypeFloat:
+			for (NSUInteger i = 0; i < count; i++) {
+				float element;
+				memcpy(&element, bytes + i * elementSize, elementSize);
+				[numbers addObject:@(element)];
+			}
+			break;
+
+		case MTLPackedNumberTypeInt32:
+			for (NSUInteger i = 0; i < count; i++) {
+				int32_t element;
+				memcpy(&element, bytes + i * elementSize, elementSize);
+				[numbers addObject:@(element)];
+			}
+			break;
+
+		case MTLPackedNumberTypeInt64:
+			for (NSUInteger i = 0; i < count; i++) {
+				int64_t element;
+				memcpy(&element, bytes + i * elementSize, elementSize);
+				[numbers addObject:@(element)];
+			}
+			break;
+	}
+
+	return numbers;
+}
 
 @implementation NSValueTransformer (MTLPredefinedTransformerAdditions)
 
@@ -27,13 +356,7 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 
 				if (![str isKindOfClass:NSString.class]) {
 					if (error != NULL) {
-						NSDictionary *userInfo = @{
-							NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert string to URL", @""),
-							NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSString, got: %@.", @""), str],
-							MTLTransformerErrorHandlingInputValueErrorKey : str
-						};
-
-						*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+						*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert string to URL", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSString, got: %@.", @"") arguments:@[ str ] inputValue:str];
 					}
 					*success = NO;
 					return nil;
@@ -43,13 +366,7 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 
 				if (result == nil) {
 					if (error != NULL) {
-						NSDictionary *userInfo = @{
-							NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert string to URL", @""),
-							NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Input URL string %@ was malformed", @""), str],
-							MTLTransformerErrorHandlingInputValueErrorKey : str
-						};
-
-						*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+						*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert string to URL", @"") failureReasonFormat:NSLocalizedString(@"Input URL string %@ was malformed", @"") arguments:@[ str ] inputValue:str];
 					}
 					*success = NO;
 					return nil;
@@ -62,13 +379,7 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 
 				if (![URL isKindOfClass:NSURL.class]) {
 					if (error != NULL) {
-						NSDictionary *userInfo = @{
-							NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert URL to string", @""),
-							NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSURL, got: %@.", @""), URL],
-							MTLTransformerErrorHandlingInputValueErrorKey : URL
-						};
-
-						*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+						*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert URL to string", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSURL, got: %@.", @"") arguments:@[ URL ] inputValue:URL];
 					}
 					*success = NO;
 					return nil;
@@ -84,12 +395,7 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 					
 					if (![string isKindOfClass:NSString.class]) {
 						if (error) {
-							NSDictionary *userInfo = @{
-								NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert string to UUID", @""),
-								NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSString, got: %@.", @""), string],
-								MTLTransformerErrorHandlingInputValueErrorKey : string
-							};
-							*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+							*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert string to UUID", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSString, got: %@.", @"") arguments:@[ string ] inputValue:string];
 						}
 						*success = NO;
 						return nil;
@@ -99,12 +405,7 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 					
 					if (result == nil) {
 						if (error) {
-							NSDictionary *userInfo = @{
-								NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert string to UUID", @""),
-								NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Input UUID string %@ was malformed", @""), string],
-													   MTLTransformerErrorHandlingInputValueErrorKey : string
-							};
-							*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+							*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert string to UUID", @"") failureReasonFormat:NSLocalizedString(@"Input UUID string %@ was malformed", @"") arguments:@[ string ] inputValue:string];
 						}
 						*success = NO;
 						return nil;
@@ -117,10 +418,7 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 					
 					if (![uuid isKindOfClass:NSUUID.class]) {
 						if (error != NULL) {
-							NSDictionary *userInfo = @{NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert UUID to string", @""),
-													   NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSUUID, got: %@.", @""), uuid],
-													   MTLTransformerErrorHandlingInputValueErrorKey : uuid};
-							*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+							*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert UUID to string", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSUUID, got: %@.", @"") arguments:@[ uuid ] inputValue:uuid];
 						}
 						*success = NO;
 						return nil;
@@ -137,13 +435,7 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 
 				if (![boolean isKindOfClass:NSNumber.class]) {
 					if (error != NULL) {
-						NSDictionary *userInfo = @{
-							NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert number to boolean-backed number or vice-versa", @""),
-							NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSNumber, got: %@.", @""), boolean],
-							MTLTransformerErrorHandlingInputValueErrorKey : boolean
-						};
-
-						*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+						*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert number to boolean-backed number or vice-versa", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSNumber, got: %@.", @"") arguments:@[ boolean ] inputValue:boolean];
 					}
 					*success = NO;
 					return nil;
@@ -152,6 +444,36 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 			}];
 
 		[NSValueTransformer setValueTransformer:booleanValueTransformer forName:MTLBooleanValueTransformerName];
+
+		MTLValueTransformer *base64ValueTransformer = MTLDataEncodingTransformer(@"base64",
+			^(NSString *string) {
+				return MTLDataFromBase64String(string, NO);
+			},
+			^(NSData *data) {
+				return MTLBase64StringFromData(data, NO);
+			});
+
+		[NSValueTransformer setValueTransformer:base64ValueTransformer forName:MTLBase64ValueTransformerName];
+
+		MTLValueTransformer *base64URLValueTransformer = MTLDataEncodingTransformer(@"base64url",
+			^(NSString *string) {
+				return MTLDataFromBase64String(string, YES);
+			},
+			^(NSData *data) {
+				return MTLBase64StringFromData(data, YES);
+			});
+
+		[NSValueTransformer setValueTransformer:base64URLValueTransformer forName:MTLBase64URLValueTransformerName];
+
+		MTLValueTransformer *hexValueTransformer = MTLDataEncodingTransformer(@"hexadecimal",
+			^(NSString *string) {
+				return MTLDataFromHexString(string);
+			},
+			^(NSData *data) {
+				return MTLHexStringFromData(data);
+			});
+
+		[NSValueTransformer setValueTransformer:hexValueTransformer forName:MTLHexValueTransformerName];
 	}
 }
 
@@ -159,120 +481,42 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 
 + (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_arrayMappingTransformerWithTransformer:(NSValueTransformer *)transformer {
 	NSParameterAssert(transformer != nil);
-	
+
+	// Decide how to talk to the transformer once, rather than for every
+	// element.
+	BOOL forwardBatches = [transformer conformsToProtocol:@protocol(MTLTransformerBatchHandling)];
+	BOOL forwardHandlesErrors = [transformer conformsToProtocol:@protocol(MTLTransformerErrorHandling)];
+	BOOL reverseBatches = forwardBatches && [transformer respondsToSelector:@selector(reverseTransformedValues:success:error:)];
+	BOOL reverseHandlesErrors = [transformer respondsToSelector:@selector(reverseTransformedValue:success:error:)];
+
 	id (^forwardBlock)(NSArray *values, BOOL *success, NSError **error) = ^ id (NSArray *values, BOOL *success, NSError **error) {
 		if (values == nil) return nil;
-		
+
 		if (![values isKindOfClass:NSArray.class]) {
 			if (error != NULL) {
-				NSDictionary *userInfo = @{
-					NSLocalizedDescriptionKey: NSLocalizedString(@"Could not transform non-array type", @""),
-					NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSArray, got: %@.", @""), values],
-					MTLTransformerErrorHandlingInputValueErrorKey: values
-				};
-				
-				*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+				*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not transform non-array type", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSArray, got: %@.", @"") arguments:@[ values ] inputValue:values];
 			}
 			*success = NO;
 			return nil;
 		}
-		
-		NSMutableArray *transformedValues = [NSMutableArray arrayWithCapacity:values.count];
-		NSInteger index = -1;
-		for (id value in values) {
-			index++;
-			if (value == NSNull.null) {
-				[transformedValues addObject:NSNull.null];
-				continue;
-			}
-			
-			id transformedValue = nil;
-			if ([transformer conformsToProtocol:@protocol(MTLTransformerErrorHandling)]) {
-				NSError *underlyingError = nil;
-				transformedValue = [(id<MTLTransformerErrorHandling>)transformer transformedValue:value success:success error:&underlyingError];
-				
-				if (*success == NO) {
-					if (error != NULL) {
-						NSDictionary *userInfo = @{
-							NSLocalizedDescriptionKey: NSLocalizedString(@"Could not transform array", @""),
-							NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Could not transform value at index %ld", @""), (long)index],
-							NSUnderlyingErrorKey: underlyingError,
-							MTLTransformerErrorHandlingInputValueErrorKey: values
-						};
 
-						*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
-					}
-					return nil;
-				}
-			} else {
-				transformedValue = [transformer transformedValue:value];
-			}
-			
-			if (transformedValue == nil) continue;
-			
-			[transformedValues addObject:transformedValue];
-		}
-		
-		return transformedValues;
+		return MTLMapArray(values, transformer, NO, forwardBatches, forwardHandlesErrors, success, error);
 	};
-	
+
 	id (^reverseBlock)(NSArray *values, BOOL *success, NSError **error) = nil;
 	if (transformer.class.allowsReverseTransformation) {
 		reverseBlock = ^ id (NSArray *values, BOOL *success, NSError **error) {
 			if (values == nil) return nil;
-			
+
 			if (![values isKindOfClass:NSArray.class]) {
 				if (error != NULL) {
-					NSDictionary *userInfo = @{
-						NSLocalizedDescriptionKey: NSLocalizedString(@"Could not transform non-array type", @""),
-						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSArray, got: %@.", @""), values],
-						MTLTransformerErrorHandlingInputValueErrorKey: values
-					};
-
-					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+					*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not transform non-array type", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSArray, got: %@.", @"") arguments:@[ values ] inputValue:values];
 				}
 				*success = NO;
 				return nil;
 			}
-			
-			NSMutableArray *transformedValues = [NSMutableArray arrayWithCapacity:values.count];
-			NSInteger index = -1;
-			for (id value in values) {
-				index++;
-				if (value == NSNull.null) {
-					[transformedValues addObject:NSNull.null];
 
-					continue;
-				}
-				
-				id transformedValue = nil;
-				if ([transformer respondsToSelector:@selector(reverseTransformedValue:success:error:)]) {
-					NSError *underlyingError = nil;
-					transformedValue = [(id<MTLTransformerErrorHandling>)transformer reverseTransformedValue:value success:success error:&underlyingError];
-					
-					if (*success == NO) {
-						if (error != NULL) {
-							NSDictionary *userInfo = @{
-								NSLocalizedDescriptionKey: NSLocalizedString(@"Could not transform array", @""),
-								NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Could not transform value at index %ld", @""), (long)index],
-								NSUnderlyingErrorKey: underlyingError,
-								MTLTransformerErrorHandlingInputValueErrorKey: values
-							};
-							
-							*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
-						}
-						return nil;
-					}
-				} else {
-					transformedValue = [transformer reverseTransformedValue:value];
-				}
-				
-				if (transformedValue == nil) continue;
-				
-				[transformedValues addObject:transformedValue];
-			}
-			
-			return transformedValues;
+			return MTLMapArray(values, transformer, YES, reverseBatches, reverseHandlesErrors, success, error);
 		};
 	}
 	if (reverseBlock != nil) {
@@ -282,26 +526,67 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 	}
 }
 
-+ (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_validatingTransformerForClass:(Class)modelClass {
-	NSParameterAssert(modelClass != nil);
++ (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_packedNumberArrayTransformerWithType:(MTLPackedNumberType)type {
+	size_t elementSize = MTLPackedNumberSize(type);
+	NSParameterAssert(elementSize > 0);
 
-	return [MTLValueTransformer transformerUsingForwardBlock:^ id (id value, BOOL *success, NSError **error) {
-		if (value != nil && ![value isKindOfClass:modelClass]) {
-			if (error != NULL) {
-				NSDictionary *userInfo = @{
-					NSLocalizedDescriptionKey: NSLocalizedString(@"Value did not match expected type", @""),
-					NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected %1$@ to be of class %2$@ but got %3$@", @""), value, modelClass, [value class]],
-					MTLTransformerErrorHandlingInputValueErrorKey : value
-				};
+	return [MTLValueTransformer
+		transformerUsingForwardBlock:^ id (NSArray *numbers, BOOL *success, NSError **error) {
+			if (numbers == nil) return nil;
 
-				*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+			if (![numbers isKindOfClass:NSArray.class]) {
+				if (error != NULL) {
+					*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert array to packed numbers", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSArray, got: %@.", @"") arguments:@[ numbers ] inputValue:numbers];
+				}
+				*success = NO;
+				return nil;
 			}
-			*success = NO;
-			return nil;
+
+			NSUInteger invalidIndex = NSNotFound;
+			NSData *data = MTLPackNumbers(numbers, type, &invalidIndex);
+
+			if (data == nil) {
+				if (error != NULL) {
+					NSDictionary *userInfo = @{
+						MTLTransformerErrorHandlingInputValueErrorKey: numbers,
+						MTLTransformerErrorHandlingIndexErrorKey: @(invalidIndex)
+					};
+
+					*error = [NSError mtl_errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput descriptionFormat:NSLocalizedString(@"Could not convert array to packed numbers", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSNumber which fits the element type at index %1$@, got: %2$@.", @"") arguments:@[ @(invalidIndex), numbers[invalidIndex] ] userInfo:userInfo];
+				}
+				*success = NO;
+				return nil;
+			}
+
+			return data;
 		}
+		reverseBlock:^ id (NSData *data, BOOL *success, NSError **error) {
+			if (data == nil) return nil;
+
+			if (![data isKindOfClass:NSData.class]) {
+				if (error != NULL) {
+					*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert packed numbers to array", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSData, got: %@.", @"") arguments:@[ data ] inputValue:data];
+				}
+				*success = NO;
+				return nil;
+			}
 
-		return value;
-	}];
+			if (data.length % elementSize != 0) {
+				if (error != NULL) {
+					*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert packed numbers to array", @"") failureReasonFormat:NSLocalizedString(@"Expected a length which is a multiple of %1$@ bytes, got %2$@ bytes.", @"") arguments:@[ @(elementSize), @(data.length) ] inputValue:data];
+				}
+				*success = NO;
+				return nil;
+			}
+
+			return MTLUnpackNumbers(data, type);
+		}];
+}
+
++ (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_validatingTransformerForClass:(Class)modelClass {
+	NSParameterAssert(modelClass != nil);
+
+	return [MTLValidatingValueTransformer transformerValidatingClass:modelClass];
 }
 
 + (NSValueTransformer *)mtl_valueMappingTransformerWithDictionary:(NSDictionary *)dictionary defaultValue:(id)defaultValue reverseDefaultValue:(id)reverseDefaultValue {
@@ -364,13 +649,7 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 
 				if (![str isKindOfClass:NSString.class]) {
 					if (error != NULL) {
-						NSDictionary *userInfo = @{
-						    NSLocalizedDescriptionKey: [NSString stringWithFormat:NSLocalizedString(@"Could not convert string to %@", @""), objectClass],
-							NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSString as input, got: %@.", @""), str],
-							MTLTransformerErrorHandlingInputValueErrorKey : str
-						};
-						
-						*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+						*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert string to %1$@", @"") failureReasonFormat:NSLocalizedString(@"Expected an NSString as input, got: %2$@.", @"") arguments:@[ objectClass, str ] inputValue:str];
 					}
 					*success = NO;
 					return nil;
@@ -383,12 +662,11 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 				if (errorDescription != nil) {
 					if (error != NULL) {
 						NSDictionary *userInfo = @{
-							NSLocalizedDescriptionKey: [NSString stringWithFormat:NSLocalizedString(@"Could not convert string to %@", @""), objectClass],
 							NSLocalizedFailureReasonErrorKey: errorDescription,
 							MTLTransformerErrorHandlingInputValueErrorKey : str
 						};
-						
-						*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+
+						*error = [NSError mtl_errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput descriptionFormat:NSLocalizedString(@"Could not convert string to %@", @"") failureReasonFormat:nil arguments:@[ objectClass ] userInfo:userInfo];
 					}
 					*success = NO;
 					return nil;
@@ -396,12 +674,7 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 
 				if (![object isKindOfClass:objectClass]) {
 					if (error != NULL) {
-						NSDictionary *userInfo = @{
-							NSLocalizedDescriptionKey: [NSString stringWithFormat:NSLocalizedString(@"Could not convert string to %@", @""), objectClass],
-							NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an %@ as output from the formatter, got: %@.", @""), objectClass, object],
-						};
-
-						*error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFormattingError userInfo:userInfo];
+						*error = [NSError mtl_errorWithDomain:NSCocoaErrorDomain code:NSFormattingError descriptionFormat:NSLocalizedString(@"Could not convert string to %1$@", @"") failureReasonFormat:NSLocalizedString(@"Expected an %1$@ as output from the formatter, got: %2$@.", @"") arguments:@[ objectClass, object ?: NSNull.null ] userInfo:nil];
 					}
 					*success = NO;
 					return nil;
@@ -413,13 +686,7 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 
 				if (![object isKindOfClass:objectClass]) {
 					if (error != NULL) {
-						NSDictionary *userInfo = @{
-						   NSLocalizedDescriptionKey: [NSString stringWithFormat:NSLocalizedString(@"Could not convert %@ to string", @""), objectClass],
-						   NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an %@ as input, got: %@.", @""), objectClass, object],
-						   MTLTransformerErrorHandlingInputValueErrorKey : object
-						};
-
-						*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+						*error = [NSError mtl_transformerErrorWithDescriptionFormat:NSLocalizedString(@"Could not convert %1$@ to string", @"") failureReasonFormat:NSLocalizedString(@"Expected an %1$@ as input, got: %2$@.", @"") arguments:@[ objectClass, object ] inputValue:object];
 					}
 					*success = NO;
 					return nil;
@@ -0,0 +1,185 @@
+//
+//  MTLColumnarBatch.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/// The domain for errors originating from MTLColumnarBatch.
+extern NSString * const MTLColumnarBatchErrorDomain;
+
+/// The data is not a valid columnar batch.
+extern const NSInteger MTLColumnarBatchErrorInvalidData;
+
+/// The model class named in the data does not exist, or is not a MTLModel.
+extern const NSInteger MTLColumnarBatchErrorUnknownModelClass;
+
+/// A value does not match the type of its property or column.
+extern const NSInteger MTLColumnarBatchErrorInvalidValue;
+
+/// Associated with the key of the property which caused an error.
+extern NSString * const MTLColumnarBatchPropertyKeyErrorKey;
+
+/// The layouts of column values.
+///
+/// MTLColumnTypeBool      - One byte per value, which is 0 or 1.
+/// MTLColumnTypeInt64     - One signed 64 bit integer per value.
+/// MTLColumnTypeUInt64    - One unsigned 64 bit integer per value.
+/// MTLColumnTypeFloat64   - One IEEE 754 double per value.
+/// MTLColumnTypeTimestamp - One IEEE 754 double per value, counting the seconds
+///                          since 1970-01-01T00:00:00Z. Used for NSDate
+///                          properties.
+/// MTLColumnTypeString    - UTF-8 bytes, delimited by offsets. Used for
+///                          NSString properties.
+/// MTLColumnTypeURL       - The UTF-8 bytes of absolute URL strings, delimited
+///                          by offsets. Used for NSURL properties.
+/// MTLColumnTypeBinary    - Arbitrary bytes, delimited by offsets. Used for
+///                          NSData properties.
+typedef enum : NSUInteger {
+	MTLColumnTypeBool = 1,
+	MTLColumnTypeInt64 = 2,
+	MTLColumnTypeUInt64 = 3,
+	MTLColumnTypeFloat64 = 4,
+	MTLColumnTypeTimestamp = 5,
+	MTLColumnTypeString = 6,
+	MTLColumnTypeURL = 7,
+	MTLColumnTypeBinary = 8
+} MTLColumnType;
+
+/// The values of one property across all models of a batch, stored
+/// contiguously.
+///
+/// All numbers are little-endian. The validity bitmaps, and the buffers of
+/// Int64, UInt64, Float64, string, URL and binary columns, use the same layouts
+/// as the corresponding Apache Arrow types, where strings and binary values are
+/// Arrow's large variants with 64 bit offsets. Bool and Timestamp columns do
+/// not, since Arrow packs booleans into bits and stores timestamps as integers,
+/// so they must be converted before being handed to Arrow.
+@interface MTLColumn : NSObject
+
+/// The property key whose values the column holds.
+@property (nonatomic, copy, readonly) NSString *key;
+
+/// The layout of the values.
+@property (nonatomic, assign, readonly) MTLColumnType type;
+
+/// The number of values, which equals the number of models in the batch.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/// The number of nil values.
+@property (nonatomic, assign, readonly) NSUInteger nullCount;
+
+/// A bitmap with one bit per value, which is set if the value is not nil. Bits
+/// are numbered from the least significant bit of the first byte.
+@property (nonatomic, copy, readonly) NSData *validityBitmap;
+
+/// For string, URL and binary columns, `count + 1` signed 64 bit integers. The
+/// bytes of the value at index `i` start at offset `i` and end before offset
+/// `i + 1` in `values`. Nil for all other columns.
+@property (nonatomic, copy, readonly) NSData *offsets;
+
+/// The packed values, in the layout described by `type`. The values at the
+/// positions of nils are zeroed or empty.
+@property (nonatomic, copy, readonly) NSData *values;
+
+/// Whether the value at `index` is nil.
+- (BOOL)isNullAtIndex:(NSUInteger)index;
+
+@end
+
+/// Converts an array of models of one class into columns, with one column per
+/// property, and back.
+///
+/// Columns are extracted through each property's accessors, so scalar values
+/// are never boxed, and no intermediate dictionaries are created. Scalar
+/// properties, and properties of class NSNumber, NSString, NSURL, NSData or
+/// NSDate, are exported. Properties of other classes, like nested models or
+/// collections, are skipped, and keep their default values when models are
+/// recreated from a batch.
+///
+/// A batch can be written to a file in the following format, in which all
+/// integers are unsigned 64 bit little-endian numbers unless specified
+/// otherwise, and every byte string is followed by zeros up to the next
+/// multiple of 8 bytes:
+///
+///     magic         "MTLCOLS1"
+///     row count
+///     column count
+///     class length  followed by the UTF-8 name of the model class
+///     columns       column count times:
+///       key length      followed by the UTF-8 property key
+///       type            a MTLColumnType
+///       null count
+///       bitmap length   followed by the validity bitmap
+///       offsets length  followed by the offsets, or 0 for fixed-width types
+///       values length   followed by the values
+@interface MTLColumnarBatch : NSObject
+
+/// Extracts columns from models.
+///
+/// models     - The models to convert, which must all be instances of
+///              `modelClass` or its subclasses. This argument must not be nil.
+/// modelClass - The MTLModel subclass whose properties should become columns.
+///              This argument must not be nil.
+/// error      - If not NULL, this may be set to an error if a property holds a
+///              value of a different class than it declares.
+///
+/// Returns a batch, or nil if an error occurred.
++ (instancetype)batchWithModels:(NSArray *)models ofClass:(Class)modelClass error:(NSError **)error;
+
+/// Reads a batch from data in the format described above.
+///
+/// data  - The data to read. This argument must not be nil.
+/// error - If not NULL, this may be set to an error if the data is invalid or
+///         names an unknown model class.
+///
+/// Returns a batch, or nil if an error occurred.
++ (instancetype)batchWithData:(NSData *)data error:(NSError **)error;
+
+/// Reads a batch from a file in the format described above, which is mapped
+/// into memory if possible.
+///
+/// URL   - The file URL to read from. This argument must not be nil.
+/// error - If not NULL, this may be set to an error that occurs while reading
+///         the file or parsing its contents.
+///
+/// Returns a batch, or nil if an error occurred.
++ (instancetype)batchWithContentsOfURL:(NSURL *)URL error:(NSError **)error;
+
+/// The class of the models the batch was created from.
+@property (nonatomic, strong, readonly) Class modelClass;
+
+/// The number of models the batch was created from.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/// The columns of the batch, sorted by key.
+@property (nonatomic, copy, readonly) NSArray *columns;
+
+/// Returns the column for the given property key, or nil if there is none.
+- (MTLColumn *)columnForKey:(NSString *)key;
+
+/// Serializes the batch into the format described above.
+- (NSData *)dataRepresentation;
+
+/// Writes the batch to a file atomically, in the format described above.
+///
+/// URL   - The file URL to write to. This argument must not be nil.
+/// error - If not NULL, this may be set to an error that occurs while writing.
+///
+/// Returns whether the file was written.
+- (BOOL)writeToURL:(NSURL *)URL error:(NSError **)error;
+
+/// Recreates the models from the columns, then validates them.
+///
+/// Columns for keys which are not properties of the model class are ignored.
+///
+/// error - If not NULL, this may be set to an error if a column does not match
+///         the type of its property, or a model fails validation.
+///
+/// Returns an array of models, or nil if an error occurred.
+- (NSArray *)modelsWithError:(NSError **)error;
+
+@end
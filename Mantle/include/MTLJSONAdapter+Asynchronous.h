@@ -0,0 +1,110 @@
+//
+//  MTLJSONAdapter+Asynchronous.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#if __has_include(<Mantle/MTLJSONAdapter.h>)
+#import <Mantle/MTLJSONAdapter.h>
+#else
+#import "MTLJSONAdapter.h"
+#endif
+
+/// Performs conversions between models and JSON in the background.
+///
+/// Each method returns immediately with an NSProgress object, which reports how
+/// many of the input objects have been converted and may be cancelled to stop
+/// the work early. Cancellation is checked before each object is converted.
+/// Arrays are split into chunks which are converted on multiple worker threads,
+/// bounded by the number of available processors.
+///
+/// Decoding starts once all input is available. JSON data is parsed as a whole
+/// in the background, not incrementally as it arrives.
+///
+/// The completion block is always invoked exactly once. If the progress was
+/// cancelled before the work finished, it is invoked with a nil result and an
+/// error with the code NSUserCancelledError in NSCocoaErrorDomain.
+@interface MTLJSONAdapter (Asynchronous)
+
+/// Asynchronously deserializes a model from a JSON dictionary, as if by
+/// +modelOfClass:fromJSONDictionary:error:.
+///
+/// modelClass       - The MTLModel subclass to attempt to parse from the JSON.
+///                    This class must conform to <MTLJSONSerializing>. This
+///                    argument must not be nil.
+/// JSONDictionary   - A dictionary representing JSON data.
+/// qualityOfService - The quality of service of the conversion work.
+/// completionQueue  - The queue to invoke `completion` on. If nil, the main
+///                    queue is used.
+/// completion       - A block invoked with the model, or with nil and the error
+///                    which occurred. This argument must not be nil.
+///
+/// Returns a progress object with a total unit count of 1.
++ (NSProgress *)modelOfClass:(Class)modelClass fromJSONDictionary:(NSDictionary *)JSONDictionary qualityOfService:(NSQualityOfService)qualityOfService completionQueue:(dispatch_queue_t)completionQueue completion:(void (^)(id model, NSError *error))completion;
+
+/// Asynchronously deserializes models from an array of JSON dictionaries, as if
+/// by +modelsOfClass:fromJSONArray:error:.
+///
+/// JSONArray - An array of dictionaries representing JSON data.
+/// completion - A block invoked with the models, or with nil and the first
+///              error which occurred. This argument must not be nil.
+///
+/// See +modelOfClass:fromJSONDictionary:qualityOfService:completionQueue:completion:
+/// for the other arguments.
+///
+/// Returns a progress object whose total unit count is the number of
+/// dictionaries.
++ (NSProgress *)modelsOfClass:(Class)modelClass fromJSONArray:(NSArray *)JSONArray qualityOfService:(NSQualityOfService)qualityOfService completionQueue:(dispatch_queue_t)completionQueue completion:(void (^)(NSArray *models, NSError *error))completion;
+
+/// Asynchronously parses JSON data containing an array of dictionaries, and
+/// deserializes models from it as if by
+/// +modelsOfClass:fromJSONArray:qualityOfService:completionQueue:completion:.
+///
+/// Both parsing and decoding happen off the calling thread. The data is parsed
+/// with NSJSONSerialization once it is complete.
+///
+/// JSONData   - UTF-8, UTF-16 or UTF-32 encoded JSON text. This argument must
+///              not be nil.
+/// completion - A block invoked with the models, or with nil and the first
+///              error which occurred, including any parsing error. This
+///              argument must not be nil.
+///
+/// See +modelOfClass:fromJSONDictionary:qualityOfService:completionQueue:completion:
+/// for the other arguments.
+///
+/// Returns a progress object with a total unit count of 2, one for parsing and
+/// one for decoding, which is tracked by a child progress once the number of
+/// dictionaries is known.
++ (NSProgress *)modelsOfClass:(Class)modelClass fromJSONData:(NSData *)JSONData qualityOfService:(NSQualityOfService)qualityOfService completionQueue:(dispatch_queue_t)completionQueue completion:(void (^)(NSArray *models, NSError *error))completion;
+
+/// Asynchronously serializes a model into JSON, as if by
+/// +JSONDictionaryFromModel:error:.
+///
+/// model      - The model to use for JSON serialization. This argument must not
+///              be nil.
+/// completion - A block invoked with the JSON dictionary, or with nil and the
+///              error which occurred. This argument must not be nil.
+///
+/// See +modelOfClass:fromJSONDictionary:qualityOfService:completionQueue:completion:
+/// for the other arguments.
+///
+/// Returns a progress object with a total unit count of 1.
++ (NSProgress *)JSONDictionaryFromModel:(id<MTLJSONSerializing>)model qualityOfService:(NSQualityOfService)qualityOfService completionQueue:(dispatch_queue_t)completionQueue completion:(void (^)(NSDictionary *JSONDictionary, NSError *error))completion;
+
+/// Asynchronously serializes an array of models into JSON, as if by
+/// +JSONArrayFromModels:error:.
+///
+/// models     - The array of models to use for JSON serialization. This
+///              argument must not be nil.
+/// completion - A block invoked with the JSON array, or with nil and the first
+///              error which occurred. This argument must not be nil.
+///
+/// See +modelOfClass:fromJSONDictionary:qualityOfService:completionQueue:completion:
+/// for the other arguments.
+///
+/// Returns a progress object whose total unit count is the number of models.
++ (NSProgress *)JSONArrayFromModels:(NSArray *)models qualityOfService:(NSQualityOfService)qualityOfService completionQueue:(dispatch_queue_t)completionQueue completion:(void (^)(NSArray *JSONArray, NSError *error))completion;
+
+@end
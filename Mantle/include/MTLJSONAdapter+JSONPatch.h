@@ -0,0 +1,65 @@
+//
+//  MTLJSONAdapter+JSONPatch.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#if __has_include(<Mantle/MTLJSONAdapter.h>)
+#import <Mantle/MTLJSONAdapter.h>
+#else
+#import "MTLJSONAdapter.h"
+#endif
+
+/// Applies RFC 6902 JSON Patch documents directly to models, without encoding
+/// them into JSON dictionaries and decoding them again.
+///
+/// Patch paths are JSON pointers into the JSON representation of a model. They
+/// are mapped back to properties through the inverse of
+/// +JSONKeyPathsByPropertyKey, so only the transformers of the properties
+/// affected by an operation are run.
+///
+/// Locations nested inside a property whose value is a model conforming to
+/// <MTLJSONSerializing>, or inside an element of an array of such models, are
+/// patched by descending into that model. Any other location inside a
+/// property is patched in the property's JSON representation, which requires
+/// the property's transformer to be reversible.
+///
+/// Models are never mutated. The patched model is a copy in which only the
+/// models along each changed path have been copied, and everything else is
+/// shared with the original.
+@interface MTLJSONAdapter (JSONPatch)
+
+/// Applies a JSON Patch to a model.
+///
+/// operations - An array of JSON Patch operations, as returned by
+///              NSJSONSerialization. The "add", "remove", "replace", "move",
+///              "copy" and "test" operations are supported.
+/// model      - The model to patch. This argument must not be nil.
+/// error      - If not NULL, this may be set to an error that occurs during
+///              patching, deserializing or validation.
+///
+/// Returns the patched model, or nil if any operation could not be applied.
++ (id)modelByApplyingJSONPatch:(NSArray *)operations toModel:(id<MTLJSONSerializing>)model error:(NSError **)error;
+
+/// Applies a JSON Patch to a model.
+///
+/// All operations are applied in order, and either all of them succeed or
+/// none of their changes is returned. New property values are validated with
+/// -validateValue:forKey:error:.
+///
+/// operations - An array of JSON Patch operations, as returned by
+///              NSJSONSerialization. The "add", "remove", "replace", "move",
+///              "copy" and "test" operations are supported.
+/// model      - The model to patch, which must be an instance of the
+///              receiver's model class or a subclass thereof. This argument
+///              must not be nil.
+/// error      - If not NULL, this may be set to an error that occurs during
+///              patching, deserializing or validation.
+///
+/// Returns the patched model, which is `model` itself if the patch did not
+/// change any value, or nil if any operation could not be applied.
+- (id)modelByApplyingJSONPatch:(NSArray *)operations toModel:(id<MTLJSONSerializing>)model error:(NSError **)error;
+
+@end
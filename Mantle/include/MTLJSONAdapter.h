@@ -8,6 +8,10 @@
 
 #import <Foundation/Foundation.h>
 
+@class MTLPayloadCache;
+@class MTLStringInterningPool;
+@class MTLUniquingContext;
+
 @protocol MTLModel;
 @protocol MTLTransformerErrorHandling;
 
@@ -75,6 +79,27 @@
 /// to abort parsing (e.g., if the data is invalid).
 + (Class)classForParsingJSONDictionary:(NSDictionary *)JSONDictionary;
 
+/// Specifies which properties should have their string values deduplicated
+/// through -[MTLJSONAdapter stringInterningPool].
+///
+/// Strings directly inside array values are interned as well. If this method
+/// is not implemented, the string values of all properties in
+/// +JSONKeyPathsByPropertyKey are interned whenever a pool is in effect.
+///
+/// Returns a set of property keys.
++ (NSSet *)JSONPropertyKeysForStringInterning;
+
+/// Specifies which properties should have their value transformers wrapped in
+/// a MTLMemoizingValueTransformer.
+///
+/// The memoizing transformers are shared by all adapters of the same class, so
+/// results are reused across decodes. Each caches up to 512 results in each
+/// direction, for string and number inputs only. Only list properties whose
+/// transformers are pure.
+///
+/// Returns a set of property keys.
++ (NSSet *)JSONPropertyKeysForTransformerMemoization;
+
 @end
 
 /// The domain for errors originating from MTLJSONAdapter.
@@ -93,12 +118,82 @@ extern const NSInteger MTLJSONAdapterErrorInvalidJSONMapping;
 /// An exception was thrown and caught.
 extern const NSInteger MTLJSONAdapterErrorExceptionThrown;
 
+/// A JSON Patch operation was malformed, referred to a location which does not
+/// exist or is not mapped to any property, or failed its test.
+extern const NSInteger MTLJSONAdapterErrorInvalidJSONPatch;
+
 /// Associated with the NSException that was caught.
 extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 
+/// Associated with the JSON key path which could not be resolved.
+extern NSString * const MTLJSONAdapterJSONKeyPathErrorKey;
+
+/// Associated with the JSON dictionary (or other object) in which a JSON key
+/// path could not be resolved.
+extern NSString * const MTLJSONAdapterJSONDictionaryErrorKey;
+
+/// Associated with the JSON Patch operation which could not be applied.
+extern NSString * const MTLJSONAdapterJSONPatchOperationErrorKey;
+
 /// Converts a MTLModel object to and from a JSON dictionary.
 @interface MTLJSONAdapter : NSObject
 
+/// An optional pool used to deduplicate the NSString values of properties,
+/// and the strings directly inside their NSArray values, while deserializing
+/// models.
+///
+/// Share a pool between adapters to deduplicate across decodes, use a new
+/// pool per decode session, or use +[MTLStringInterningPool sharedPool]. The
+/// pool also applies to nested models decoded by the transformers of
+/// +dictionaryTransformerWithModelClass: and +arrayTransformerWithModelClass:
+/// during decodes by this adapter, and to models of subclasses returned from
+/// +classForParsingJSONDictionary:.
+///
+/// Defaults to nil, in which case no strings are interned.
+@property (nonatomic, strong) MTLStringInterningPool *stringInterningPool;
+
+/// An optional identity map through which every decoded model is uniqued, so
+/// that an entity which is decoded repeatedly, whether nested in many objects
+/// or across decodes, results in one canonical instance.
+///
+/// The context also applies to nested models decoded by the transformers of
+/// +dictionaryTransformerWithModelClass: and
+/// +arrayTransformerWithModelClass: during decodes by this adapter, and is used
+/// by the adapters this adapter creates for subclasses returned from
+/// +classForParsingJSONDictionary:.
+///
+/// Defaults to nil, in which case no models are uniqued.
+@property (nonatomic, strong) MTLUniquingContext *uniquingContext;
+
+/// An optional cache consulted by -modelFromJSONData:error:, so that payloads
+/// which are byte-identical to a previous one return the previously decoded
+/// model instead of being parsed and decoded again.
+///
+/// Models returned from the cache are shared, and must not be mutated. Entries
+/// are also keyed by the class, string interning pool and uniquing context of
+/// the adapter, so differently configured adapters can share a cache.
+///
+/// Defaults to nil, in which case every payload is decoded.
+@property (nonatomic, strong) MTLPayloadCache *payloadCache;
+
+/// The number of JSON dictionaries which the receiver decoded with a decoder
+/// it had already specialized for their shape.
+///
+/// The shape of a JSON dictionary consists of which of the top-level keys used
+/// by +JSONKeyPathsByPropertyKey are present, and the JSON types of their
+/// values. A decoder specialized for a shape skips the key path lookups of
+/// absent properties, and the transformers which would only validate the type
+/// of a value or pass through a null. The receiver specializes decoders for a
+/// few shapes, and decodes dictionaries of any other shape generically.
+///
+/// Models decoded by the adapters this adapter creates for subclasses are not
+/// counted.
+@property (atomic, assign, readonly) NSUInteger shapeCacheHitCount;
+
+/// The number of JSON dictionaries which the receiver decoded while no decoder
+/// was specialized for their shape yet.
+@property (atomic, assign, readonly) NSUInteger shapeCacheMissCount;
+
 /// Attempts to parse a JSON dictionary into a model object.
 ///
 /// modelClass     - The MTLModel subclass to attempt to parse from the JSON.
@@ -114,6 +209,20 @@ extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 /// occurred.
 + (id)modelOfClass:(Class)modelClass fromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error;
 
+/// Attempts to parse JSON data representing a dictionary into a model object.
+///
+/// modelClass - The MTLModel subclass to attempt to parse from the JSON. This
+///              class must conform to <MTLJSONSerializing>. This argument must
+///              not be nil.
+/// data       - JSON data in any encoding NSJSONSerialization supports. If
+///              this argument is nil, the method returns nil.
+/// error      - If not NULL, this may be set to an error that occurs during
+///              parsing or initializing an instance of `modelClass`.
+///
+/// Returns an instance of `modelClass` upon success, or nil if a parsing error
+/// occurred.
++ (id)modelOfClass:(Class)modelClass fromJSONData:(NSData *)data error:(NSError **)error;
+
 /// Attempts to parse an array of JSON dictionary objects into a model objects
 /// of a specific class.
 ///
@@ -176,6 +285,39 @@ extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 /// model did not validate successfully.
 - (id)modelFromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error;
 
+/// Deserializes a model from JSON data representing a dictionary.
+///
+/// If the receiver has a `payloadCache`, byte-identical data which was decoded
+/// before returns the cached model.
+///
+/// data  - JSON data in any encoding NSJSONSerialization supports. If this
+///         argument is nil, the method returns nil.
+/// error - If not NULL, this may be set to an error that occurs during parsing,
+///         deserializing or validation.
+///
+/// Returns a model object, or nil if an error occurred.
+- (id)modelFromJSONData:(NSData *)data error:(NSError **)error;
+
+/// Applies a full or partial JSON dictionary to an existing model in place.
+///
+/// Only the properties whose JSON key paths are present in `JSONDictionary` are
+/// transformed, and of those, only the ones whose value actually changed are
+/// validated with -validateValue:forKey:error: and set. A JSON null sets the
+/// property to nil. If any value fails to transform or validate, the model is
+/// left unchanged.
+///
+/// model          - The model to update, which must be an instance of the
+///                  receiver's model class or a subclass thereof. This
+///                  argument must not be nil.
+/// JSONDictionary - A dictionary representing JSON data. This should match the
+///                  format returned by NSJSONSerialization. This argument must
+///                  not be nil.
+/// error          - If not NULL, this may be set to an error that occurs during
+///                  deserializing or validation.
+///
+/// Returns whether the model was updated successfully.
+- (BOOL)updateModel:(id<MTLJSONSerializing>)model fromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error;
+
 /// Serializes a model into JSON.
 ///
 /// model - The model to use for JSON serialization. This argument must not be
@@ -232,6 +374,22 @@ extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 /// Returns a value transformer or nil if no transformation should be used.
 + (NSValueTransformer *)transformerForModelPropertiesOfObjCType:(const char *)objCType;
 
+/// The memoizing transformers used by adapters of the receiver's class for the
+/// properties of `modelClass` listed in
+/// +JSONPropertyKeysForTransformerMemoization.
+///
+/// This can be used to inspect the hit rates of the transformers.
+///
+/// modelClass - The class whose transformers should be returned. This class
+///              must conform to <MTLJSONSerializing>. This argument must not be
+///              nil.
+///
+/// Returns a dictionary mapping property keys to MTLMemoizingValueTransformer
+/// instances, which is empty until an adapter for `modelClass` has been
+/// created. The transformers are only kept for the 128 most recently used
+/// model classes, after which new adapters start with empty caches again.
++ (NSDictionary *)memoizingTransformersForModelClass:(Class)modelClass;
+
 @end
 
 @interface MTLJSONAdapter (ValueTransformers)
@@ -244,7 +402,8 @@ extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 ///              not be nil.
 ///
 /// Returns a reversible transformer which uses the class of the receiver for
-/// transforming values back and forth.
+/// transforming values back and forth. The transformer may be used from
+/// multiple threads at once.
 + (NSValueTransformer<MTLTransformerErrorHandling> *)dictionaryTransformerWithModelClass:(Class)modelClass;
 
 /// Creates a reversible transformer to convert an array of JSON dictionaries
@@ -255,7 +414,8 @@ extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 ///              This argument must not be nil.
 ///
 /// Returns a reversible transformer which uses the class of the receiver for
-/// transforming array elements back and forth.
+/// transforming array elements back and forth. The transformer may be used
+/// from multiple threads at once.
 + (NSValueTransformer<MTLTransformerErrorHandling> *)arrayTransformerWithModelClass:(Class)modelClass;
 
 /// This value transformer is used by MTLJSONAdapter to automatically convert
@@ -0,0 +1,77 @@
+//
+//  MTLMemoizingValueTransformer.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+#if __has_include(<Mantle/MTLTransformerErrorHandling.h>)
+#import <Mantle/MTLTransformerErrorHandling.h>
+#else
+#import "MTLTransformerErrorHandling.h"
+#endif
+
+/// A value transformer which caches the results of another transformer, keyed
+/// by input value.
+///
+/// The wrapped transformer must be pure, i.e., always produce equal outputs for
+/// equal inputs. Results are kept in a thread-safe cache which evicts the least
+/// recently used entries once it holds `countLimit` of them.
+///
+/// Only NSString and NSNumber inputs are memoized, and numbers are only
+/// considered equal to numbers of the same kind, so that booleans, integers and
+/// floating-point numbers are cached separately even if they compare equal.
+/// Any other input is always passed through to the wrapped transformer.
+///
+/// Since cached results are handed to every caller, only immutable results,
+/// i.e., ones which return themselves from -copy, are cached. Failed
+/// transformations are never cached.
+///
+/// To memoize a predefined transformer for every property that uses it,
+/// register a memoizing transformer under its name:
+///
+///     NSValueTransformer *URLTransformer = [NSValueTransformer valueTransformerForName:MTLURLValueTransformerName];
+///     [NSValueTransformer setValueTransformer:[MTLMemoizingValueTransformer transformerWithTransformer:URLTransformer countLimit:1000 memoizesReverseTransformations:NO] forName:MTLURLValueTransformerName];
+@interface MTLMemoizingValueTransformer : NSValueTransformer <MTLTransformerErrorHandling>
+
+/// Returns a memoizing transformer which is reversible if and only if
+/// `transformer` is.
+///
+/// transformer                    - The transformer whose results should be
+///                                  cached. This argument must not be nil.
+/// countLimit                     - The maximum number of results to cache in
+///                                  each direction. This must be greater than 0.
+/// memoizesReverseTransformations - Whether reverse transformations should be
+///                                  cached too, or always be passed through.
++ (instancetype)transformerWithTransformer:(NSValueTransformer *)transformer countLimit:(NSUInteger)countLimit memoizesReverseTransformations:(BOOL)memoizesReverseTransformations;
+
+/// The transformer whose results are cached.
+@property (nonatomic, strong, readonly) NSValueTransformer *transformer;
+
+/// The maximum number of results cached in each direction.
+@property (nonatomic, assign, readonly) NSUInteger countLimit;
+
+/// Whether reverse transformations are cached.
+@property (nonatomic, assign, readonly) BOOL memoizesReverseTransformations;
+
+/// The number of forward transformations answered from the cache.
+@property (atomic, assign, readonly) NSUInteger hitCount;
+
+/// The number of forward transformations which invoked the wrapped
+/// transformer.
+@property (atomic, assign, readonly) NSUInteger missCount;
+
+/// The number of reverse transformations answered from the cache.
+@property (atomic, assign, readonly) NSUInteger reverseHitCount;
+
+/// The number of reverse transformations which invoked the wrapped
+/// transformer.
+@property (atomic, assign, readonly) NSUInteger reverseMissCount;
+
+/// Removes all cached results. The hit and miss counts are not reset.
+- (void)removeAllCachedValues;
+
+@end
@@ -0,0 +1,112 @@
+//
+//  MTLMessagePackAdapter.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#if __has_include(<Mantle/MTLJSONAdapter.h>)
+#import <Mantle/MTLJSONAdapter.h>
+#else
+#import "MTLJSONAdapter.h"
+#endif
+
+/// Converts a MTLModel object to and from MessagePack data.
+///
+/// Models are mapped with the same <MTLJSONSerializing> key paths and value
+/// transformers as MTLJSONAdapter, so no additional declarations are needed.
+/// Since MessagePack can represent more types than JSON, the adapter keeps
+/// some values in their native MessagePack representation, rather than
+/// round-tripping them through strings:
+///
+///  - NSDate properties are written as timestamps, ignoring their JSON
+///    transformers.
+///  - NSData properties are written as binary, ignoring their JSON
+///    transformers.
+///  - NSNumbers, including boxed scalar properties, are written as the
+///    smallest integer which holds their value, or as a float or double.
+///
+/// When reading, NSDate and NSData values are used as is. Anything else, like
+/// dates encoded as strings by other producers, is passed to the property's
+/// JSON transformer, so existing payloads still decode.
+///
+/// Nested models are converted by MTLMessagePackAdapters as well, so their
+/// dates and data also stay native. All other properties are converted exactly
+/// as MTLJSONAdapter would. The MessagePack data is produced and consumed with
+/// MTLMessagePackSerialization.
+@interface MTLMessagePackAdapter : MTLJSONAdapter
+
+/// Attempts to parse MessagePack data into a model object.
+///
+/// modelClass - The MTLModel subclass to attempt to parse from the data. This
+///              class must conform to <MTLJSONSerializing>. This argument must
+///              not be nil.
+/// data       - MessagePack data containing a single map. If this argument is
+///              nil, the method returns nil.
+/// error      - If not NULL, this may be set to an error that occurs during
+///              reading the data, parsing or initializing an instance of
+///              `modelClass`.
+///
+/// Returns an instance of `modelClass` upon success, or nil if an error
+/// occurred.
++ (id)modelOfClass:(Class)modelClass fromMessagePackData:(NSData *)data error:(NSError **)error;
+
+/// Attempts to parse MessagePack data into an array of model objects.
+///
+/// modelClass - The MTLModel subclass to attempt to parse from the data. This
+///              class must conform to <MTLJSONSerializing>. This argument must
+///              not be nil.
+/// data       - MessagePack data containing a single array of maps. If this
+///              argument is nil, the method returns nil.
+/// error      - If not NULL, this may be set to an error that occurs during
+///              reading the data, parsing or initializing any of the instances
+///              of `modelClass`.
+///
+/// Returns an array of `modelClass` instances upon success, or nil if an error
+/// occurred.
++ (NSArray *)modelsOfClass:(Class)modelClass fromMessagePackData:(NSData *)data error:(NSError **)error;
+
+/// Converts a model into MessagePack data.
+///
+/// model - The model to serialize. This argument must not be nil.
+/// error - If not NULL, this may be set to an error that occurs during
+///         serializing.
+///
+/// Returns MessagePack data containing a single map, or nil if a serialization
+/// error occurred.
++ (NSData *)messagePackDataFromModel:(id<MTLJSONSerializing>)model error:(NSError **)error;
+
+/// Converts an array of models into MessagePack data.
+///
+/// models - The array of models to serialize. This argument must not be nil.
+/// error  - If not NULL, this may be set to an error that occurs during
+///          serializing.
+///
+/// Returns MessagePack data containing a single array of maps, or nil if a
+/// serialization error occurred for any model.
++ (NSData *)messagePackDataFromModels:(NSArray *)models error:(NSError **)error;
+
+/// Deserializes a model from MessagePack data.
+///
+/// Like -modelFromJSONData:error:, this consults the receiver's `payloadCache`,
+/// if any.
+///
+/// data  - MessagePack data containing a single map. If this argument is nil,
+///         the method returns nil.
+/// error - If not NULL, this may be set to an error that occurs during reading
+///         the data, or deserializing the model.
+///
+/// Returns a model object, or nil if an error occurred.
+- (id)modelFromMessagePackData:(NSData *)data error:(NSError **)error;
+
+/// Serializes a model into MessagePack data.
+///
+/// model - The model to serialize. This argument must not be nil.
+/// error - If not NULL, this may be set to an error that occurs during
+///         serializing.
+///
+/// Returns MessagePack data, or nil if a serialization error occurred.
+- (NSData *)messagePackDataFromModel:(id<MTLJSONSerializing>)model error:(NSError **)error;
+
+@end
@@ -0,0 +1,67 @@
+//
+//  MTLMessagePackSerialization.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/// The domain for errors originating from MTLMessagePackSerialization.
+extern NSString * const MTLMessagePackSerializationErrorDomain;
+
+/// An object could not be represented in MessagePack.
+extern const NSInteger MTLMessagePackSerializationErrorUnsupportedType;
+
+/// The data ended in the middle of an object.
+extern const NSInteger MTLMessagePackSerializationErrorTruncatedData;
+
+/// The data is not valid MessagePack, or uses a feature which is not supported,
+/// like an unknown extension type.
+extern const NSInteger MTLMessagePackSerializationErrorInvalidData;
+
+/// Associated with the byte offset at which invalid data was found.
+extern NSString * const MTLMessagePackSerializationOffsetErrorKey;
+
+/// Converts between MessagePack data and Foundation objects, like
+/// NSJSONSerialization does for JSON.
+///
+/// MessagePack types are mapped to these classes:
+///
+///  - nil: NSNull
+///  - bool: NSNumber, created from a BOOL
+///  - int and uint: NSNumber, created from a long long or unsigned long long
+///  - float 32 and float 64: NSNumber, created from a float or double
+///  - str: NSString, which must be valid UTF-8
+///  - bin: NSData
+///  - array: NSArray
+///  - map: NSDictionary
+///  - timestamp extension: NSDate
+///
+/// Other extension types cannot be read. When writing, numbers use the smallest
+/// encoding which preserves their value.
+@interface MTLMessagePackSerialization : NSObject
+
+/// Serializes an object graph into MessagePack data.
+///
+/// object - An object of one of the supported classes. Collections may only
+///          contain objects of supported classes. If nil, a MessagePack nil is
+///          written.
+/// error  - If not NULL, this may be set to an error which occurs during
+///          serialization.
+///
+/// Returns the MessagePack data, or nil if `object` could not be serialized.
++ (NSData *)dataWithMessagePackObject:(id)object error:(NSError **)error;
+
+/// Deserializes a single MessagePack object.
+///
+/// data  - The MessagePack data, which must contain exactly one object. This
+///         argument must not be nil.
+/// error - If not NULL, this may be set to an error which occurs during
+///         deserialization.
+///
+/// Returns the deserialized object, or nil if the data was invalid.
++ (id)messagePackObjectWithData:(NSData *)data error:(NSError **)error;
+
+@end
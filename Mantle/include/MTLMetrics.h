@@ -0,0 +1,168 @@
+//
+//  MTLMetrics.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/// The kinds of work measured by MTLMetrics.
+///
+/// MTLMetricKindDecode                - Decoding one model from a JSON
+///                                      dictionary with MTLJSONAdapter,
+///                                      including any nested models. Reported
+///                                      for the model class.
+/// MTLMetricKindEncode                - Encoding one model into a JSON
+///                                      dictionary with MTLJSONAdapter,
+///                                      including any nested models. Reported
+///                                      for the model class.
+/// MTLMetricKindTransform             - Transforming one JSON value into a
+///                                      property value. Reported for the model
+///                                      class and property key.
+/// MTLMetricKindReverseTransform      - Transforming one property value into a
+///                                      JSON value. Reported for the model
+///                                      class and property key.
+/// MTLMetricKindValidation            - Validating one decoded model. Reported
+///                                      for the model class.
+/// MTLMetricKindAdapterCacheHit       - An adapter reused its cached adapter
+///                                      for a model subclass, or for a class
+///                                      returned from
+///                                      +classForParsingJSONDictionary:.
+///                                      Reported for that class.
+/// MTLMetricKindAdapterCacheMiss      - An adapter had to create an adapter for
+///                                      such a class.
+/// MTLMetricKindTransformerCacheHit   - An MTLMemoizingValueTransformer answered
+///                                      from its cache.
+/// MTLMetricKindTransformerCacheMiss  - An MTLMemoizingValueTransformer invoked
+///                                      the transformer it wraps.
+/// MTLMetricKindReflectionCacheHit    - +[MTLModel propertyKeys] returned its
+///                                      cached result. Reported for the model
+///                                      class.
+/// MTLMetricKindReflectionCacheMiss   - +[MTLModel propertyKeys] had to inspect
+///                                      the model class.
+/// MTLMetricKindShapeCacheHit         - An adapter fully decoded a JSON
+///                                      dictionary whose shape it had already
+///                                      specialized a decoder for. Reported
+///                                      for the model class, without a
+///                                      duration.
+/// MTLMetricKindShapeCacheMiss        - An adapter fully decoded a JSON
+///                                      dictionary without a specialized
+///                                      decoder, because its shape was new or
+///                                      the adapter's shapes were full.
+///                                      Reported like hits. Partial updates
+///                                      record neither.
+typedef enum : NSUInteger {
+	MTLMetricKindDecode,
+	MTLMetricKindEncode,
+	MTLMetricKindTransform,
+	MTLMetricKindReverseTransform,
+	MTLMetricKindValidation,
+	MTLMetricKindAdapterCacheHit,
+	MTLMetricKindAdapterCacheMiss,
+	MTLMetricKindTransformerCacheHit,
+	MTLMetricKindTransformerCacheMiss,
+	MTLMetricKindReflectionCacheHit,
+	MTLMetricKindReflectionCacheMiss,
+	MTLMetricKindShapeCacheHit,
+	MTLMetricKindShapeCacheMiss,
+} MTLMetricKind;
+
+/// Receives each measurement made while metrics are enabled.
+@protocol MTLMetricsSink <NSObject>
+
+/// Records one measurement.
+///
+/// This is invoked synchronously on the thread which did the work, possibly
+/// from many threads at once, so implementations must be thread-safe and
+/// should return quickly.
+///
+/// kind        - The kind of work which was measured.
+/// modelClass  - The model class the work was done for, or Nil if it was not
+///               done for a particular class.
+/// propertyKey - The property the work was done for, or nil if it was not done
+///               for a particular property.
+/// duration    - How long the work took in nanoseconds, or 0 for cache
+///               lookups.
+/// success     - Whether the work succeeded.
+/// error       - The error the work failed with, if any.
+- (void)recordMetricOfKind:(MTLMetricKind)kind modelClass:(Class)modelClass propertyKey:(NSString *)propertyKey duration:(uint64_t)duration success:(BOOL)success error:(NSError *)error;
+
+@end
+
+/// Aggregated measurements of one kind of work.
+@interface MTLMetricStatistics : NSObject
+
+/// The number of times the work was done.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/// The number of times the work failed.
+@property (nonatomic, assign, readonly) NSUInteger failureCount;
+
+/// The total time spent in nanoseconds.
+@property (nonatomic, assign, readonly) uint64_t totalDuration;
+
+/// The longest single duration in nanoseconds.
+@property (nonatomic, assign, readonly) uint64_t maximumDuration;
+
+@end
+
+/// An immutable copy of the measurements made since metrics were last reset.
+@interface MTLMetricsSnapshot : NSObject
+
+/// The model classes which have been measured.
+@property (nonatomic, copy, readonly) NSSet *modelClasses;
+
+/// Returns the statistics of a kind of work across all model classes and
+/// properties, including work not done for any class.
+- (MTLMetricStatistics *)statisticsForKind:(MTLMetricKind)kind;
+
+/// Returns the statistics of a kind of work done for a model class, across all
+/// of its properties.
+- (MTLMetricStatistics *)statisticsForKind:(MTLMetricKind)kind modelClass:(Class)modelClass;
+
+/// Returns the statistics of a kind of work done for one property of a model
+/// class.
+- (MTLMetricStatistics *)statisticsForKind:(MTLMetricKind)kind modelClass:(Class)modelClass propertyKey:(NSString *)propertyKey;
+
+/// Returns the failures of a kind of work, as a dictionary mapping error
+/// domains to dictionaries, which map NSNumber error codes to NSNumber counts.
+///
+/// An error which propagates through several measured operations, like a
+/// transformer error which fails a decode, is counted once for each kind.
+- (NSDictionary *)errorCountsForKind:(MTLMetricKind)kind;
+
+@end
+
+/// Opt-in measurement of MTLJSONAdapter and MTLModel internals.
+///
+/// Metrics are disabled by default, in which case each measurement point costs
+/// a single branch. Once enabled, every measurement is added to a cumulative
+/// set of statistics, and then forwarded to any added sinks.
+@interface MTLMetrics : NSObject
+
+/// Whether measurements are being made.
++ (BOOL)isEnabled;
+
+/// Enables or disables measurements.
+///
+/// Work which is in progress when metrics are disabled may still be reported.
++ (void)setEnabled:(BOOL)enabled;
+
+/// Adds a sink which will receive every following measurement.
+///
+/// sink - The sink to add, which is retained until it is removed. This
+///        argument must not be nil.
++ (void)addSink:(id<MTLMetricsSink>)sink;
+
+/// Removes a previously added sink.
++ (void)removeSink:(id<MTLMetricsSink>)sink;
+
+/// Returns a copy of the statistics collected since the last reset.
++ (MTLMetricsSnapshot *)snapshot;
+
+/// Discards all collected statistics.
++ (void)reset;
+
+@end
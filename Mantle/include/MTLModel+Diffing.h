@@ -0,0 +1,50 @@
+//
+//  MTLModel+Diffing.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#if __has_include(<Mantle/MTLModel.h>)
+#import <Mantle/MTLModel.h>
+#else
+#import "MTLModel.h"
+#endif
+
+/// Finds the properties which differ between two models, without building the
+/// -dictionaryValue of either.
+///
+/// Like -isEqual:, only properties for which +storageBehaviorForPropertyWithKey:
+/// returns MTLPropertyStoragePermanent are compared. Scalars are compared
+/// without boxing them, and objects are compared by pointer before falling
+/// back to -isEqual:.
+@interface MTLModel (Diffing)
+
+/// Returns the keys of the properties whose values differ between the receiver
+/// and `model`, sorted by key.
+///
+/// model - The model to compare with, which must be an instance of the
+///         receiver's class. This argument must not be nil.
+///
+/// Returns an empty array if the models are equal.
+- (NSArray *)changedPropertyKeysComparedToModel:(MTLModel *)model;
+
+/// Returns the key paths of all values which differ between the receiver and
+/// `model`, descending into nested models and arrays.
+///
+/// Properties holding models of the same class on both sides are compared
+/// recursively, so a change in a nested model is reported as a key path like
+/// `author.name`. Arrays of the same length are compared element by element,
+/// and changes are reported with the index as a component, like `comments.2`
+/// or `comments.2.body`. Any other differing value, including arrays of
+/// different lengths, is reported by its own key path.
+///
+/// model - The model to compare with, which must be an instance of the
+///         receiver's class. This argument must not be nil.
+///
+/// Returns the differing key paths in the order they were found, or an empty
+/// array if the models are equal.
+- (NSArray *)changedKeyPathsComparedToModel:(MTLModel *)model;
+
+@end
@@ -0,0 +1,70 @@
+//
+//  MTLModel+Updating.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#if __has_include(<Mantle/MTLModel.h>)
+#import <Mantle/MTLModel.h>
+#else
+#import "MTLModel.h"
+#endif
+
+/// The domain for errors originating from MTLModel (Updating).
+extern NSString * const MTLModelUpdatingErrorDomain;
+
+/// A key does not name one of the +propertyKeys of the model it was applied
+/// to.
+extern const NSInteger MTLModelUpdatingErrorUnknownKey;
+
+/// A key path runs through a value which is neither a model nor an array, or
+/// through an array index which is out of bounds.
+extern const NSInteger MTLModelUpdatingErrorInvalidKeyPath;
+
+/// Associated with the key path which could not be resolved.
+extern NSString * const MTLModelUpdatingKeyPathErrorKey;
+
+/// Derives updated models from existing ones without mutating them.
+///
+/// Updated models share all values which did not change with the model they
+/// were derived from, instead of copying them. Unchanged properties are
+/// carried over through their accessors, without building a -dictionaryValue,
+/// and only the updated values are validated.
+@interface MTLModel (Updating)
+
+/// Returns a model with the values of the given properties replaced.
+///
+/// values - Property keys and their new values. Any NSNull values will be
+///          converted to nil before being used. KVC validation methods are
+///          invoked for these properties only. This argument must not be nil.
+/// error  - If not NULL, this may be set to any error that occurs (like a KVC
+///          validation error).
+///
+/// Returns a new instance of the receiver's class. If none of the values
+/// differ from the receiver's, and +instancesAreImmutable returns YES, the
+/// receiver itself is returned. Returns nil if a key is unknown or validation
+/// failed.
+- (instancetype)modelByUpdatingValues:(NSDictionary *)values error:(NSError **)error;
+
+/// Returns a model with the value at the given key path replaced.
+///
+/// Nested models along the key path are replaced by updated models as well,
+/// while everything else is shared with the receiver. Components of the key
+/// path which follow an array are interpreted as indexes into it, so that
+/// `comments.2.body` updates the body of the third comment, as reported by
+/// -changedKeyPathsComparedToModel:.
+///
+/// value   - The new value, which may be nil.
+/// keyPath - The key path of the value to replace, starting with one of the
+///           +propertyKeys of the receiver. This argument must not be nil.
+/// error   - If not NULL, this may be set to any error that occurs (like a KVC
+///           validation error).
+///
+/// Returns the updated model, the receiver if no value changed and
+/// +instancesAreImmutable returns YES, or nil if the key path could not be
+/// resolved or validation failed.
+- (instancetype)modelBySettingValue:(id)value forKeyPath:(NSString *)keyPath error:(NSError **)error;
+
+@end
@@ -143,6 +143,17 @@ typedef enum : NSUInteger {
 /// Returns the storage behavior for a given key on the receiver.
 + (MTLPropertyStorage)storageBehaviorForPropertyWithKey:(NSString *)propertyKey;
 
+/// Whether instances of the receiver are never mutated once they have been
+/// initialized.
+///
+/// If YES, -copy returns the receiver itself instead of building a new
+/// instance, since the two could never differ anyway. Use
+/// -modelByUpdatingValues:error: or -modelBySettingValue:forKeyPath:error: to
+/// derive changed models instead of mutating a copy.
+///
+/// The default implementation returns NO.
++ (BOOL)instancesAreImmutable;
+
 /// Compares the receiver with another object for equality.
 ///
 /// The default implementation is equivalent to comparing all properties of both
@@ -0,0 +1,79 @@
+//
+//  MTLPayloadCache.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/// A content-addressed cache of decoded payloads, which lets byte-identical
+/// responses skip decoding entirely.
+///
+/// Entries are keyed by the model class, the configuration of the decoder, and
+/// the SHA-256 digest of the payload bytes, so payloads are not kept alive by
+/// the cache. The cost of an entry is an estimate of the memory used by its
+/// decoded object graph, and the least recently used entries are evicted once
+/// the total exceeds `totalByteLimit`.
+///
+/// Cached objects are returned to every caller decoding the same payload, so
+/// they must be treated as immutable. In particular, they must not be passed to
+/// -[MTLJSONAdapter updateModel:fromJSONDictionary:error:], which asserts
+/// this.
+///
+/// Caches are thread-safe.
+@interface MTLPayloadCache : NSObject
+
+/// Initializes the receiver with a byte budget.
+///
+/// totalByteLimit - The maximum estimated size of all cached objects, in bytes.
+///                  This must be greater than 0.
+- (instancetype)initWithTotalByteLimit:(NSUInteger)totalByteLimit;
+
+/// The maximum estimated size of all cached objects, in bytes.
+@property (nonatomic, assign, readonly) NSUInteger totalByteLimit;
+
+/// The estimated size of all cached objects, in bytes.
+///
+/// This counts the allocations of the objects, of the collections and model
+/// properties they reference, and the bytes of NSData objects, with objects
+/// shared within a graph counted once.
+@property (atomic, assign, readonly) NSUInteger totalBytes;
+
+/// The number of cached payloads.
+@property (atomic, assign, readonly) NSUInteger count;
+
+/// The number of lookups which found a decoded payload.
+@property (atomic, assign, readonly) NSUInteger hitCount;
+
+/// The number of lookups which had to decode the payload.
+@property (atomic, assign, readonly) NSUInteger missCount;
+
+/// Invokes -objectForPayload:modelClass:configuration:decodingWithBlock: with
+/// a nil configuration.
+- (id)objectForPayload:(NSData *)payload modelClass:(Class)modelClass decodingWithBlock:(id (^)(void))block;
+
+/// Returns the cached result of decoding a payload into `modelClass`, or
+/// decodes it with `block` and caches the result.
+///
+/// Objects whose estimated size alone exceeds `totalByteLimit` are returned
+/// without being cached.
+///
+/// payload       - The bytes to decode. This argument must not be nil.
+/// modelClass    - The class the payload is decoded into, which is part of the
+///                 key. This argument must not be nil.
+/// configuration - Anything else which affects the result of `block`, like the
+///                 options of the decoder, compared with -isEqual:. This is
+///                 part of the key, and retained by the cache while the entry
+///                 exists. May be nil.
+/// block         - Decodes the payload, returning nil on failure. Failures are
+///                 never cached. This argument must not be nil.
+///
+/// Returns the decoded object, or nil if `block` failed.
+- (id)objectForPayload:(NSData *)payload modelClass:(Class)modelClass configuration:(id)configuration decodingWithBlock:(id (^)(void))block;
+
+/// Removes all cached payloads. The hit and miss counts are not reset.
+- (void)removeAllObjects;
+
+@end
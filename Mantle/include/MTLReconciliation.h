@@ -0,0 +1,64 @@
+//
+//  MTLReconciliation.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#if __has_include(<Mantle/MTLModel.h>)
+#import <Mantle/MTLModel.h>
+#else
+#import "MTLModel.h"
+#endif
+
+@interface MTLModel (Identity)
+
+/// The keys of the properties which together identify an instance, regardless
+/// of its other values, like a server-assigned ID.
+///
+/// Subclasses must override this method to be reconciled with
+/// MTLReconciliation.
+///
+/// Returns nil by default.
++ (NSArray *)identityPropertyKeys;
+
+@end
+
+/// Reconciles an existing collection of models with a freshly decoded one,
+/// matching models by their +identityPropertyKeys.
+///
+/// Existing models are indexed by identity in a hash table, so reconciliation
+/// takes time linear in the size of both collections. Existing models whose
+/// counterpart has changed are updated in place with
+/// -mergeValuesForKeysFromModel:, so references to them stay valid. Unchanged
+/// models are left alone.
+@interface MTLReconciliation : NSObject
+
+/// Reconciles two collections of models.
+///
+/// Identities must be unique within each collection. Models of a different
+/// class than their counterpart are not merged, but count as removed and
+/// inserted instead.
+///
+/// existingModels - The models currently in use. This argument must not be
+///                  nil.
+/// incomingModels - The models that should replace them, in their new order.
+///                  This argument must not be nil.
++ (instancetype)reconciliationWithExistingModels:(NSArray *)existingModels incomingModels:(NSArray *)incomingModels;
+
+/// The reconciled collection, in the order of the incoming models, with every
+/// matched model replaced by its existing (and possibly updated) instance.
+@property (nonatomic, copy, readonly) NSArray *models;
+
+/// Incoming models which matched no existing model, in their incoming order.
+@property (nonatomic, copy, readonly) NSArray *insertedModels;
+
+/// Existing models which have been updated with the values of their
+/// counterpart, in the incoming order.
+@property (nonatomic, copy, readonly) NSArray *updatedModels;
+
+/// Existing models which matched no incoming model, in their existing order.
+@property (nonatomic, copy, readonly) NSArray *removedModels;
+
+@end
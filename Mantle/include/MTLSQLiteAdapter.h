@@ -0,0 +1,178 @@
+//
+//  MTLSQLiteAdapter.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@protocol MTLModel;
+
+/// A MTLModel object that supports being stored in and loaded from a SQLite
+/// table.
+@protocol MTLSQLiteSerializing <MTLModel>
+@required
+
+/// The name of the table which stores instances of the receiver.
++ (NSString *)SQLiteTableName;
+
+/// Specifies how to map property keys to column names, like
+/// +JSONKeyPathsByPropertyKey does for JSON.
+///
+/// Any keys omitted will not be stored. Every key must be one of the
+/// +propertyKeys of the receiver.
+///
+/// Values are stored without conversion if they are scalars, or of class
+/// NSNumber, NSString, NSData, NSDate (as seconds since 1970) or NSURL (as its
+/// absolute string). Properties of other types must have a transformer.
+///
+/// SQLite integers are signed, so unsigned values greater than INT64_MAX
+/// cannot be stored, and dates can only be loaded from numeric columns.
++ (NSDictionary *)SQLiteColumnNamesByPropertyKey;
+
+@optional
+
+/// The property keys of the table's primary key, in order.
+///
+/// Saving a model with -saveModels:error: updates the row with an equal
+/// primary key. If not implemented, rows are only identified by their rowid,
+/// so saving always inserts new rows.
++ (NSArray *)SQLitePrimaryKeyPropertyKeys;
+
+/// Specifies how to convert a stored value into the value of the given
+/// property key, and back. The transformer must convert between the property's
+/// values and NSNumbers, NSStrings or NSDatas, and be reversible to store
+/// models.
+///
+/// Returns a value transformer, or nil if the value is stored without
+/// conversion.
++ (NSValueTransformer *)SQLiteTransformerForKey:(NSString *)key;
+
+@end
+
+/// The domain for errors originating from MTLSQLiteAdapter.
+extern NSString * const MTLSQLiteAdapterErrorDomain;
+
+/// A SQLite call failed. The result code is associated with
+/// MTLSQLiteAdapterResultCodeErrorKey.
+extern const NSInteger MTLSQLiteAdapterErrorSQLite;
+
+/// A value cannot be stored in SQLite, or a stored value cannot be converted
+/// into the value of its property.
+extern const NSInteger MTLSQLiteAdapterErrorUnsupportedValue;
+
+/// +SQLiteColumnNamesByPropertyKey or +SQLitePrimaryKeyPropertyKeys names a
+/// key which is not a property, or is not mapped.
+extern const NSInteger MTLSQLiteAdapterErrorInvalidMapping;
+
+/// Associated with the SQLite result code of a failed call.
+extern NSString * const MTLSQLiteAdapterResultCodeErrorKey;
+
+/// Stores MTLModel objects conforming to <MTLSQLiteSerializing> in a SQLite
+/// database, and loads them back.
+///
+/// Prepared statements are cached per model class, values are bound and read
+/// without boxing scalars, and rows are set directly on new models without
+/// building dictionaries. Writes of multiple models happen in a single
+/// transaction.
+///
+/// Adapters are thread-safe, but serialize all work on their database
+/// connection.
+@interface MTLSQLiteAdapter : NSObject
+
+/// Opens or creates a database.
+///
+/// URL   - The file URL of the database, or nil to use a temporary in-memory
+///         database.
+/// error - If not NULL, this may be set to an error that occurs while opening
+///         the database.
+///
+/// Returns an adapter, or nil if the database could not be opened.
+- (instancetype)initWithURL:(NSURL *)URL error:(NSError **)error;
+
+/// The file URL of the database, or nil if it is in memory.
+@property (nonatomic, copy, readonly) NSURL *URL;
+
+/// Executes SQL statements which do not return rows, like the creation of
+/// indexes.
+///
+/// SQL   - One or more SQL statements. This argument must not be nil.
+/// error - If not NULL, this may be set to an error that occurs while
+///         executing.
+///
+/// Returns whether all statements succeeded.
+- (BOOL)executeSQL:(NSString *)SQL error:(NSError **)error;
+
+/// Creates the table for a model class, unless it already exists.
+///
+/// Columns are declared with the type affinity of their properties, and the
+/// primary key of +SQLitePrimaryKeyPropertyKeys, if any.
+///
+/// modelClass - A class conforming to <MTLSQLiteSerializing>. This argument
+///              must not be nil.
+/// error      - If not NULL, this may be set to an error that occurs while
+///              creating the table.
+///
+/// Returns whether the table exists.
+- (BOOL)createTableForModelClass:(Class)modelClass error:(NSError **)error;
+
+/// Inserts new rows for models, in a single transaction.
+///
+/// models - Models conforming to <MTLSQLiteSerializing>, which may be of
+///          different classes. This argument must not be nil.
+/// error  - If not NULL, this may be set to an error that occurs while
+///          inserting, like a violation of the primary key.
+///
+/// Returns whether all models were inserted. If any insertion fails, none of
+/// the models are.
+- (BOOL)insertModels:(NSArray *)models error:(NSError **)error;
+
+/// Inserts rows for models, or updates the rows with the same primary key, in
+/// a single transaction.
+///
+/// Existing rows are updated in place rather than replaced, so they keep their
+/// rowid and the values of unmapped columns. Models of classes without a
+/// primary key are always inserted.
+///
+/// models - Models conforming to <MTLSQLiteSerializing>, which may be of
+///          different classes. This argument must not be nil.
+/// error  - If not NULL, this may be set to an error that occurs while
+///          saving.
+///
+/// Returns whether all models were saved. If any save fails, none of the
+/// models are.
+- (BOOL)saveModels:(NSArray *)models error:(NSError **)error;
+
+/// Loads models from the rows of their table.
+///
+/// modelClass - A class conforming to <MTLSQLiteSerializing>. This argument
+///              must not be nil.
+/// predicate  - An SQL expression which rows must match, like
+///              `"age > ? ORDER BY name"`, or nil to load all rows. Statements
+///              are cached per predicate, so values should be passed as
+///              arguments.
+/// arguments  - The values bound to the parameters of `predicate`, which must
+///              be of one of the classes that can be stored. May be nil.
+/// error      - If not NULL, this may be set to an error that occurs while
+///              loading or validating the models.
+///
+/// Returns the loaded models, or nil if an error occurred.
+- (NSArray *)modelsOfClass:(Class)modelClass where:(NSString *)predicate arguments:(NSArray *)arguments error:(NSError **)error;
+
+/// Runs a block inside a transaction, which is committed if the block
+/// succeeds, and rolled back otherwise.
+///
+/// Transactions may be nested, in which case an inner failure only rolls back
+/// the changes of the inner block.
+///
+/// block - The work to perform using the receiver, which must return whether it
+///         succeeded. This argument must not be nil.
+/// error - If not NULL, this may be set to the error of the block, or an error
+///         that occurs while committing.
+///
+/// Returns whether the transaction was committed.
+- (BOOL)performTransaction:(BOOL (^)(NSError **error))block error:(NSError **)error;
+
+@end
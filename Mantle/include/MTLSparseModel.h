@@ -0,0 +1,62 @@
+//
+//  MTLSparseModel.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#if __has_include(<Mantle/MTLModel.h>)
+#import <Mantle/MTLModel.h>
+#else
+#import "MTLModel.h"
+#endif
+
+/// A model which stores its properties in a sparse table instead of instance
+/// variables, for very wide models of which any instance only populates a few
+/// properties.
+///
+/// Subclasses opt properties into sparse storage by declaring them `@dynamic`
+/// in their implementation:
+///
+///     @interface MTLIssue : MTLSparseModel
+///
+///     @property (nonatomic, copy, readonly) NSString *title;
+///     @property (nonatomic, assign, readonly) NSUInteger commentCount;
+///
+///     @end
+///
+///     @implementation MTLIssue
+///
+///     @dynamic title;
+///     @dynamic commentCount;
+///
+///     @end
+///
+/// Accessors for these properties are added at runtime, including setters for
+/// `readonly` properties so that they can be set through key-value coding like
+/// ordinary Mantle properties. Object and bool, integer or floating-point
+/// properties are supported. Any other `@dynamic` property, as well as weak
+/// properties, are left for the subclass to implement.
+///
+/// Each instance only stores a bitmap with one bit per sparse property, and the
+/// values of the properties which are populated. Setting an object property to
+/// nil, or a scalar property to zero, depopulates it. Scalars are stored boxed.
+///
+/// -isEqual:, -hash, -copy, -dictionaryValue and archiving only visit the
+/// populated sparse properties, and treat all others as nil or zero. Properties
+/// which are not sparse, like ones backed by instance variables, are handled as
+/// in MTLModel.
+///
+/// Like any other model, instances are not safe to mutate from multiple threads
+/// at once.
+@interface MTLSparseModel : MTLModel
+
+/// The number of sparse properties of the receiver which are populated.
+@property (nonatomic, assign, readonly) NSUInteger populatedSparsePropertyCount;
+
+/// Returns the keys of all properties of the receiver which are stored
+/// sparsely, sorted by key.
++ (NSArray *)sparsePropertyKeys;
+
+@end
@@ -0,0 +1,61 @@
+//
+//  MTLStringInterningPool.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/// A thread-safe pool of canonical string instances.
+///
+/// JSON payloads frequently repeat the same string values (states, logins,
+/// label names), and each occurrence would otherwise be retained as a separate
+/// NSString. Passing strings through a pool returns one shared instance for
+/// all equal strings.
+///
+/// Assign a pool to -[MTLJSONAdapter stringInterningPool] to deduplicate the
+/// NSString property values of the models the adapter creates.
+@interface MTLStringInterningPool : NSObject
+
+/// A process-wide pool, limited to one megabyte of string contents.
++ (instancetype)sharedPool;
+
+/// Initializes a pool without a limit on the number of bytes it may retain.
+- (instancetype)init;
+
+/// Initializes a pool which retains at most `byteLimit` bytes of string
+/// contents.
+///
+/// byteLimit - The maximum number of bytes the pool may retain, as estimated
+///             from the UTF-16 length of each string. Once the limit has been
+///             reached, new strings are returned without being added to the
+///             pool. If 0, the pool is unbounded.
+///
+/// This is the designated initializer for this class.
+- (instancetype)initWithByteLimit:(NSUInteger)byteLimit;
+
+/// The maximum number of bytes the pool may retain, or 0 if unbounded.
+@property (nonatomic, assign, readonly) NSUInteger byteLimit;
+
+/// The estimated number of bytes currently retained by the pool.
+@property (atomic, assign, readonly) NSUInteger byteCount;
+
+/// The number of distinct strings in the pool.
+@property (atomic, assign, readonly) NSUInteger count;
+
+/// Returns the canonical instance for a string.
+///
+/// string - The string to intern. If nil, this method returns nil.
+///
+/// Returns a previously interned string equal to `string` if there is one.
+/// Otherwise, an immutable copy of `string` is added to the pool and returned,
+/// unless that would exceed the receiver's byte limit or the string is longer
+/// than 1024 characters, in which case `string` itself is returned.
+- (NSString *)internedString:(NSString *)string;
+
+/// Removes all strings from the pool.
+- (void)removeAllStrings;
+
+@end
@@ -0,0 +1,105 @@
+//
+//  MTLTrace.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/// The stages of the conversion pipeline recorded by MTLTrace.
+///
+/// MTLTraceStageDecode              - Decoding one model from a JSON dictionary,
+///                                    enclosing the decode stages below.
+/// MTLTraceStageClassDispatch       - Invoking +classForParsingJSONDictionary:.
+/// MTLTraceStageKeyPathExtraction   - Reading the JSON value for one property.
+/// MTLTraceStageTransform           - Transforming one JSON value into a
+///                                    property value.
+/// MTLTraceStageModelInitialization - Creating the model from its property
+///                                    values.
+/// MTLTraceStageValidation          - Validating the created model.
+/// MTLTraceStageEncode              - Encoding one model into a JSON
+///                                    dictionary, enclosing the encode stages
+///                                    below.
+/// MTLTraceStageDictionaryValue     - Reading the property values of the model.
+/// MTLTraceStageReverseTransform    - Transforming one property value into a
+///                                    JSON value.
+/// MTLTraceStageKeyPathInsertion    - Storing one JSON value at its key paths.
+typedef enum : NSUInteger {
+	MTLTraceStageDecode,
+	MTLTraceStageClassDispatch,
+	MTLTraceStageKeyPathExtraction,
+	MTLTraceStageTransform,
+	MTLTraceStageModelInitialization,
+	MTLTraceStageValidation,
+	MTLTraceStageEncode,
+	MTLTraceStageDictionaryValue,
+	MTLTraceStageReverseTransform,
+	MTLTraceStageKeyPathInsertion,
+} MTLTraceStage;
+
+/// Records the begin and end of each stage of MTLJSONAdapter's conversions, for
+/// inspection in a trace viewer like chrome://tracing or Perfetto.
+///
+/// Each thread records into its own fixed-size ring buffer without taking any
+/// locks, keeping only its most recent +eventsPerBuffer events. When a thread
+/// exits, its buffer is freed, and its events are moved into a buffer shared by
+/// all exited threads, which keeps their most recent events as well.
+///
+/// Each event takes 24 bytes, so with the default of 4096 events, every thread
+/// which records even a single event allocates 96 KB, and the exited threads
+/// share another 96 KB. Concurrent conversions, like those of
+/// MTLJSONAdapter (Asynchronous), record on one thread per processor.
+///
+/// Tracing is disabled by default, in which case each trace point costs a
+/// single branch. Defining MTL_TRACE_DISABLED to 1 when building Mantle removes
+/// the trace points entirely.
+@interface MTLTrace : NSObject
+
+/// Whether stages are being recorded.
++ (BOOL)isEnabled;
+
+/// Enables or disables recording.
+///
+/// A stage which has begun when recording is disabled still records its end.
+/// This has no effect if Mantle was built with MTL_TRACE_DISABLED.
++ (void)setEnabled:(BOOL)enabled;
+
+/// The number of events kept by each thread's ring buffer, and by the buffer
+/// of exited threads. Defaults to 4096, unless Mantle was built with another
+/// MTL_TRACE_DEFAULT_EVENTS_PER_BUFFER.
++ (NSUInteger)eventsPerBuffer;
+
+/// Sets the number of events kept by each buffer created from now on.
+///
+/// Threads which have already recorded events, and the buffer of exited
+/// threads once one has exited, keep their capacity. Set this before enabling
+/// recording to change the capacity of all buffers.
+///
+/// eventsPerBuffer - The number of events, which costs 24 bytes each. This
+///                   must be greater than 0.
++ (void)setEventsPerBuffer:(NSUInteger)eventsPerBuffer;
+
+/// Returns the recorded events in the Chrome trace event format, as an array of
+/// JSON dictionaries with "name", "cat", "ph", "ts", "pid", "tid" and "args"
+/// keys. The name of the model class is stored in "args" under "class".
+///
+/// This may be called while other threads are recording, in which case their
+/// oldest events may be left out, as they could be overwritten during the
+/// export.
++ (NSArray *)chromeTraceEvents;
+
+/// Writes all recorded events as a Chrome trace JSON file.
+///
+/// URL   - The file URL to write to. This argument must not be nil.
+/// error - If not NULL, this may be set to an error that occurs during
+///         serialization or writing.
+///
+/// Returns whether the file was written.
++ (BOOL)writeChromeTraceToURL:(NSURL *)URL error:(NSError **)error;
+
+/// Discards all events recorded so far.
++ (void)reset;
+
+@end
@@ -0,0 +1,54 @@
+//
+//  MTLTransformerBatchHandling.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+#if __has_include(<Mantle/MTLTransformerErrorHandling.h>)
+#import <Mantle/MTLTransformerErrorHandling.h>
+#else
+#import "MTLTransformerErrorHandling.h"
+#endif
+
+/// This protocol can be implemented by NSValueTransformer subclasses which can
+/// transform many values at once more efficiently than one at a time.
+///
+/// Collection transformers like the one returned from
+/// +mtl_arrayMappingTransformerWithTransformer: use it to transform all
+/// elements of an array with a single message.
+@protocol MTLTransformerBatchHandling <MTLTransformerErrorHandling>
+@required
+
+/// Transforms each of the given values, as if by sending
+/// -transformedValue:success:error: for every element.
+///
+/// values  - The values to transform. This argument must not be nil.
+/// success - If not NULL, this will be set to a boolean indicating whether all
+///           transformations were successful.
+/// error   - If not NULL, this may be set to an error if any transformation
+///           fails. The error uses MTLTransformerErrorHandlingErrorDomain and
+///           associates MTLTransformerErrorHandlingIndexErrorKey with the
+///           index of the first value that failed, and NSUnderlyingErrorKey
+///           with its error, if any.
+///
+/// Returns a pointer array with one transformed value for each element of
+/// `values`, in the same order, where NULL stands in for nil results, or nil if
+/// any transformation fails. NSNull results are kept as they are.
+- (NSPointerArray *)transformedValues:(NSArray *)values success:(BOOL *)success error:(NSError **)error;
+
+@optional
+
+/// Reverse-transforms each of the given values, as if by sending
+/// -reverseTransformedValue:success:error: for every element.
+///
+/// Transformers conforming to this protocol are expected to implement this
+/// method if they support reverse transformation.
+///
+/// See -transformedValues:success:error: for the arguments and return value.
+- (NSPointerArray *)reverseTransformedValues:(NSArray *)values success:(BOOL *)success error:(NSError **)error;
+
+@end
@@ -27,6 +27,10 @@ extern const NSInteger MTLTransformerErrorHandlingErrorInvalidInput;
 /// with the invalid input in the userInfo dictionary.
 extern NSString * const MTLTransformerErrorHandlingInputValueErrorKey;
 
+/// Associated with an NSNumber holding the index of the element which could
+/// not be transformed, when transforming a collection.
+extern NSString * const MTLTransformerErrorHandlingIndexErrorKey;
+
 /// This protocol can be implemented by NSValueTransformer subclasses to
 /// communicate errors that occur during transformation.
 @protocol MTLTransformerErrorHandling <NSObject>
@@ -0,0 +1,53 @@
+//
+//  MTLUniquingContext.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class MTLModel;
+
+/// An identity map, which keeps one canonical instance per model class and
+/// identity, so that the same entity decoded many times is only kept in memory
+/// once.
+///
+/// Models are identified by the +identityPropertyKeys of their class. Models
+/// of classes without identity keys, and models with a nil value for any
+/// identity key, are never uniqued.
+///
+/// Canonical instances are referenced weakly, so a context never keeps models
+/// alive by itself, and can be kept for as long as decoded models should be
+/// shared, like the lifetime of an account.
+///
+/// Contexts are thread-safe, and never mutate canonical instances, so they can
+/// be read on any thread.
+@interface MTLUniquingContext : NSObject
+
+/// Returns the canonical instance for the identity of `model`.
+///
+/// If there is no live canonical instance yet, `model` becomes it. If `model`
+/// differs from the canonical instance, the changes are merged with
+/// -mergeValuesForKeysFromModel: into a copy of the canonical instance, which
+/// becomes the new canonical instance. Earlier holders of the previous
+/// instance keep seeing its values.
+///
+/// model - The model to unique. This argument must not be nil.
+///
+/// Returns the canonical instance, or `model` if it has no complete identity.
+- (id)uniqueModel:(MTLModel *)model;
+
+/// Returns the live canonical instance of a class for an identity, if any.
+///
+/// modelClass - The class of the model. This argument must not be nil.
+/// identity   - The value of the only identity property, or an array of the
+///              values of all identity properties in the order of
+///              +identityPropertyKeys. This argument must not be nil.
+- (id)existingModelOfClass:(Class)modelClass identity:(id)identity;
+
+/// Forgets all canonical instances.
+- (void)removeAllModels;
+
+@end
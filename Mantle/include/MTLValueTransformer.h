@@ -9,8 +9,10 @@
 #import <Foundation/Foundation.h>
 
 #if __has_include(<Mantle/MTLTransformerErrorHandling.h>)
+#import <Mantle/MTLTransformerBatchHandling.h>
 #import <Mantle/MTLTransformerErrorHandling.h>
 #else
+#import "MTLTransformerBatchHandling.h"
 #import "MTLTransformerErrorHandling.h"
 #endif
 
@@ -30,7 +32,12 @@ typedef id (^MTLValueTransformerBlock)(id value, BOOL *success, NSError **error)
 ///
 /// A value transformer supporting block-based transformation.
 ///
-@interface MTLValueTransformer : NSValueTransformer <MTLTransformerErrorHandling>
+/// Batches of values are transformed by invoking the block once per value,
+/// without any further message sends, unless a subclass overrides
+/// -transformedValue:success:error: or -reverseTransformedValue:success:error:,
+/// in which case that method is invoked for each value instead.
+///
+@interface MTLValueTransformer : NSValueTransformer <MTLTransformerErrorHandling, MTLTransformerBatchHandling>
 
 /// Returns a transformer which transforms values using the given block. Reverse
 /// transformations will not be allowed.
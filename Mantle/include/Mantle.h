@@ -15,11 +15,28 @@ FOUNDATION_EXPORT double MantleVersionNumber;
 FOUNDATION_EXPORT const unsigned char MantleVersionString[];
 
 #if __has_include(<Mantle/Mantle.h>)
+#import <Mantle/MTLColumnarBatch.h>
 #import <Mantle/MTLJSONAdapter.h>
+#import <Mantle/MTLJSONAdapter+Asynchronous.h>
+#import <Mantle/MTLJSONAdapter+JSONPatch.h>
+#import <Mantle/MTLMemoizingValueTransformer.h>
+#import <Mantle/MTLMessagePackAdapter.h>
+#import <Mantle/MTLMessagePackSerialization.h>
+#import <Mantle/MTLMetrics.h>
 #import <Mantle/MTLModel.h>
+#import <Mantle/MTLModel+Diffing.h>
+#import <Mantle/MTLModel+Updating.h>
 #import <Mantle/MTLModel+NSCoding.h>
+#import <Mantle/MTLPayloadCache.h>
+#import <Mantle/MTLReconciliation.h>
+#import <Mantle/MTLSQLiteAdapter.h>
+#import <Mantle/MTLSparseModel.h>
+#import <Mantle/MTLStringInterningPool.h>
+#import <Mantle/MTLUniquingContext.h>
 #import <Mantle/MTLValueTransformer.h>
+#import <Mantle/MTLTransformerBatchHandling.h>
 #import <Mantle/MTLTransformerErrorHandling.h>
+#import <Mantle/MTLTrace.h>
 #import <Mantle/NSArray+MTLManipulationAdditions.h>
 #import <Mantle/NSDictionary+MTLManipulationAdditions.h>
 #import <Mantle/NSDictionary+MTLMappingAdditions.h>
@@ -27,11 +44,28 @@ FOUNDATION_EXPORT const unsigned char MantleVersionString[];
 #import <Mantle/NSValueTransformer+MTLInversionAdditions.h>
 #import <Mantle/NSValueTransformer+MTLPredefinedTransformerAdditions.h>
 #else
+#import "MTLColumnarBatch.h"
 #import "MTLJSONAdapter.h"
+#import "MTLJSONAdapter+Asynchronous.h"
+#import "MTLJSONAdapter+JSONPatch.h"
+#import "MTLMemoizingValueTransformer.h"
+#import "MTLMessagePackAdapter.h"
+#import "MTLMessagePackSerialization.h"
+#import "MTLMetrics.h"
 #import "MTLModel.h"
+#import "MTLModel+Diffing.h"
+#import "MTLModel+Updating.h"
 #import "MTLModel+NSCoding.h"
+#import "MTLPayloadCache.h"
+#import "MTLReconciliation.h"
+#import "MTLSQLiteAdapter.h"
+#import "MTLSparseModel.h"
+#import "MTLStringInterningPool.h"
+#import "MTLUniquingContext.h"
 #import "MTLValueTransformer.h"
+#import "MTLTransformerBatchHandling.h"
 #import "MTLTransformerErrorHandling.h"
+#import "MTLTrace.h"
 #import "NSArray+MTLManipulationAdditions.h"
 #import "NSDictionary+MTLManipulationAdditions.h"
 #import "NSDictionary+MTLMappingAdditions.h"
@@ -29,6 +29,34 @@ extern NSString * const MTLUUIDValueTransformerName;
 /// proper boolean.
 extern NSString * const MTLBooleanValueTransformerName;
 
+/// The name for a value transformer that converts base64 strings with the
+/// standard alphabet and padding into NSData objects and back.
+extern NSString * const MTLBase64ValueTransformerName;
+
+/// The name for a value transformer that converts base64 strings with the URL
+/// and filename safe alphabet into NSData objects and back. Padding is optional
+/// when decoding and omitted when encoding.
+extern NSString * const MTLBase64URLValueTransformerName;
+
+/// The name for a value transformer that converts strings of hexadecimal digit
+/// pairs into NSData objects and back. Both cases are accepted when decoding,
+/// and lowercase digits are used when encoding.
+extern NSString * const MTLHexValueTransformerName;
+
+/// Describes the type of the elements in a packed number buffer. Elements are
+/// stored in the native byte order of the host.
+///
+/// MTLPackedNumberTypeDouble - Each element is a `double`.
+/// MTLPackedNumberTypeFloat  - Each element is a `float`.
+/// MTLPackedNumberTypeInt32  - Each element is an `int32_t`.
+/// MTLPackedNumberTypeInt64  - Each element is an `int64_t`.
+typedef enum : NSUInteger {
+    MTLPackedNumberTypeDouble,
+    MTLPackedNumberTypeFloat,
+    MTLPackedNumberTypeInt32,
+    MTLPackedNumberTypeInt64,
+} MTLPackedNumberType;
+
 @interface NSValueTransformer (MTLPredefinedTransformerAdditions)
 
 /// An optionally reversible transformer which applies the given transformer to
@@ -42,6 +70,29 @@ extern NSString * const MTLBooleanValueTransformerName;
 /// array.
 + (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_arrayMappingTransformerWithTransformer:(NSValueTransformer *)transformer;
 
+/// A reversible value transformer to transform between an array of numbers and
+/// a contiguous buffer of C numbers.
+///
+/// Large numeric arrays, like coordinates or samples, take a fraction of the
+/// memory of boxed NSNumbers this way, and the buffer can be handed to C APIs
+/// directly.
+///
+///   NSData *samples = model.samples;
+///   const double *values = samples.bytes;
+///   NSUInteger count = samples.length / sizeof(double);
+///
+/// type - The type of the buffer's elements. Integer types only accept numbers
+///        which they can hold exactly, so fractional and out-of-range numbers
+///        are rejected instead of being truncated. Floats only reject finite
+///        numbers beyond their range, and round everything else.
+///
+/// Returns a transformer which will map from arrays of NSNumbers to NSData
+/// objects for forward transformations, and from NSData objects to arrays of
+/// NSNumbers for reverse transformations. Arrays containing anything but
+/// NSNumbers the element type can hold, and data whose length is not a
+/// multiple of the element size, are rejected with an error.
++ (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_packedNumberArrayTransformerWithType:(MTLPackedNumberType)type;
+
 /// A reversible value transformer to transform between the keys and objects of a
 /// dictionary.
 ///
@@ -0,0 +1,52 @@
+//
+//  MTLAllocationCounter.h
+//  MantleBenchmarks
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// A snapshot of the allocations made by the process since the counter was
+// installed.
+typedef struct {
+	// The number of blocks allocated, including reallocations.
+	uint64_t count;
+
+	// The number of bytes requested by those allocations.
+	uint64_t bytes;
+} MTLAllocationCounts;
+
+// Starts counting every heap allocation made by the process, on any thread.
+//
+// This installs libmalloc's malloc_logger hook for the rest of the process,
+// chaining to any logger which was installed before, so it is only available
+// on Darwin. Calling it more than once has no further effect.
+//
+// Returns whether allocations are being counted.
+BOOL MTLAllocationCounterInstall(void);
+
+// Returns the allocations counted so far, or zeroes if the counter has not been
+// installed.
+MTLAllocationCounts MTLAllocationCounterCurrentCounts(void);
+
+// Returns whether MTLAllocationCounterBytesInUse() can measure the heap on this
+// platform, which is the case on Darwin and with glibc.
+BOOL MTLAllocationCounterBytesInUseIsAvailable(void);
+
+// Returns the number of bytes currently allocated by the process, including
+// malloc's own rounding, or 0 if MTLAllocationCounterBytesInUseIsAvailable()
+// returns NO.
+//
+// This does not require the counter to be installed.
+uint64_t MTLAllocationCounterBytesInUse(void);
+
+// Returns the highest resident memory size the process has reached so far, in
+// bytes, or 0 if it could not be determined.
+//
+// This uses task_info() on Darwin and getrusage() elsewhere.
+//
+// This is a high-water mark for the whole process, so it only reflects work
+// which needs more memory than anything the process did before.
+uint64_t MTLAllocationCounterPeakResidentBytes(void);
@@ -0,0 +1,129 @@
+//
+//  MTLAllocationCounter.m
+//  MantleBenchmarks
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLAllocationCounter.h"
+
+#import <stdatomic.h>
+#import <sys/resource.h>
+
+#if __APPLE__
+#import <mach/mach.h>
+#import <malloc/malloc.h>
+#elif defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#define MTL_HAS_MALLINFO2 1
+#import <malloc.h>
+#endif
+
+static _Atomic uint64_t MTLAllocationCount;
+static _Atomic uint64_t MTLAllocatedBytes;
+
+#if __APPLE__
+
+// The hook libmalloc calls for every allocation and deallocation, which is
+// what MallocStackLogging uses. It is exported, but not declared in any public
+// header.
+typedef void (MTLMallocLogger)(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t numberOfHotFramesToSkip);
+extern MTLMallocLogger *malloc_logger;
+
+// Flags passed to the malloc logger as `type`.
+static const uint32_t MTLMallocLogTypeAllocate = 2;
+static const uint32_t MTLMallocLogTypeDeallocate = 4;
+
+// The logger which was installed before counting started.
+static MTLMallocLogger *MTLPreviousMallocLogger;
+
+static void MTLCountingMallocLogger(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t numberOfHotFramesToSkip) {
+	// This runs inside the allocator, so it must not allocate or take locks.
+	if ((type & MTLMallocLogTypeAllocate) != 0) {
+		// Reallocations pass the new size as `arg3`, allocations as `arg2`.
+		uintptr_t size = ((type & MTLMallocLogTypeDeallocate) != 0 ? arg3 : arg2);
+
+		atomic_fetch_add_explicit(&MTLAllocationCount, 1, memory_order_relaxed);
+		atomic_fetch_add_explicit(&MTLAllocatedBytes, size, memory_order_relaxed);
+	}
+
+	if (MTLPreviousMallocLogger != NULL) {
+		MTLPreviousMallocLogger(type, arg1, arg2, arg3, result, numberOfHotFramesToSkip + 1);
+	}
+}
+
+BOOL MTLAllocationCounterInstall(void) {
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		MTLPreviousMallocLogger = malloc_logger;
+		malloc_logger = MTLCountingMallocLogger;
+	});
+
+	return YES;
+}
+
+BOOL MTLAllocationCounterBytesInUseIsAvailable(void) {
+	return YES;
+}
+
+uint64_t MTLAllocationCounterBytesInUse(void) {
+	malloc_statistics_t statistics;
+	malloc_zone_statistics(NULL, &statistics);
+
+	return statistics.size_in_use;
+}
+
+uint64_t MTLAllocationCounterPeakResidentBytes(void) {
+	mach_task_basic_info_data_t info;
+	mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+	if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) != KERN_SUCCESS) return 0;
+
+	return info.resident_size_max;
+}
+
+#else
+
+BOOL MTLAllocationCounterInstall(void) {
+	return NO;
+}
+
+#if MTL_HAS_MALLINFO2
+
+BOOL MTLAllocationCounterBytesInUseIsAvailable(void) {
+	return YES;
+}
+
+uint64_t MTLAllocationCounterBytesInUse(void) {
+	// Blocks served from the main heap and from mmap() alike.
+	struct mallinfo2 info = mallinfo2();
+	return info.uordblks + info.hblkhd;
+}
+
+#else
+
+BOOL MTLAllocationCounterBytesInUseIsAvailable(void) {
+	return NO;
+}
+
+uint64_t MTLAllocationCounterBytesInUse(void) {
+	return 0;
+}
+
+#endif
+
+uint64_t MTLAllocationCounterPeakResidentBytes(void) {
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+
+	// Linux and the BSDs report kilobytes, unlike Darwin.
+	return (uint64_t)usage.ru_maxrss * 1024;
+}
+
+#endif
+
+MTLAllocationCounts MTLAllocationCounterCurrentCounts(void) {
+	return (MTLAllocationCounts){
+		.count = atomic_load_explicit(&MTLAllocationCount, memory_order_relaxed),
+		.bytes = atomic_load_explicit(&MTLAllocatedBytes, memory_order_relaxed),
+	};
+}
@@ -0,0 +1,25 @@
+//
+//  MTLBenchmarkCorpus.h
+//  MantleBenchmarks
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// Returns `count` JSON dictionaries for MTLBenchmarkFlatModel.
+//
+// The corpus only depends on `count` and `seed`, so that runs on different
+// machines measure the same input.
+NSArray *MTLBenchmarkFlatJSONArray(NSUInteger count, uint64_t seed);
+
+// Returns `count` JSON dictionaries shaped like GitHub API issues, for
+// MTLBenchmarkIssue.
+//
+// The corpus only depends on `count` and `seed`, with a small pool of users
+// and labels shared between issues, like a real repository's issue list.
+NSArray *MTLBenchmarkIssueJSONArray(NSUInteger count, uint64_t seed);
+
+// Returns `count` UUID strings, which only depend on `count` and `seed`.
+NSArray *MTLBenchmarkUUIDStrings(NSUInteger count, uint64_t seed);
@@ -0,0 +1,148 @@
+//
+//  MTLBenchmarkCorpus.m
+//  MantleBenchmarks
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLBenchmarkCorpus.h"
+
+// A 64-bit linear congruential generator, so the corpus does not depend on the
+// platform's random() implementation.
+static uint64_t MTLBenchmarkNextRandom(uint64_t *state) {
+	*state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+	return *state >> 33;
+}
+
+static NSString *MTLBenchmarkRandomWords(uint64_t *state, NSUInteger minimumCount, NSUInteger maximumCount) {
+	static NSArray *words;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		words = @[
+			@"model", @"adapter", @"crash", @"when", @"decoding", @"nested", @"array",
+			@"property", @"transformer", @"missing", @"value", @"should", @"support",
+			@"optional", @"keys", @"fix", @"regression", @"in", @"the", @"date", @"URL",
+			@"performance", @"of", @"large", @"payloads", @"thread", @"safety", @"🚀",
+		];
+	});
+
+	NSUInteger count = minimumCount + (NSUInteger)(MTLBenchmarkNextRandom(state) % (maximumCount - minimumCount + 1));
+	NSMutableArray *result = [NSMutableArray arrayWithCapacity:count];
+	for (NSUInteger index = 0; index < count; index++) {
+		[result addObject:words[(NSUInteger)(MTLBenchmarkNextRandom(state) % words.count)]];
+	}
+
+	return [result componentsJoinedByString:@" "];
+}
+
+static NSString *MTLBenchmarkTimestamp(uint64_t *state) {
+	// Somewhere in 2015-2024.
+	uint64_t seconds = 1420070400 + MTLBenchmarkNextRandom(state) % (10 * 365 * 86400);
+
+	time_t time = (time_t)seconds;
+	struct tm components;
+	gmtime_r(&time, &components);
+
+	char buffer[32];
+	strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &components);
+
+	return @(buffer);
+}
+
+NSArray *MTLBenchmarkFlatJSONArray(NSUInteger count, uint64_t seed) {
+	uint64_t state = seed;
+	NSArray *categories = @[ @"alpha", @"beta", @"gamma", @"delta" ];
+
+	NSMutableArray *result = [NSMutableArray arrayWithCapacity:count];
+	for (NSUInteger index = 0; index < count; index++) {
+		[result addObject:@{
+			@"id": @(index + 1),
+			@"name": MTLBenchmarkRandomWords(&state, 1, 3),
+			@"summary": MTLBenchmarkRandomWords(&state, 4, 16),
+			@"score": @(MTLBenchmarkNextRandom(&state) % 1000),
+			@"ratio": @((double)(MTLBenchmarkNextRandom(&state) % 10000) / 10000),
+			@"enabled": @(MTLBenchmarkNextRandom(&state) % 2 == 0),
+			@"category": categories[(NSUInteger)(MTLBenchmarkNextRandom(&state) % categories.count)],
+			@"token": [NSString stringWithFormat:@"%016llx", (unsigned long long)MTLBenchmarkNextRandom(&state)],
+		}];
+	}
+
+	return result;
+}
+
+NSArray *MTLBenchmarkIssueJSONArray(NSUInteger count, uint64_t seed) {
+	uint64_t state = seed;
+
+	NSMutableArray *users = [NSMutableArray array];
+	for (NSUInteger index = 0; index < 20; index++) {
+		NSString *login = [NSString stringWithFormat:@"user%lu", (unsigned long)index];
+		[users addObject:@{
+			@"id": @(1000 + index),
+			@"login": login,
+			@"avatar_url": [NSString stringWithFormat:@"https://avatars.githubusercontent.com/u/%lu?v=4", (unsigned long)(1000 + index)],
+			@"html_url": [@"https://github.com/" stringByAppendingString:login],
+			@"type": (index % 7 == 0 ? @"Bot" : @"User"),
+			@"site_admin": @NO,
+		}];
+	}
+
+	NSArray *labelNames = @[ @"bug", @"enhancement", @"question", @"documentation", @"good first issue", @"wontfix" ];
+	NSMutableArray *labels = [NSMutableArray array];
+	[labelNames enumerateObjectsUsingBlock:^(NSString *name, NSUInteger index, BOOL *stop) {
+		[labels addObject:@{
+			@"id": @(500 + index),
+			@"name": name,
+			@"color": [NSString stringWithFormat:@"%06lx", (unsigned long)(index * 0x2a2a2a % 0xffffff)],
+			@"default": @(index < 3),
+		}];
+	}];
+
+	NSMutableArray *result = [NSMutableArray arrayWithCapacity:count];
+	for (NSUInteger index = 0; index < count; index++) {
+		NSUInteger number = count - index;
+
+		NSMutableArray *issueLabels = [NSMutableArray array];
+		uint64_t labelCount = MTLBenchmarkNextRandom(&state) % 3;
+		for (uint64_t labelIndex = 0; labelIndex < labelCount; labelIndex++) {
+			[issueLabels addObject:labels[(NSUInteger)(MTLBenchmarkNextRandom(&state) % labels.count)]];
+		}
+
+		[result addObject:@{
+			@"id": @(100000 + number),
+			@"number": @(number),
+			@"title": MTLBenchmarkRandomWords(&state, 3, 10),
+			@"body": MTLBenchmarkRandomWords(&state, 10, 120),
+			@"state": (MTLBenchmarkNextRandom(&state) % 3 == 0 ? @"closed" : @"open"),
+			@"locked": @NO,
+			@"comments": @(MTLBenchmarkNextRandom(&state) % 40),
+			@"html_url": [NSString stringWithFormat:@"https://github.com/Mantle/Mantle/issues/%lu", (unsigned long)number],
+			@"created_at": MTLBenchmarkTimestamp(&state),
+			@"updated_at": MTLBenchmarkTimestamp(&state),
+			@"user": users[(NSUInteger)(MTLBenchmarkNextRandom(&state) % users.count)],
+			@"labels": issueLabels,
+		}];
+	}
+
+	return result;
+}
+
+NSArray *MTLBenchmarkUUIDStrings(NSUInteger count, uint64_t seed) {
+	uint64_t state = seed;
+	NSMutableArray *result = [NSMutableArray arrayWithCapacity:count];
+
+	for (NSUInteger index = 0; index < count; index++) {
+		uuid_t bytes;
+		for (NSUInteger byteIndex = 0; byteIndex < sizeof(bytes); byteIndex++) {
+			bytes[byteIndex] = (unsigned char)MTLBenchmarkNextRandom(&state);
+		}
+
+		// Mark the bytes as a version 4 (random) UUID.
+		bytes[6] = (bytes[6] & 0x0f) | 0x40;
+		bytes[8] = (bytes[8] & 0x3f) | 0x80;
+
+		[result addObject:[[NSUUID alloc] initWithUUIDBytes:bytes].UUIDString];
+	}
+
+	return result;
+}
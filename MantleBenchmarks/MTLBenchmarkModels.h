@@ -0,0 +1,65 @@
+//
+//  MTLBenchmarkModels.h
+//  MantleBenchmarks
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+@import Mantle;
+
+// A model with a handful of scalar and string properties, all of which use
+// identity mappings and no transformers.
+@interface MTLBenchmarkFlatModel : MTLModel <MTLJSONSerializing>
+
+@property (nonatomic, assign) NSInteger identifier;
+@property (nonatomic, copy) NSString *name;
+@property (nonatomic, copy) NSString *summary;
+@property (nonatomic, copy) NSNumber *score;
+@property (nonatomic, assign) double ratio;
+@property (nonatomic, assign) BOOL enabled;
+@property (nonatomic, copy) NSString *category;
+@property (nonatomic, copy) NSString *token;
+
+@end
+
+// Shaped like the "user" objects returned by the GitHub API.
+@interface MTLBenchmarkUser : MTLModel <MTLJSONSerializing>
+
+@property (nonatomic, assign) NSInteger identifier;
+@property (nonatomic, copy) NSString *login;
+@property (nonatomic, copy) NSURL *avatarURL;
+@property (nonatomic, copy) NSURL *HTMLURL;
+@property (nonatomic, copy) NSString *type;
+@property (nonatomic, assign) BOOL siteAdmin;
+
+@end
+
+// Shaped like the "label" objects returned by the GitHub API.
+@interface MTLBenchmarkLabel : MTLModel <MTLJSONSerializing>
+
+@property (nonatomic, assign) NSInteger identifier;
+@property (nonatomic, copy) NSString *name;
+@property (nonatomic, copy) NSString *color;
+@property (nonatomic, assign) BOOL isDefault;
+
+@end
+
+// Shaped like the "issue" objects returned by the GitHub API, with nested
+// models, URLs, dates and enumerated states.
+@interface MTLBenchmarkIssue : MTLModel <MTLJSONSerializing>
+
+@property (nonatomic, assign) NSInteger identifier;
+@property (nonatomic, assign) NSUInteger number;
+@property (nonatomic, copy) NSString *title;
+@property (nonatomic, copy) NSString *body;
+@property (nonatomic, assign) BOOL open;
+@property (nonatomic, assign) BOOL locked;
+@property (nonatomic, assign) NSUInteger commentCount;
+@property (nonatomic, copy) NSURL *HTMLURL;
+@property (nonatomic, copy) NSDate *createdAt;
+@property (nonatomic, copy) NSDate *updatedAt;
+@property (nonatomic, strong) MTLBenchmarkUser *user;
+@property (nonatomic, copy) NSArray *labels;
+
+@end
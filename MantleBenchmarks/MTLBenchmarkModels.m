@@ -0,0 +1,151 @@
+//
+//  MTLBenchmarkModels.m
+//  MantleBenchmarks
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLBenchmarkModels.h"
+
+static NSValueTransformer *MTLBenchmarkDateTransformer(void) {
+	static NSValueTransformer *transformer;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		NSLocale *locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+		NSTimeZone *timeZone = [NSTimeZone timeZoneForSecondsFromGMT:0];
+		transformer = [NSValueTransformer mtl_dateTransformerWithDateFormat:@"yyyy-MM-dd'T'HH:mm:ss'Z'" calendar:nil locale:locale timeZone:timeZone defaultDate:nil];
+	});
+
+	return transformer;
+}
+
+@implementation MTLBenchmarkFlatModel
+
++ (BOOL)supportsSecureCoding {
+	return YES;
+}
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	NSMutableDictionary *mapping = [[NSDictionary mtl_identityPropertyMapWithModel:self] mutableCopy];
+	mapping[@"identifier"] = @"id";
+
+	return mapping;
+}
+
+@end
+
+@implementation MTLBenchmarkUser
+
++ (BOOL)supportsSecureCoding {
+	return YES;
+}
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return @{
+		@"identifier": @"id",
+		@"login": @"login",
+		@"avatarURL": @"avatar_url",
+		@"HTMLURL": @"html_url",
+		@"type": @"type",
+		@"siteAdmin": @"site_admin",
+	};
+}
+
++ (NSValueTransformer *)avatarURLJSONTransformer {
+	return [NSValueTransformer valueTransformerForName:MTLURLValueTransformerName];
+}
+
++ (NSValueTransformer *)HTMLURLJSONTransformer {
+	return [NSValueTransformer valueTransformerForName:MTLURLValueTransformerName];
+}
+
++ (NSValueTransformer *)siteAdminJSONTransformer {
+	return [NSValueTransformer valueTransformerForName:MTLBooleanValueTransformerName];
+}
+
+@end
+
+@implementation MTLBenchmarkLabel
+
++ (BOOL)supportsSecureCoding {
+	return YES;
+}
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return @{
+		@"identifier": @"id",
+		@"name": @"name",
+		@"color": @"color",
+		@"isDefault": @"default",
+	};
+}
+
++ (NSValueTransformer *)isDefaultJSONTransformer {
+	return [NSValueTransformer valueTransformerForName:MTLBooleanValueTransformerName];
+}
+
+@end
+
+@implementation MTLBenchmarkIssue
+
++ (BOOL)supportsSecureCoding {
+	return YES;
+}
+
++ (NSDictionary *)allowedSecureCodingClassesByPropertyKey {
+	NSMutableDictionary *allowedClasses = [[super allowedSecureCodingClassesByPropertyKey] mutableCopy];
+	allowedClasses[@"labels"] = @[ NSArray.class, MTLBenchmarkLabel.class ];
+
+	return allowedClasses;
+}
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return @{
+		@"identifier": @"id",
+		@"number": @"number",
+		@"title": @"title",
+		@"body": @"body",
+		@"open": @"state",
+		@"locked": @"locked",
+		@"commentCount": @"comments",
+		@"HTMLURL": @"html_url",
+		@"createdAt": @"created_at",
+		@"updatedAt": @"updated_at",
+		@"user": @"user",
+		@"labels": @"labels",
+	};
+}
+
++ (NSValueTransformer *)openJSONTransformer {
+	return [NSValueTransformer mtl_valueMappingTransformerWithDictionary:@{
+		@"open": @YES,
+		@"closed": @NO,
+	}];
+}
+
++ (NSValueTransformer *)lockedJSONTransformer {
+	return [NSValueTransformer valueTransformerForName:MTLBooleanValueTransformerName];
+}
+
++ (NSValueTransformer *)HTMLURLJSONTransformer {
+	return [NSValueTransformer valueTransformerForName:MTLURLValueTransformerName];
+}
+
++ (NSValueTransformer *)createdAtJSONTransformer {
+	return MTLBenchmarkDateTransformer();
+}
+
++ (NSValueTransformer *)updatedAtJSONTransformer {
+	return MTLBenchmarkDateTransformer();
+}
+
++ (NSValueTransformer *)userJSONTransformer {
+	return [MTLJSONAdapter dictionaryTransformerWithModelClass:MTLBenchmarkUser.class];
+}
+
++ (NSValueTransformer *)labelsJSONTransformer {
+	return [MTLJSONAdapter arrayTransformerWithModelClass:MTLBenchmarkLabel.class];
+}
+
+@end
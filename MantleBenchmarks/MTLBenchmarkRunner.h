@@ -0,0 +1,56 @@
+//
+//  MTLBenchmarkRunner.h
+//  MantleBenchmarks
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// Times benchmarks and collects their results.
+@interface MTLBenchmarkRunner : NSObject
+
+// Initializes a runner.
+//
+// iterations - The number of timed runs of each benchmark. This must be
+//              greater than 0.
+// filter     - If not nil, only benchmarks whose name contains this string
+//              are run.
+- (instancetype)initWithIterations:(NSUInteger)iterations filter:(NSString *)filter;
+
+// Whether allocations are counted for each benchmark.
+@property (nonatomic, assign, readonly) BOOL countsAllocations;
+
+// One dictionary per measured benchmark, in the order they were run.
+@property (nonatomic, copy, readonly) NSArray *results;
+
+// Runs `block` once to warm up, then `iterations` more times while timing it,
+// then once more while counting allocations, each inside its own autorelease
+// pool.
+//
+// name        - The name of the benchmark, like "issues.decode".
+// size        - The size of the corpus, which is reported alongside the name.
+// objectCount - The number of objects processed by each run of `block`, used
+//               to compute throughput and allocations per object.
+// block       - The work to measure.
+- (void)measure:(NSString *)name size:(NSUInteger)size objectCount:(NSUInteger)objectCount block:(void (^)(void))block;
+
+// Runs `block` once inside an autorelease pool, and measures how much memory
+// it needed at its peak.
+//
+// The heap is measured right before the pool drains, which is when the
+// autoreleased temporaries of a loop have piled up the most. The growth of the
+// process's peak resident size is measured as well, which is only meaningful
+// for the first and largest measurement in a process, so run these on their
+// own with -filter.
+//
+// name        - The name of the benchmark, like "issues.decode.peak".
+// size        - The size of the corpus, which is reported alongside the name.
+// objectCount - The number of objects processed by `block`, used to compute
+//               the memory needed per object.
+// block       - The work to measure. Its result is kept alive until the heap
+//               has been measured, so that the memory it retains is counted.
+- (void)measurePeakMemory:(NSString *)name size:(NSUInteger)size objectCount:(NSUInteger)objectCount block:(id (^)(void))block;
+
+@end
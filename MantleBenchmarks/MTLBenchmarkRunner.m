@@ -0,0 +1,189 @@
+//
+//  MTLBenchmarkRunner.m
+//  MantleBenchmarks
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLBenchmarkRunner.h"
+#import "MTLAllocationCounter.h"
+
+#if __APPLE__
+#import <mach/mach_time.h>
+#else
+#import <time.h>
+#endif
+
+// Reported in place of measurements which can't be made on this platform.
+static NSString * const MTLBenchmarkNotAvailable = @"n/a";
+
+static uint64_t MTLBenchmarkNanoseconds(void) {
+#if __APPLE__
+	static mach_timebase_info_data_t timebase;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		mach_timebase_info(&timebase);
+	});
+
+	return mach_absolute_time() * timebase.numer / timebase.denom;
+#else
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return (uint64_t)time.tv_sec * NSEC_PER_SEC + (uint64_t)time.tv_nsec;
+#endif
+}
+
+// Returns the nearest-rank percentile of sorted samples.
+static uint64_t MTLBenchmarkPercentile(const uint64_t *sortedSamples, NSUInteger count, double percentile) {
+	NSUInteger rank = (NSUInteger)ceil(percentile / 100 * count);
+	return sortedSamples[MAX(rank, (NSUInteger)1) - 1];
+}
+
+static int MTLBenchmarkCompareSamples(const void *left, const void *right) {
+	uint64_t leftSample = *(const uint64_t *)left;
+	uint64_t rightSample = *(const uint64_t *)right;
+
+	return (leftSample > rightSample) - (leftSample < rightSample);
+}
+
+@interface MTLBenchmarkRunner ()
+
+@property (nonatomic, assign, readonly) NSUInteger iterations;
+@property (nonatomic, copy, readonly) NSString *filter;
+@property (nonatomic, strong, readonly) NSMutableArray *mutableResults;
+
+@end
+
+@implementation MTLBenchmarkRunner
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithIterations:(NSUInteger)iterations filter:(NSString *)filter {
+	NSParameterAssert(iterations > 0);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_iterations = iterations;
+	_filter = [filter copy];
+	_mutableResults = [NSMutableArray array];
+	_countsAllocations = MTLAllocationCounterInstall();
+
+	return self;
+}
+
+#pragma mark Measurement
+
+- (NSArray *)results {
+	return [self.mutableResults copy];
+}
+
+- (void)measure:(NSString *)name size:(NSUInteger)size objectCount:(NSUInteger)objectCount block:(void (^)(void))block {
+	NSParameterAssert(name != nil);
+	NSParameterAssert(objectCount > 0);
+	NSParameterAssert(block != nil);
+
+	if (self.filter.length > 0 && [name rangeOfString:self.filter].location == NSNotFound) return;
+
+	@autoreleasepool {
+		block();
+	}
+
+	NSUInteger iterations = self.iterations;
+	uint64_t *samples = malloc(iterations * sizeof(*samples));
+	uint64_t totalNanoseconds = 0;
+
+	for (NSUInteger iteration = 0; iteration < iterations; iteration++) {
+		@autoreleasepool {
+			uint64_t start = MTLBenchmarkNanoseconds();
+			block();
+			samples[iteration] = MTLBenchmarkNanoseconds() - start;
+		}
+
+		totalNanoseconds += samples[iteration];
+	}
+
+	qsort(samples, iterations, sizeof(*samples), MTLBenchmarkCompareSamples);
+
+	NSMutableDictionary *result = [@{
+		@"name": name,
+		@"size": @(size),
+		@"iterations": @(iterations),
+		@"mean_ns": @(totalNanoseconds / iterations),
+		@"p50_ns": @(MTLBenchmarkPercentile(samples, iterations, 50)),
+		@"p99_ns": @(MTLBenchmarkPercentile(samples, iterations, 99)),
+		@"objects_per_second": @(totalNanoseconds > 0 ? (double)objectCount * iterations * NSEC_PER_SEC / totalNanoseconds : 0),
+	} mutableCopy];
+
+	free(samples);
+
+	// Allocations which can't be counted are reported as such, rather than as
+	// zero.
+	NSString *allocationsDescription = MTLBenchmarkNotAvailable;
+	if (self.countsAllocations) {
+		MTLAllocationCounts before = MTLAllocationCounterCurrentCounts();
+		@autoreleasepool {
+			block();
+		}
+		MTLAllocationCounts after = MTLAllocationCounterCurrentCounts();
+
+		double allocationsPerObject = (double)(after.count - before.count) / objectCount;
+		result[@"allocations_per_object"] = @(allocationsPerObject);
+		result[@"allocated_bytes_per_object"] = @((double)(after.bytes - before.bytes) / objectCount);
+
+		allocationsDescription = [NSString stringWithFormat:@"%.1f", allocationsPerObject];
+	} else {
+		result[@"allocations_per_object"] = MTLBenchmarkNotAvailable;
+		result[@"allocated_bytes_per_object"] = MTLBenchmarkNotAvailable;
+	}
+
+	[self.mutableResults addObject:result];
+
+	fprintf(stderr, "%-32s %8lu  p50 %12llu ns  p99 %12llu ns  allocs/object %8s\n", name.UTF8String, (unsigned long)size, [result[@"p50_ns"] unsignedLongLongValue], [result[@"p99_ns"] unsignedLongLongValue], allocationsDescription.UTF8String);
+}
+
+- (void)measurePeakMemory:(NSString *)name size:(NSUInteger)size objectCount:(NSUInteger)objectCount block:(id (^)(void))block {
+	NSParameterAssert(name != nil);
+	NSParameterAssert(objectCount > 0);
+	NSParameterAssert(block != nil);
+
+	if (self.filter.length > 0 && [name rangeOfString:self.filter].location == NSNotFound) return;
+
+	uint64_t residentBefore = MTLAllocationCounterPeakResidentBytes();
+	uint64_t heapBefore = MTLAllocationCounterBytesInUse();
+	uint64_t heapPeak = 0;
+
+	@autoreleasepool {
+		// Keep the result alive until the heap has been measured.
+		NS_VALID_UNTIL_END_OF_SCOPE id result = block();
+		heapPeak = MTLAllocationCounterBytesInUse();
+		(void)result;
+	}
+
+	uint64_t residentAfter = MTLAllocationCounterPeakResidentBytes();
+
+	uint64_t heapGrowth = (heapPeak > heapBefore ? heapPeak - heapBefore : 0);
+	uint64_t residentGrowth = (residentAfter > residentBefore ? residentAfter - residentBefore : 0);
+
+	// Measurements this platform can't make are reported as such, rather than
+	// as zero.
+	BOOL measuresHeap = MTLAllocationCounterBytesInUseIsAvailable();
+	BOOL measuresResident = (residentAfter > 0);
+
+	[self.mutableResults addObject:@{
+		@"name": name,
+		@"size": @(size),
+		@"peak_heap_bytes": (measuresHeap ? @(heapGrowth) : MTLBenchmarkNotAvailable),
+		@"peak_heap_bytes_per_object": (measuresHeap ? @((double)heapGrowth / objectCount) : MTLBenchmarkNotAvailable),
+		@"peak_resident_growth_bytes": (measuresResident ? @(residentGrowth) : MTLBenchmarkNotAvailable),
+	}];
+
+	NSString *heapDescription = (measuresHeap ? [NSString stringWithFormat:@"%llu B", heapGrowth] : MTLBenchmarkNotAvailable);
+	NSString *residentDescription = (measuresResident ? [NSString stringWithFormat:@"%llu B", residentGrowth] : MTLBenchmarkNotAvailable);
+
+	fprintf(stderr, "%-32s %8lu  peak heap %14s  peak RSS growth %14s\n", name.UTF8String, (unsigned long)size, heapDescription.UTF8String, residentDescription.UTF8String);
+}
+
+@end
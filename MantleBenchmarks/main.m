@@ -0,0 +1,229 @@
+//
+//  main.m
+//  MantleBenchmarks
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+//  Measures Mantle's hot paths over deterministic corpora and prints the
+//  results as JSON. Accepts these arguments, in NSUserDefaults style:
+//
+//    -iterations 20           The number of timed runs of each benchmark.
+//    -sizes 10,100,1000       The corpus sizes to measure.
+//    -filter issues.decode    Only runs benchmarks whose name contains this.
+//    -peakSize 200000         Also measures the peak memory of decoding and
+//                             encoding a corpus of this size, before anything
+//                             else. Best combined with -filter peak.
+//    -output results.json     Writes the results to a file instead of stdout.
+//
+
+@import Mantle;
+
+#import "MTLBenchmarkCorpus.h"
+#import "MTLBenchmarkModels.h"
+#import "MTLBenchmarkRunner.h"
+
+// The seed of every corpus, so that results are comparable between runs.
+static const uint64_t MTLBenchmarkSeed = 0x4d616e746c65;
+
+static void MTLBenchmarkModelClass(MTLBenchmarkRunner *runner, NSString *prefix, Class modelClass, NSArray *JSONArray) {
+	NSUInteger size = JSONArray.count;
+
+	NSError *error = nil;
+	NSArray *models = [MTLJSONAdapter modelsOfClass:modelClass fromJSONArray:JSONArray error:&error];
+	if (models == nil) {
+		fprintf(stderr, "Could not decode %s corpus: %s\n", prefix.UTF8String, error.description.UTF8String);
+		exit(EXIT_FAILURE);
+	}
+
+	NSArray *copies = [[NSArray alloc] initWithArray:models copyItems:YES];
+	NSArray *dictionaryValues = [models valueForKey:@"dictionaryValue"];
+
+	[runner measure:[prefix stringByAppendingString:@".decode"] size:size objectCount:size block:^{
+		[MTLJSONAdapter modelsOfClass:modelClass fromJSONArray:JSONArray error:NULL];
+	}];
+
+	[runner measure:[prefix stringByAppendingString:@".encode"] size:size objectCount:size block:^{
+		[MTLJSONAdapter JSONArrayFromModels:models error:NULL];
+	}];
+
+	[runner measure:[prefix stringByAppendingString:@".initWithDictionary"] size:size objectCount:size block:^{
+		for (NSDictionary *dictionaryValue in dictionaryValues) {
+			[[modelClass alloc] initWithDictionary:dictionaryValue error:NULL];
+		}
+	}];
+
+	[runner measure:[prefix stringByAppendingString:@".isEqual"] size:size objectCount:size block:^{
+		[models enumerateObjectsUsingBlock:^(MTLModel *model, NSUInteger index, BOOL *stop) {
+			[model isEqual:copies[index]];
+		}];
+	}];
+
+	[runner measure:[prefix stringByAppendingString:@".hash"] size:size objectCount:size block:^{
+		for (MTLModel *model in models) {
+			[model hash];
+		}
+	}];
+
+	[runner measure:[prefix stringByAppendingString:@".copy"] size:size objectCount:size block:^{
+		for (MTLModel *model in models) {
+			[model copy];
+		}
+	}];
+
+	// Secure keyed archiving with errors needs macOS 10.13.
+	if (@available(macOS 10.13, *)) {
+		NSSet *archivedClasses = [NSSet setWithObjects:NSArray.class, modelClass, nil];
+		NSData *archive = [NSKeyedArchiver archivedDataWithRootObject:models requiringSecureCoding:YES error:&error];
+		if (archive == nil || [NSKeyedUnarchiver unarchivedObjectOfClasses:archivedClasses fromData:archive error:&error] == nil) {
+			fprintf(stderr, "Could not archive %s corpus: %s\n", prefix.UTF8String, error.description.UTF8String);
+			exit(EXIT_FAILURE);
+		}
+
+		[runner measure:[prefix stringByAppendingString:@".coding"] size:size objectCount:size block:^{
+			NSData *data = [NSKeyedArchiver archivedDataWithRootObject:models requiringSecureCoding:YES error:NULL];
+			[NSKeyedUnarchiver unarchivedObjectOfClasses:archivedClasses fromData:data error:NULL];
+		}];
+	}
+}
+
+static void MTLBenchmarkPeakMemory(MTLBenchmarkRunner *runner, NSString *prefix, Class modelClass, NSArray *JSONArray) {
+	NSUInteger size = JSONArray.count;
+
+	[runner measurePeakMemory:[prefix stringByAppendingString:@".decode.peak"] size:size objectCount:size block:^ id {
+		return [MTLJSONAdapter modelsOfClass:modelClass fromJSONArray:JSONArray error:NULL];
+	}];
+
+	NSArray *models = [MTLJSONAdapter modelsOfClass:modelClass fromJSONArray:JSONArray error:NULL];
+
+	[runner measurePeakMemory:[prefix stringByAppendingString:@".encode.peak"] size:size objectCount:size block:^ id {
+		return [MTLJSONAdapter JSONArrayFromModels:models error:NULL];
+	}];
+}
+
+static void MTLBenchmarkTransformer(MTLBenchmarkRunner *runner, NSString *name, NSValueTransformer *transformer, NSArray *values) {
+	NSUInteger size = values.count;
+
+	[runner measure:[NSString stringWithFormat:@"transformer.%@.forward", name] size:size objectCount:size block:^{
+		for (id value in values) {
+			[transformer transformedValue:value];
+		}
+	}];
+
+	if (![transformer.class allowsReverseTransformation]) return;
+
+	NSMutableArray *transformedValues = [NSMutableArray arrayWithCapacity:size];
+	for (id value in values) {
+		[transformedValues addObject:[transformer transformedValue:value] ?: NSNull.null];
+	}
+
+	[runner measure:[NSString stringWithFormat:@"transformer.%@.reverse", name] size:size objectCount:size block:^{
+		for (id value in transformedValues) {
+			[transformer reverseTransformedValue:value];
+		}
+	}];
+}
+
+static void MTLBenchmarkTransformers(MTLBenchmarkRunner *runner, NSArray *issueJSONArray) {
+	NSArray *URLStrings = [issueJSONArray valueForKey:@"html_url"];
+	NSArray *dateStrings = [issueJSONArray valueForKey:@"created_at"];
+	NSArray *booleans = [issueJSONArray valueForKey:@"locked"];
+	NSArray *states = [issueJSONArray valueForKey:@"state"];
+
+	NSArray *UUIDStrings = MTLBenchmarkUUIDStrings(issueJSONArray.count, MTLBenchmarkSeed);
+
+	NSMutableArray *base64Strings = [NSMutableArray arrayWithCapacity:issueJSONArray.count];
+	for (NSDictionary *issue in issueJSONArray) {
+		[base64Strings addObject:[[issue[@"body"] dataUsingEncoding:NSUTF8StringEncoding] base64EncodedStringWithOptions:0]];
+	}
+
+	NSLocale *locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+
+	MTLBenchmarkTransformer(runner, @"URL", [NSValueTransformer valueTransformerForName:MTLURLValueTransformerName], URLStrings);
+	MTLBenchmarkTransformer(runner, @"UUID", [NSValueTransformer valueTransformerForName:MTLUUIDValueTransformerName], UUIDStrings);
+	MTLBenchmarkTransformer(runner, @"boolean", [NSValueTransformer valueTransformerForName:MTLBooleanValueTransformerName], booleans);
+	MTLBenchmarkTransformer(runner, @"base64", [NSValueTransformer valueTransformerForName:MTLBase64ValueTransformerName], base64Strings);
+	MTLBenchmarkTransformer(runner, @"date", [NSValueTransformer mtl_dateTransformerWithDateFormat:@"yyyy-MM-dd'T'HH:mm:ss'Z'" locale:locale], dateStrings);
+	MTLBenchmarkTransformer(runner, @"valueMapping", [NSValueTransformer mtl_valueMappingTransformerWithDictionary:@{ @"open": @YES, @"closed": @NO }], states);
+}
+
+int main(int argc, const char *argv[]) {
+	@autoreleasepool {
+		NSUserDefaults *defaults = NSUserDefaults.standardUserDefaults;
+		[defaults registerDefaults:@{
+			@"iterations": @20,
+			@"sizes": @"10,100,1000",
+		}];
+
+		NSInteger iterations = [defaults integerForKey:@"iterations"];
+		if (iterations <= 0) {
+			fprintf(stderr, "-iterations must be greater than 0\n");
+			return EXIT_FAILURE;
+		}
+
+		NSMutableArray *sizes = [NSMutableArray array];
+		for (NSString *component in [[defaults stringForKey:@"sizes"] componentsSeparatedByString:@","]) {
+			NSInteger size = component.integerValue;
+			if (size <= 0) {
+				fprintf(stderr, "Invalid size \"%s\"\n", component.UTF8String);
+				return EXIT_FAILURE;
+			}
+
+			[sizes addObject:@(size)];
+		}
+
+		MTLBenchmarkRunner *runner = [[MTLBenchmarkRunner alloc] initWithIterations:(NSUInteger)iterations filter:[defaults stringForKey:@"filter"]];
+
+		// Measured first, since the peak resident size of the process only
+		// ever grows.
+		NSInteger peakSize = [defaults integerForKey:@"peakSize"];
+		if (peakSize < 0) {
+			fprintf(stderr, "-peakSize must not be negative\n");
+			return EXIT_FAILURE;
+		}
+
+		if (peakSize > 0) {
+			@autoreleasepool {
+				MTLBenchmarkPeakMemory(runner, @"issues", MTLBenchmarkIssue.class, MTLBenchmarkIssueJSONArray((NSUInteger)peakSize, MTLBenchmarkSeed));
+			}
+		}
+
+		for (NSNumber *size in sizes) {
+			@autoreleasepool {
+				NSArray *flatJSONArray = MTLBenchmarkFlatJSONArray(size.unsignedIntegerValue, MTLBenchmarkSeed);
+				NSArray *issueJSONArray = MTLBenchmarkIssueJSONArray(size.unsignedIntegerValue, MTLBenchmarkSeed);
+
+				MTLBenchmarkModelClass(runner, @"flat", MTLBenchmarkFlatModel.class, flatJSONArray);
+				MTLBenchmarkModelClass(runner, @"issues", MTLBenchmarkIssue.class, issueJSONArray);
+				MTLBenchmarkTransformers(runner, issueJSONArray);
+			}
+		}
+
+		NSDictionary *report = @{
+			@"iterations": @(iterations),
+			@"allocations_counted": @(runner.countsAllocations),
+			@"os": NSProcessInfo.processInfo.operatingSystemVersionString,
+			@"results": runner.results,
+		};
+
+		NSError *error = nil;
+		NSData *data = [NSJSONSerialization dataWithJSONObject:report options:NSJSONWritingPrettyPrinted error:&error];
+		if (data == nil) {
+			fprintf(stderr, "Could not serialize results: %s\n", error.description.UTF8String);
+			return EXIT_FAILURE;
+		}
+
+		NSString *outputPath = [defaults stringForKey:@"output"];
+		if (outputPath != nil) {
+			if (![data writeToFile:outputPath options:NSDataWritingAtomic error:&error]) {
+				fprintf(stderr, "Could not write results: %s\n", error.description.UTF8String);
+				return EXIT_FAILURE;
+			}
+		} else {
+			fwrite(data.bytes, 1, data.length, stdout);
+			fputc('\n', stdout);
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,226 @@
+//
+//  MTLAllocationBudgetSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestAllocationCounter.h"
+#import "MTLTestModel.h"
+
+// The number of models each operation is measured over, which averages out
+// allocations made concurrently by other threads.
+static const NSUInteger MTLAllocationBudgetModelCount = 500;
+
+// Returns the number of allocations `block` makes per model, after running it
+// once to warm up any caches.
+static double MTLAllocationsPerModel(void (^block)(void)) {
+	@autoreleasepool {
+		block();
+	}
+
+	MTLTestAllocationCounts counts = MTLTestCountAllocations(^{
+		@autoreleasepool {
+			block();
+		}
+	});
+
+	return (double)counts.count / MTLAllocationBudgetModelCount;
+}
+
+// Returns the number of bytes kept alive per model by the array `block`
+// returns, after running it once to warm up any caches.
+static double MTLRetainedBytesPerModel(NSArray * (^block)(void)) {
+	@autoreleasepool {
+		block();
+	}
+
+	NSArray *retained = nil;
+	uint64_t before = MTLTestAllocatedBytesInUse();
+	@autoreleasepool {
+		retained = block();
+	}
+	uint64_t after = MTLTestAllocatedBytesInUse();
+
+	expect(@(retained.count)).to(equal(@(MTLAllocationBudgetModelCount)));
+
+	return (after > before ? (double)(after - before) / MTLAllocationBudgetModelCount : 0);
+}
+
+// Returns the number of bytes of autoreleased temporaries that `block` leaves
+// behind for the caller's autorelease pool to drain, after running it once to
+// warm up any caches.
+static uint64_t MTLPendingAutoreleasedBytes(id (^block)(void)) {
+	@autoreleasepool {
+		block();
+	}
+
+	NS_VALID_UNTIL_END_OF_SCOPE id retained = nil;
+	uint64_t inside = 0;
+	@autoreleasepool {
+		retained = block();
+		inside = MTLTestAllocatedBytesInUse();
+	}
+	uint64_t after = MTLTestAllocatedBytesInUse();
+	(void)retained;
+
+	return (inside > after ? inside - after : 0);
+}
+
+QuickSpecBegin(MTLAllocationBudgetSpec)
+
+// Set MTL_RECORD_ALLOCATION_BASELINES in the environment to log measurements
+// instead of checking them, for updating MTLAllocationBudgets.plist.
+BOOL recordsBaselines = (NSProcessInfo.processInfo.environment[@"MTL_RECORD_ALLOCATION_BASELINES"] != nil);
+
+NSURL *budgetsURL = [[NSBundle bundleForClass:self.class] URLForResource:@"MTLAllocationBudgets" withExtension:@"plist"];
+NSDictionary *budgets = [NSDictionary dictionaryWithContentsOfURL:budgetsURL];
+NSDictionary *baselines = budgets[@"baselines"];
+double margin = [budgets[@"margin"] doubleValue];
+
+__block NSArray *JSONArray;
+__block NSArray *models;
+
+beforeEach(^{
+	expect(budgets).notTo(beNil());
+
+	NSMutableArray *mutableJSONArray = [NSMutableArray arrayWithCapacity:MTLAllocationBudgetModelCount];
+	for (NSUInteger index = 0; index < MTLAllocationBudgetModelCount; index++) {
+		[mutableJSONArray addObject:@{
+			@"username": [NSString stringWithFormat:@"user%lu", (unsigned long)index],
+			@"count": @"5",
+			@"nested": @{ @"name": [NSString stringWithFormat:@"nested %lu", (unsigned long)index] },
+		}];
+	}
+
+	JSONArray = mutableJSONArray;
+
+	NSError *error = nil;
+	models = [MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:JSONArray error:&error];
+	expect(models).notTo(beNil());
+	expect(error).to(beNil());
+});
+
+// Defines an example which checks `measurementKey` of `operation` against its
+// baseline, plus the margin. It is pending if the measurement isn't available
+// on this platform, or if no baseline has been recorded for it yet.
+void (^itStaysWithinBaseline)(NSString *, NSString *, BOOL, double (^)(void)) = ^(NSString *operation, NSString *measurementKey, BOOL available, double (^measure)(void)) {
+	NSString *name = [NSString stringWithFormat:@"should keep %@ of %@ within its baseline", measurementKey, operation];
+	NSNumber *baseline = baselines[operation][measurementKey];
+
+	if (!available) {
+		pending([name stringByAppendingString:@", which can't be measured on this platform"], ^{});
+		return;
+	}
+
+	if (baseline == nil && !recordsBaselines) {
+		pending([name stringByAppendingString:@", which has not been recorded yet"], ^{});
+		return;
+	}
+
+	it(name, ^{
+		double measurement = measure();
+
+		if (recordsBaselines) {
+			NSLog(@"%@.%@ = %.1f", operation, measurementKey, measurement);
+			return;
+		}
+
+		double budget = baseline.doubleValue * (1 + margin);
+		NSString *description = [NSString stringWithFormat:@"%@ measured %.1f for %@, over its baseline of %@", operation, measurement, measurementKey, baseline];
+		expect(@(measurement)).toWithDescription(beLessThanOrEqualTo(@(budget)), description);
+	});
+};
+
+// Defines examples which check the allocations made, and the bytes kept alive,
+// by the array of `MTLAllocationBudgetModelCount` results `block` returns.
+void (^itStaysWithinBudget)(NSString *, NSArray * (^)(void)) = ^(NSString *operation, NSArray * (^block)(void)) {
+	itStaysWithinBaseline(operation, @"allocationsPerModel", MTLTestAllocationCounterIsAvailable(), ^{
+		return MTLAllocationsPerModel(^{ block(); });
+	});
+
+	itStaysWithinBaseline(operation, @"retainedBytesPerModel", MTLTestAllocatedBytesInUseIsAvailable(), ^{
+		return MTLRetainedBytesPerModel(block);
+	});
+};
+
+describe(@"decoding JSON", ^{
+	itStaysWithinBudget(@"decode", ^{
+		return [MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:JSONArray error:NULL];
+	});
+});
+
+describe(@"encoding JSON", ^{
+	itStaysWithinBudget(@"encode", ^{
+		return [MTLJSONAdapter JSONArrayFromModels:models error:NULL];
+	});
+});
+
+describe(@"building dictionary values", ^{
+	itStaysWithinBudget(@"dictionaryValue", ^{
+		NSMutableArray *dictionaryValues = [NSMutableArray arrayWithCapacity:models.count];
+		for (MTLTestModel *model in models) {
+			[dictionaryValues addObject:model.dictionaryValue];
+		}
+
+		return dictionaryValues;
+	});
+});
+
+describe(@"copying", ^{
+	itStaysWithinBudget(@"copy", ^{
+		return [[NSArray alloc] initWithArray:models copyItems:YES];
+	});
+});
+
+describe(@"decoding archives", ^{
+	__block NSData *data;
+
+	beforeEach(^{
+		data = [NSKeyedArchiver archivedDataWithRootObject:models];
+	});
+
+	itStaysWithinBudget(@"initWithCoder", ^{
+		return (NSArray *)[NSKeyedUnarchiver unarchiveObjectWithData:data];
+	});
+});
+
+if (MTLTestAllocatedBytesInUseIsAvailable()) {
+	it(@"should not let temporaries pile up in array loops", ^{
+		NSMutableArray *largeJSONArray = [NSMutableArray arrayWithCapacity:JSONArray.count * 8];
+		for (NSUInteger index = 0; index < 8; index++) {
+			[largeJSONArray addObjectsFromArray:JSONArray];
+		}
+
+		NSArray *largeModels = [MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:largeJSONArray error:NULL];
+		expect(@(largeModels.count)).to(equal(@(largeJSONArray.count)));
+
+		uint64_t decodeBytes = MTLPendingAutoreleasedBytes(^{
+			return [MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:JSONArray error:NULL];
+		});
+		uint64_t largeDecodeBytes = MTLPendingAutoreleasedBytes(^{
+			return [MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:largeJSONArray error:NULL];
+		});
+
+		uint64_t encodeBytes = MTLPendingAutoreleasedBytes(^{
+			return [MTLJSONAdapter JSONArrayFromModels:models error:NULL];
+		});
+		uint64_t largeEncodeBytes = MTLPendingAutoreleasedBytes(^{
+			return [MTLJSONAdapter JSONArrayFromModels:largeModels error:NULL];
+		});
+
+		// Eight times as many models would leave eight times the garbage behind
+		// if it was only drained by the caller.
+		expect(@(largeDecodeBytes)).to(beLessThanOrEqualTo(@(decodeBytes * 2 + 4096)));
+		expect(@(largeEncodeBytes)).to(beLessThanOrEqualTo(@(encodeBytes * 2 + 4096)));
+	});
+} else {
+	pending(@"should not let temporaries pile up in array loops, which can't be measured on this platform", ^{});
+}
+
+QuickSpecEnd
@@ -0,0 +1,143 @@
+//
+//  MTLColumnarBatchSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLColumnarBatchSpec)
+
+__block NSArray *models;
+
+beforeEach(^{
+	MTLColumnarTestModel *first = [MTLColumnarTestModel modelWithDictionary:@{ @"identifier": @7 } error:NULL];
+	first.flag = YES;
+	first.smallNumber = -12;
+	first.largeNumber = ULLONG_MAX;
+	first.ratio = 0.5f;
+	first.score = @3;
+	first.name = @"héllo";
+	first.URL = [NSURL URLWithString:@"http://github.com"];
+	first.data = [@"bytes" dataUsingEncoding:NSUTF8StringEncoding];
+	first.date = [NSDate dateWithTimeIntervalSince1970:1000.5];
+	first.nested = [[MTLEmptyTestModel alloc] init];
+
+	MTLColumnarTestModel *second = [[MTLColumnarTestModel alloc] init];
+	second.score = @2.5;
+
+	models = @[ first, second ];
+});
+
+it(@"should extract one column per supported property", ^{
+	MTLColumnarBatch *batch = [MTLColumnarBatch batchWithModels:models ofClass:MTLColumnarTestModel.class error:NULL];
+	expect(batch).notTo(beNil());
+	expect(@(batch.count)).to(equal(@2));
+
+	NSArray *keys = [batch.columns valueForKey:@"key"];
+	expect(keys).to(equal(@[ @"URL", @"data", @"date", @"flag", @"identifier", @"largeNumber", @"name", @"ratio", @"score", @"smallNumber" ]));
+	expect([batch columnForKey:@"nested"]).to(beNil());
+
+	expect(@([batch columnForKey:@"flag"].type)).to(equal(@(MTLColumnTypeBool)));
+	expect(@([batch columnForKey:@"smallNumber"].type)).to(equal(@(MTLColumnTypeInt64)));
+	expect(@([batch columnForKey:@"largeNumber"].type)).to(equal(@(MTLColumnTypeUInt64)));
+	expect(@([batch columnForKey:@"ratio"].type)).to(equal(@(MTLColumnTypeFloat64)));
+	expect(@([batch columnForKey:@"score"].type)).to(equal(@(MTLColumnTypeFloat64)));
+	expect(@([batch columnForKey:@"name"].type)).to(equal(@(MTLColumnTypeString)));
+	expect(@([batch columnForKey:@"URL"].type)).to(equal(@(MTLColumnTypeURL)));
+	expect(@([batch columnForKey:@"data"].type)).to(equal(@(MTLColumnTypeBinary)));
+	expect(@([batch columnForKey:@"date"].type)).to(equal(@(MTLColumnTypeTimestamp)));
+});
+
+it(@"should pack values contiguously", ^{
+	MTLColumnarBatch *batch = [MTLColumnarBatch batchWithModels:models ofClass:MTLColumnarTestModel.class error:NULL];
+
+	MTLColumn *smallNumbers = [batch columnForKey:@"smallNumber"];
+	int64_t packed[2];
+	[smallNumbers.values getBytes:packed length:sizeof(packed)];
+	expect(@(CFSwapInt64LittleToHost((uint64_t)packed[0]))).to(equal(@((uint64_t)-12)));
+	expect(@(packed[1])).to(equal(@0));
+
+	MTLColumn *names = [batch columnForKey:@"name"];
+	expect(@(names.nullCount)).to(equal(@1));
+	expect(@([names isNullAtIndex:0])).to(beFalsy());
+	expect(@([names isNullAtIndex:1])).to(beTruthy());
+	expect(names.values).to(equal([@"héllo" dataUsingEncoding:NSUTF8StringEncoding]));
+	expect(@(names.offsets.length)).to(equal(@(3 * sizeof(int64_t))));
+});
+
+it(@"should recreate models", ^{
+	MTLColumnarBatch *batch = [MTLColumnarBatch batchWithModels:models ofClass:MTLColumnarTestModel.class error:NULL];
+
+	NSError *error = nil;
+	NSArray *recreated = [batch modelsWithError:&error];
+	expect(error).to(beNil());
+	expect(@(recreated.count)).to(equal(@2));
+
+	MTLColumnarTestModel *first = recreated[0];
+	expect(@(first.identifier)).to(equal(@7));
+	expect(first.nested).to(beNil());
+
+	first.nested = [models[0] nested];
+	expect(first).to(equal(models[0]));
+	expect(recreated[1]).to(equal(models[1]));
+});
+
+it(@"should round-trip through a file", ^{
+	MTLColumnarBatch *batch = [MTLColumnarBatch batchWithModels:models ofClass:MTLColumnarTestModel.class error:NULL];
+	NSURL *URL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString]];
+
+	NSError *error = nil;
+	expect(@([batch writeToURL:URL error:&error])).to(beTruthy());
+
+	MTLColumnarBatch *readBatch = [MTLColumnarBatch batchWithContentsOfURL:URL error:&error];
+	expect(readBatch).notTo(beNil());
+	expect(error).to(beNil());
+	expect(readBatch.modelClass).to(equal(MTLColumnarTestModel.class));
+	expect([[readBatch modelsWithError:NULL] valueForKey:@"name"]).to(equal(@[ @"héllo", NSNull.null ]));
+
+	[NSFileManager.defaultManager removeItemAtURL:URL error:NULL];
+});
+
+it(@"should reject corrupt data", ^{
+	MTLColumnarBatch *batch = [MTLColumnarBatch batchWithModels:models ofClass:MTLColumnarTestModel.class error:NULL];
+	NSData *data = batch.dataRepresentation;
+
+	NSError *error = nil;
+	expect([MTLColumnarBatch batchWithData:[data subdataWithRange:NSMakeRange(0, data.length - 8)] error:&error]).to(beNil());
+	expect(error.domain).to(equal(MTLColumnarBatchErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLColumnarBatchErrorInvalidData)));
+
+	error = nil;
+	expect([MTLColumnarBatch batchWithData:[@"not a batch" dataUsingEncoding:NSUTF8StringEncoding] error:&error]).to(beNil());
+	expect(@(error.code)).to(equal(@(MTLColumnarBatchErrorInvalidData)));
+});
+
+it(@"should fail for values of the wrong class", ^{
+	MTLColumnarTestModel *model = [[MTLColumnarTestModel alloc] init];
+	[model setValue:@5 forKey:@"name"];
+
+	NSError *error = nil;
+	expect([MTLColumnarBatch batchWithModels:@[ model ] ofClass:MTLColumnarTestModel.class error:&error]).to(beNil());
+	expect(@(error.code)).to(equal(@(MTLColumnarBatchErrorInvalidValue)));
+	expect(error.userInfo[MTLColumnarBatchPropertyKeyErrorKey]).to(equal(@"name"));
+});
+
+it(@"should validate recreated models", ^{
+	MTLTestModel *model = [[MTLTestModel alloc] init];
+	[model setValue:@"this name is too long" forKey:@"name"];
+
+	MTLColumnarBatch *batch = [MTLColumnarBatch batchWithModels:@[ model ] ofClass:MTLTestModel.class error:NULL];
+
+	NSError *error = nil;
+	expect([batch modelsWithError:&error]).to(beNil());
+	expect(error.domain).to(equal(MTLTestModelErrorDomain));
+});
+
+QuickSpecEnd
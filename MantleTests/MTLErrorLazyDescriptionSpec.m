@@ -0,0 +1,133 @@
+//
+//  MTLErrorLazyDescriptionSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "NSDictionary+MTLJSONKeyPath.h"
+#import "NSError+MTLLazyDescription.h"
+
+// Counts how often it has been described.
+@interface MTLDescriptionCountingObject : NSObject
+
+@property (nonatomic, assign) NSUInteger descriptionCount;
+
+@end
+
+@implementation MTLDescriptionCountingObject
+
+- (NSString *)description {
+	self.descriptionCount++;
+
+	return @"counting object";
+}
+
+@end
+
+QuickSpecBegin(MTLErrorLazyDescription)
+
+describe(@"+mtl_errorWithDomain:code:descriptionFormat:failureReasonFormat:arguments:userInfo:", ^{
+	it(@"should not describe its arguments until the description is read", ^{
+		MTLDescriptionCountingObject *object = [[MTLDescriptionCountingObject alloc] init];
+
+		NSError *error = [NSError mtl_errorWithDomain:@"MTLTestDomain" code:5 descriptionFormat:@"Bad %@" failureReasonFormat:@"%2$@ and %1$@ (100%%)" arguments:@[ object, @"other" ] userInfo:@{ @"MTLTestKey": object }];
+
+		expect(error.domain).to(equal(@"MTLTestDomain"));
+		expect(@(error.code)).to(equal(@5));
+		expect(@(object.descriptionCount)).to(equal(@0));
+
+		expect(error.localizedDescription).to(equal(@"Bad counting object"));
+		expect(error.localizedFailureReason).to(equal(@"other and counting object (100%)"));
+		expect(error.userInfo[@"MTLTestKey"]).to(beIdenticalTo(object));
+
+		// The formatted messages are cached.
+		expect(error.localizedDescription).to(equal(@"Bad counting object"));
+		expect(@(object.descriptionCount)).to(equal(@2));
+	});
+
+	it(@"should not describe its arguments when structured values are read", ^{
+		MTLDescriptionCountingObject *object = [[MTLDescriptionCountingObject alloc] init];
+		NSError *underlyingError = [NSError errorWithDomain:@"MTLTestDomain" code:1 userInfo:nil];
+
+		NSError *error = [NSError mtl_errorWithDomain:@"MTLTestDomain" code:5 descriptionFormat:@"Bad %@" failureReasonFormat:@"Really bad %@" arguments:@[ object ] userInfo:@{ NSUnderlyingErrorKey: underlyingError }];
+
+		expect([error mtl_userInfoValueForKey:NSUnderlyingErrorKey]).to(beIdenticalTo(underlyingError));
+		expect([error mtl_userInfoValueForKey:NSLocalizedDescriptionKey]).to(beNil());
+		expect(@(object.descriptionCount)).to(equal(@0));
+	});
+
+	it(@"should include the formatted messages in the userInfo", ^{
+		MTLDescriptionCountingObject *object = [[MTLDescriptionCountingObject alloc] init];
+		NSError *underlyingError = [NSError errorWithDomain:@"MTLTestDomain" code:1 userInfo:nil];
+
+		NSError *error = [NSError mtl_errorWithDomain:@"MTLTestDomain" code:5 descriptionFormat:@"Bad %@" failureReasonFormat:@"Really bad %@" arguments:@[ object ] userInfo:@{ NSUnderlyingErrorKey: underlyingError }];
+
+		expect(error.userInfo[NSLocalizedDescriptionKey]).to(equal(@"Bad counting object"));
+		expect(error.userInfo[NSLocalizedFailureReasonErrorKey]).to(equal(@"Really bad counting object"));
+		expect(error.userInfo[NSUnderlyingErrorKey]).to(beIdenticalTo(underlyingError));
+
+		// The userInfo is only built once.
+		expect(error.userInfo).to(beIdenticalTo(error.userInfo));
+		expect(@(object.descriptionCount)).to(equal(@2));
+	});
+
+	it(@"should prefer messages given in the userInfo", ^{
+		NSError *error = [NSError mtl_errorWithDomain:@"MTLTestDomain" code:5 descriptionFormat:@"Bad %@" failureReasonFormat:@"Really bad %@" arguments:@[ @"input" ] userInfo:@{ NSLocalizedDescriptionKey: @"Given" }];
+
+		expect(error.localizedDescription).to(equal(@"Given"));
+		expect(error.localizedFailureReason).to(equal(@"Really bad input"));
+	});
+
+	it(@"should archive the formatted messages", ^{
+		NSError *error = [NSError mtl_errorWithDomain:@"MTLTestDomain" code:1 descriptionFormat:@"Bad %@" failureReasonFormat:nil arguments:@[ @"input" ] userInfo:nil];
+
+		NSData *data = [NSKeyedArchiver archivedDataWithRootObject:error];
+		NSError *unarchived = [NSKeyedUnarchiver unarchiveObjectWithData:data];
+
+		expect(unarchived).to(beAKindOf(NSError.class));
+		expect(unarchived.localizedDescription).to(equal(@"Bad input"));
+	});
+});
+
+describe(@"decode failures", ^{
+	it(@"should not describe the JSON dictionary when a key path cannot be resolved", ^{
+		MTLDescriptionCountingObject *object = [[MTLDescriptionCountingObject alloc] init];
+		NSDictionary *JSONDictionary = @{ @"nested": @"not a dictionary", @"other": object };
+
+		BOOL success = YES;
+		NSError *error = nil;
+		id value = [JSONDictionary mtl_valueForJSONKeyPath:@"nested.name" success:&success error:&error];
+
+		expect(value).to(beNil());
+		expect(@(success)).to(beFalsy());
+		expect(error.domain).to(equal(MTLJSONAdapterErrorDomain));
+		expect(error.userInfo[MTLJSONAdapterJSONKeyPathErrorKey]).to(equal(@"nested.name"));
+		expect(error.userInfo[MTLJSONAdapterJSONDictionaryErrorKey]).to(beIdenticalTo(JSONDictionary));
+		expect(@(object.descriptionCount)).to(equal(@0));
+
+		expect(error.localizedFailureReason).to(contain(@"nested.name"));
+		expect(@(object.descriptionCount)).to(beGreaterThan(@0));
+	});
+
+	it(@"should record the index of an element which could not be transformed", ^{
+		NSValueTransformer<MTLTransformerErrorHandling> *transformer = [NSValueTransformer mtl_arrayMappingTransformerWithTransformer:[NSValueTransformer valueTransformerForName:MTLURLValueTransformerName]];
+
+		BOOL success = YES;
+		NSError *error = nil;
+		id value = [transformer transformedValue:@[ @"http://github.com", @"http://github.com/Mantle", @5 ] success:&success error:&error];
+
+		expect(value).to(beNil());
+		expect(@(success)).to(beFalsy());
+		expect(error.userInfo[MTLTransformerErrorHandlingIndexErrorKey]).to(equal(@2));
+		expect([error.userInfo[NSUnderlyingErrorKey] userInfo][MTLTransformerErrorHandlingInputValueErrorKey]).to(equal(@5));
+		expect(error.localizedFailureReason).to(equal(@"Could not transform value at index 2"));
+	});
+});
+
+QuickSpecEnd
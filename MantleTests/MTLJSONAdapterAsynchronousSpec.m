@@ -0,0 +1,183 @@
+//
+//  MTLJSONAdapterAsynchronousSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLJSONAdapterAsynchronousSpec)
+
+__block NSMutableArray *JSONArray;
+
+beforeEach(^{
+	JSONArray = [NSMutableArray array];
+	for (NSUInteger index = 0; index < 1000; index++) {
+		[JSONArray addObject:@{
+			@"username": [NSString stringWithFormat:@"%lu", (unsigned long)index],
+			@"count": @"5",
+		}];
+	}
+});
+
+it(@"should deserialize a model", ^{
+	waitUntil(^(void (^done)(void)) {
+		[MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:JSONArray.firstObject qualityOfService:NSQualityOfServiceUserInitiated completionQueue:nil completion:^(MTLTestModel *model, NSError *error) {
+			expect(@(NSThread.isMainThread)).to(beTruthy());
+			expect(model.name).to(equal(@"0"));
+			expect(@(model.count)).to(equal(@5));
+			expect(error).to(beNil());
+			done();
+		}];
+	});
+});
+
+it(@"should deserialize models in order and report progress", ^{
+	__block NSProgress *progress;
+
+	waitUntil(^(void (^done)(void)) {
+		progress = [MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:JSONArray qualityOfService:NSQualityOfServiceUtility completionQueue:nil completion:^(NSArray *models, NSError *error) {
+			expect(error).to(beNil());
+			expect(@(models.count)).to(equal(@1000));
+
+			[models enumerateObjectsUsingBlock:^(MTLTestModel *model, NSUInteger index, BOOL *stop) {
+				expect(model.name).to(equal([NSString stringWithFormat:@"%lu", (unsigned long)index]));
+			}];
+
+			done();
+		}];
+	});
+
+	expect(@(progress.totalUnitCount)).to(equal(@1000));
+	expect(@(progress.completedUnitCount)).to(equal(@1000));
+});
+
+it(@"should invoke the completion block on the given queue", ^{
+	dispatch_queue_t queue = dispatch_queue_create("org.mantle.MTLJSONAdapterAsynchronousSpec", DISPATCH_QUEUE_SERIAL);
+	static void *queueKey = &queueKey;
+	dispatch_queue_set_specific(queue, queueKey, queueKey, NULL);
+
+	waitUntil(^(void (^done)(void)) {
+		[MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:JSONArray qualityOfService:NSQualityOfServiceDefault completionQueue:queue completion:^(NSArray *models, NSError *error) {
+			expect([NSValue valueWithPointer:dispatch_get_specific(queueKey)]).to(equal([NSValue valueWithPointer:queueKey]));
+			done();
+		}];
+	});
+});
+
+it(@"should fail with the first error", ^{
+	// Names must be less than 10 characters.
+	JSONArray[600] = @{ @"username": @"this is too long", @"count": @"5" };
+
+	waitUntil(^(void (^done)(void)) {
+		[MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:JSONArray qualityOfService:NSQualityOfServiceDefault completionQueue:nil completion:^(NSArray *models, NSError *error) {
+			expect(models).to(beNil());
+			expect(error.domain).to(equal(MTLTestModelErrorDomain));
+			expect(@(error.code)).to(equal(@(MTLTestModelNameTooLong)));
+			done();
+		}];
+	});
+});
+
+it(@"should fail with an invalid JSON array", ^{
+	NSError *expectedError = nil;
+	[MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:(id)@{} error:&expectedError];
+
+	waitUntil(^(void (^done)(void)) {
+		[MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:(id)@{} qualityOfService:NSQualityOfServiceDefault completionQueue:nil completion:^(NSArray *models, NSError *error) {
+			expect(models).to(beNil());
+			expect(error).to(equal(expectedError));
+			done();
+		}];
+	});
+});
+
+it(@"should report cancellation", ^{
+	waitUntil(^(void (^done)(void)) {
+		NSProgress *progress = [MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:JSONArray qualityOfService:NSQualityOfServiceBackground completionQueue:nil completion:^(NSArray *models, NSError *error) {
+			expect(models).to(beNil());
+			expect(error.domain).to(equal(NSCocoaErrorDomain));
+			expect(@(error.code)).to(equal(@(NSUserCancelledError)));
+			done();
+		}];
+
+		[progress cancel];
+	});
+});
+
+it(@"should parse and deserialize JSON data", ^{
+	NSData *JSONData = [NSJSONSerialization dataWithJSONObject:JSONArray options:0 error:NULL];
+	expect(JSONData).notTo(beNil());
+
+	__block NSProgress *progress;
+
+	waitUntil(^(void (^done)(void)) {
+		progress = [MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONData:JSONData qualityOfService:NSQualityOfServiceUserInitiated completionQueue:nil completion:^(NSArray *models, NSError *error) {
+			expect(error).to(beNil());
+			expect(@(models.count)).to(equal(@1000));
+			expect([models.lastObject name]).to(equal(@"999"));
+			done();
+		}];
+	});
+
+	expect(@(progress.fractionCompleted)).to(equal(@1));
+});
+
+it(@"should fail with invalid JSON data", ^{
+	NSData *JSONData = [@"[{" dataUsingEncoding:NSUTF8StringEncoding];
+
+	waitUntil(^(void (^done)(void)) {
+		[MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONData:JSONData qualityOfService:NSQualityOfServiceDefault completionQueue:nil completion:^(NSArray *models, NSError *error) {
+			expect(models).to(beNil());
+			expect(error.domain).to(equal(NSCocoaErrorDomain));
+			done();
+		}];
+	});
+});
+
+it(@"should report cancellation of JSON data", ^{
+	NSData *JSONData = [NSJSONSerialization dataWithJSONObject:JSONArray options:0 error:NULL];
+
+	waitUntil(^(void (^done)(void)) {
+		NSProgress *progress = [MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONData:JSONData qualityOfService:NSQualityOfServiceBackground completionQueue:nil completion:^(NSArray *models, NSError *error) {
+			expect(models).to(beNil());
+			expect(@(error.code)).to(equal(@(NSUserCancelledError)));
+			done();
+		}];
+
+		[progress cancel];
+	});
+});
+
+it(@"should serialize models", ^{
+	NSError *error = nil;
+	NSArray *models = [MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:JSONArray error:&error];
+	expect(error).to(beNil());
+
+	NSArray *expectedJSONArray = [MTLJSONAdapter JSONArrayFromModels:models error:&error];
+	expect(error).to(beNil());
+
+	waitUntil(^(void (^done)(void)) {
+		[MTLJSONAdapter JSONArrayFromModels:models qualityOfService:NSQualityOfServiceUserInitiated completionQueue:nil completion:^(NSArray *JSONArray, NSError *error) {
+			expect(error).to(beNil());
+			expect(JSONArray).to(equal(expectedJSONArray));
+			done();
+		}];
+	});
+
+	waitUntil(^(void (^done)(void)) {
+		[MTLJSONAdapter JSONDictionaryFromModel:models.lastObject qualityOfService:NSQualityOfServiceUserInitiated completionQueue:nil completion:^(NSDictionary *JSONDictionary, NSError *error) {
+			expect(error).to(beNil());
+			expect(JSONDictionary).to(equal(expectedJSONArray.lastObject));
+			done();
+		}];
+	});
+});
+
+QuickSpecEnd
@@ -0,0 +1,230 @@
+//
+//  MTLJSONAdapterJSONPatchSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLJSONAdapterJSONPatchSpec)
+
+__block MTLJSONAdapter *adapter;
+__block MTLJSONPatchTestModel *model;
+
+beforeEach(^{
+	adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLJSONPatchTestModel.class];
+
+	NSError *error = nil;
+	model = [adapter modelFromJSONDictionary:@{
+		@"title": @"Issue",
+		@"count": @"3",
+		@"labels": @[ @"bug", @"ui" ],
+		@"owner": @{ @"name": @"octocat" },
+		@"members": @[ @{ @"name": @"alice" }, @{ @"name": @"bob" } ],
+		@"location": @{ @"city": @"Berlin", @"zip": @"10115" },
+		@"latitude": @52,
+		@"longitude": @13,
+	} error:&error];
+
+	expect(model).notTo(beNil());
+	expect(error).to(beNil());
+});
+
+it(@"should replace a property through its transformer", ^{
+	NSError *error = nil;
+	MTLJSONPatchTestModel *patched = [adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"replace", @"path": @"/count", @"value": @"7" },
+		@{ @"op": @"replace", @"path": @"/title", @"value": @"Bug" },
+	] toModel:model error:&error];
+
+	expect(error).to(beNil());
+	expect(@(patched.count)).to(equal(@7));
+	expect(patched.title).to(equal(@"Bug"));
+
+	expect(@(model.count)).to(equal(@3));
+	expect(model.title).to(equal(@"Issue"));
+});
+
+it(@"should remove a property", ^{
+	MTLJSONPatchTestModel *patched = [adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"remove", @"path": @"/title" },
+	] toModel:model error:NULL];
+
+	expect(patched.title).to(beNil());
+	expect(patched.labels).to(equal(model.labels));
+});
+
+it(@"should return the model itself if nothing changed", ^{
+	MTLJSONPatchTestModel *patched = [adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"replace", @"path": @"/title", @"value": @"Issue" },
+	] toModel:model error:NULL];
+
+	expect(patched).to(beIdenticalTo(model));
+});
+
+it(@"should patch nested models and share unchanged ones", ^{
+	MTLJSONPatchTestModel *patched = [adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"replace", @"path": @"/owner/name", @"value": @"hubot" },
+		@{ @"op": @"replace", @"path": @"/members/1/name", @"value": @"carol" },
+	] toModel:model error:NULL];
+
+	expect(patched.owner.name).to(equal(@"hubot"));
+	expect([patched.members[1] name]).to(equal(@"carol"));
+	expect(patched.members[0]).to(beIdenticalTo(model.members[0]));
+
+	expect(model.owner.name).to(equal(@"octocat"));
+	expect([model.members[1] name]).to(equal(@"bob"));
+});
+
+it(@"should patch arrays inside properties", ^{
+	MTLJSONPatchTestModel *patched = [adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"add", @"path": @"/labels/-", @"value": @"p1" },
+		@{ @"op": @"remove", @"path": @"/labels/0" },
+		@{ @"op": @"add", @"path": @"/members/0", @"value": @{ @"name": @"dave" } },
+	] toModel:model error:NULL];
+
+	expect(patched.labels).to(equal((@[ @"ui", @"p1" ])));
+	expect([patched.members valueForKey:@"name"]).to(equal((@[ @"dave", @"alice", @"bob" ])));
+});
+
+it(@"should splice arrays of models and share their other elements", ^{
+	MTLJSONPatchTestModel *patched = [adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"remove", @"path": @"/members/0" },
+		@{ @"op": @"add", @"path": @"/members/-", @"value": @{ @"name": @"erin" } },
+		@{ @"op": @"replace", @"path": @"/members/1", @"value": @{ @"name": @"frank" } },
+	] toModel:model error:NULL];
+
+	expect([patched.members valueForKey:@"name"]).to(equal((@[ @"bob", @"frank" ])));
+	expect(patched.members[0]).to(beIdenticalTo(model.members[1]));
+	expect(patched.owner).to(beIdenticalTo(model.owner));
+	expect([model.members valueForKey:@"name"]).to(equal((@[ @"alice", @"bob" ])));
+});
+
+it(@"should read elements of arrays of models", ^{
+	NSError *error = nil;
+	MTLJSONPatchTestModel *patched = [adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"test", @"path": @"/members/1", @"value": @{ @"name": @"bob" } },
+		@{ @"op": @"copy", @"from": @"/members/1", @"path": @"/members/0" },
+	] toModel:model error:&error];
+
+	expect(error).to(beNil());
+	expect([patched.members valueForKey:@"name"]).to(equal((@[ @"bob", @"alice", @"bob" ])));
+});
+
+it(@"should patch properties mapped to nested key paths", ^{
+	MTLJSONPatchTestModel *patched = [adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"replace", @"path": @"/location/city", @"value": @"Paris" },
+	] toModel:model error:NULL];
+
+	expect(patched.city).to(equal(@"Paris"));
+	expect(patched.zip).to(equal(@"10115"));
+
+	patched = [adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"replace", @"path": @"/location", @"value": @{ @"city": @"Rome" } },
+	] toModel:model error:NULL];
+
+	expect(patched.city).to(equal(@"Rome"));
+	expect(patched.zip).to(beNil());
+});
+
+it(@"should patch properties mapped to multiple key paths", ^{
+	MTLJSONPatchTestModel *patched = [adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"replace", @"path": @"/latitude", @"value": @48 },
+	] toModel:model error:NULL];
+
+	expect(patched.point).to(equal((@{ @"latitude": @48, @"longitude": @13 })));
+});
+
+it(@"should move and copy values", ^{
+	MTLJSONPatchTestModel *patched = [adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"copy", @"from": @"/owner/name", @"path": @"/title" },
+		@{ @"op": @"move", @"from": @"/location/city", @"path": @"/location/zip" },
+	] toModel:model error:NULL];
+
+	expect(patched.title).to(equal(@"octocat"));
+	expect(patched.zip).to(equal(@"Berlin"));
+	expect(patched.city).to(beNil());
+});
+
+it(@"should apply tests", ^{
+	NSError *error = nil;
+	MTLJSONPatchTestModel *patched = [adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"test", @"path": @"/count", @"value": @"3" },
+		@{ @"op": @"test", @"path": @"/members/0/name", @"value": @"alice" },
+	] toModel:model error:&error];
+
+	expect(patched).to(beIdenticalTo(model));
+	expect(error).to(beNil());
+
+	patched = [adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"replace", @"path": @"/title", @"value": @"Bug" },
+		@{ @"op": @"test", @"path": @"/count", @"value": @"4" },
+	] toModel:model error:&error];
+
+	expect(patched).to(beNil());
+	expect(error.domain).to(equal(MTLJSONAdapterErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorInvalidJSONPatch)));
+	expect(error.userInfo[MTLJSONAdapterJSONPatchOperationErrorKey]).notTo(beNil());
+	expect(model.title).to(equal(@"Issue"));
+});
+
+it(@"should compare JSON types strictly in tests", ^{
+	MTLJSONPatchTestModel *patched = [adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"replace", @"path": @"/latitude", @"value": @1 },
+		@{ @"op": @"test", @"path": @"/latitude", @"value": @1.0 },
+	] toModel:model error:NULL];
+
+	expect(patched).notTo(beNil());
+
+	NSError *error = nil;
+	expect([adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"test", @"path": @"/latitude", @"value": @YES },
+	] toModel:patched error:&error]).to(beNil());
+	expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorInvalidJSONPatch)));
+
+	expect([adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"test", @"path": @"/labels", @"value": @[ @"bug" ] },
+	] toModel:model error:NULL]).to(beNil());
+
+	expect([adapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"test", @"path": @"/labels", @"value": @[ @"bug", @"ui" ] },
+	] toModel:model error:NULL]).to(beIdenticalTo(model));
+});
+
+it(@"should fail for locations which do not exist", ^{
+	NSArray *patches = @[
+		@[ @{ @"op": @"replace", @"path": @"/unmapped", @"value": @1 } ],
+		@[ @{ @"op": @"replace", @"path": @"/labels/5", @"value": @"x" } ],
+		@[ @{ @"op": @"remove", @"path": @"/members/4/name" } ],
+		@[ @{ @"op": @"replace", @"path": @"title", @"value": @"x" } ],
+		@[ @{ @"op": @"frobnicate", @"path": @"/title" } ],
+		@[ @{ @"op": @"add", @"path": @"/title" } ],
+	];
+
+	for (NSArray *patch in patches) {
+		NSError *error = nil;
+		expect([adapter modelByApplyingJSONPatch:patch toModel:model error:&error]).to(beNil());
+		expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorInvalidJSONPatch)));
+	}
+});
+
+it(@"should validate new values", ^{
+	MTLTestModel *testModel = [MTLTestModel modelWithDictionary:@{ @"name": @"foo" } error:NULL];
+
+	NSError *error = nil;
+	MTLTestModel *patched = [MTLJSONAdapter modelByApplyingJSONPatch:@[
+		@{ @"op": @"replace", @"path": @"/username", @"value": @"this is too long" },
+	] toModel:testModel error:&error];
+
+	expect(patched).to(beNil());
+	expect(error.domain).to(equal(MTLTestModelErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLTestModelNameTooLong)));
+});
+
+QuickSpecEnd
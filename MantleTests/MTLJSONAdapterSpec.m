@@ -651,6 +651,44 @@ it(@"should support recursive models", ^{
 	expect(@(group.users.count)).to(equal(@2));
 });
 
+it(@"should support sharing nested model transformers across threads", ^{
+	NSDictionary *dictionary = @{
+		@"owner": @{ @"name": @"Cameron", @"groups": @[ @{ @"owner": @{ @"name": @"Nested" } } ] },
+		@"users": @[
+			@{ @"name": @"Dimitri" },
+			@{ @"name": @"John", @"groups": @[ @{ @"users": @[ @{ @"name": @"Deep" } ] } ] },
+		],
+	};
+
+	NSValueTransformer<MTLTransformerErrorHandling> *groupTransformer = [MTLJSONAdapter dictionaryTransformerWithModelClass:MTLRecursiveGroupModel.class];
+	NSValueTransformer<MTLTransformerErrorHandling> *usersTransformer = [MTLJSONAdapter arrayTransformerWithModelClass:MTLRecursiveUserModel.class];
+
+	NSUInteger iterations = 500;
+	NSMutableArray *failedIterations = [NSMutableArray array];
+
+	dispatch_apply(iterations, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+		@autoreleasepool {
+			BOOL success = NO;
+			NSError *error = nil;
+
+			MTLRecursiveGroupModel *group = [groupTransformer transformedValue:dictionary success:&success error:&error];
+			NSArray *users = [usersTransformer transformedValue:dictionary[@"users"] success:&success error:&error];
+
+			NSDictionary *JSONDictionary = [groupTransformer reverseTransformedValue:group success:&success error:&error];
+			MTLRecursiveGroupModel *decodedAgain = [MTLJSONAdapter modelOfClass:MTLRecursiveGroupModel.class fromJSONDictionary:JSONDictionary error:&error];
+
+			BOOL valid = group != nil && [group.owner.groups.firstObject owner] != nil && users.count == 2 && [[users[1] groups].firstObject users].count == 1 && [decodedAgain isEqual:group];
+			if (!valid) {
+				@synchronized (failedIterations) {
+					[failedIterations addObject:@(iteration)];
+				}
+			}
+		}
+	});
+
+	expect(failedIterations).to(beEmpty());
+});
+
 it(@"should automatically transform a property that conforms to MTLJSONSerializing", ^{
 	NSDictionary *JSONDictionary = @{
 		@"property": @"property",
@@ -697,4 +735,118 @@ it(@"should not automatically transform a property that conforms to MTLModel but
 	expect(@(error.code)).to(equal(@(MTLTransformerErrorHandlingErrorInvalidInput)));
 });
 
+describe(@"-updateModel:fromJSONDictionary:error:", ^{
+	__block MTLJSONAdapter *adapter;
+	__block MTLTestModel *model;
+
+	beforeEach(^{
+		adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+		model = [MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:@{ @"username": @"foo", @"count": @"5", @"nested": @{ @"name": @"bar" } } error:NULL];
+		expect(model).notTo(beNil());
+	});
+
+	it(@"should only update the properties present in the JSON dictionary", ^{
+		NSError *error = nil;
+		BOOL success = [adapter updateModel:model fromJSONDictionary:@{ @"count": @"7" } error:&error];
+		expect(@(success)).to(beTruthy());
+		expect(error).to(beNil());
+
+		expect(@(model.count)).to(equal(@7));
+		expect(model.name).to(equal(@"foo"));
+		expect(model.nestedName).to(equal(@"bar"));
+	});
+
+	it(@"should set properties to nil for JSON nulls", ^{
+		BOOL success = [adapter updateModel:model fromJSONDictionary:@{ @"username": NSNull.null } error:NULL];
+		expect(@(success)).to(beTruthy());
+		expect(model.name).to(beNil());
+	});
+
+	it(@"should only validate changed values", ^{
+		// Bypasses validation, which would reject a name this long.
+		model.name = @"a very long name";
+
+		expect(@([adapter updateModel:model fromJSONDictionary:@{ @"count": @"2" } error:NULL])).to(beTruthy());
+		expect(@([adapter updateModel:model fromJSONDictionary:@{ @"username": @"a very long name" } error:NULL])).to(beTruthy());
+		expect(@(model.count)).to(equal(@2));
+	});
+
+	it(@"should leave the model unchanged if validation fails", ^{
+		NSError *error = nil;
+		BOOL success = [adapter updateModel:model fromJSONDictionary:@{ @"count": @"9", @"username": @"a very long name" } error:&error];
+		expect(@(success)).to(beFalsy());
+		expect(error.domain).to(equal(MTLTestModelErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLTestModelNameTooLong)));
+
+		expect(@(model.count)).to(equal(@5));
+		expect(model.name).to(equal(@"foo"));
+	});
+
+	it(@"should return an error for an invalid JSON dictionary", ^{
+		NSError *error = nil;
+		BOOL success = [adapter updateModel:model fromJSONDictionary:(id)@[] error:&error];
+		expect(@(success)).to(beFalsy());
+		expect(error.domain).to(equal(MTLJSONAdapterErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorInvalidJSONDictionary)));
+	});
+});
+
+describe(@"shape specialization", ^{
+	__block MTLJSONAdapter *adapter;
+
+	beforeEach(^{
+		adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+	});
+
+	it(@"should reuse the shape of dictionaries with the same keys and value types", ^{
+		MTLTestModel *first = [adapter modelFromJSONDictionary:@{ @"username": @"foo", @"count": @"5" } error:NULL];
+		MTLTestModel *second = [adapter modelFromJSONDictionary:@{ @"username": @"bar", @"count": @"7", @"unmapped": @YES } error:NULL];
+
+		expect(first.name).to(equal(@"foo"));
+		expect(@(first.count)).to(equal(@5));
+		expect(second.name).to(equal(@"bar"));
+		expect(@(second.count)).to(equal(@7));
+
+		expect(@(adapter.shapeCacheMissCount)).to(equal(@1));
+		expect(@(adapter.shapeCacheHitCount)).to(equal(@1));
+	});
+
+	it(@"should decode dictionaries of a different shape correctly", ^{
+		expect([adapter modelFromJSONDictionary:@{ @"username": @"foo", @"count": @"5" } error:NULL]).notTo(beNil());
+
+		MTLTestModel *missing = [adapter modelFromJSONDictionary:@{ @"count": @"5" } error:NULL];
+		expect(missing.name).to(beNil());
+		expect(@(missing.count)).to(equal(@5));
+
+		MTLTestModel *null = [adapter modelFromJSONDictionary:@{ @"username": NSNull.null, @"nested": @{ @"name": @"bar" } } error:NULL];
+		expect(null.name).to(beNil());
+		expect(null.nestedName).to(equal(@"bar"));
+		expect(@(null.count)).to(equal(@1));
+
+		expect(@(adapter.shapeCacheMissCount)).to(equal(@3));
+		expect(@(adapter.shapeCacheHitCount)).to(equal(@0));
+	});
+
+	it(@"should still validate value types once a shape is cached", ^{
+		adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLStringModel.class];
+		expect([adapter modelFromJSONDictionary:@{ @"string": @"foo" } error:NULL]).notTo(beNil());
+		expect([adapter modelFromJSONDictionary:@{ @"string": @"bar" } error:NULL]).notTo(beNil());
+		expect(@(adapter.shapeCacheHitCount)).to(equal(@1));
+
+		NSError *error = nil;
+		MTLModel *model = [adapter modelFromJSONDictionary:@{ @"string": @666 } error:&error];
+		expect(model).to(beNil());
+		expect(error.domain).to(equal(MTLTransformerErrorHandlingErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLTransformerErrorHandlingErrorInvalidInput)));
+		expect(error.userInfo[MTLTransformerErrorHandlingInputValueErrorKey]).to(equal(@666));
+	});
+
+	it(@"should not look up shapes for partial dictionaries", ^{
+		MTLTestModel *model = [MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:@{ @"username": @"foo", @"count": @"5" } error:NULL];
+		expect(@([adapter updateModel:model fromJSONDictionary:@{ @"count": @"7" } error:NULL])).to(beTruthy());
+
+		expect(@(adapter.shapeCacheHitCount + adapter.shapeCacheMissCount)).to(equal(@0));
+	});
+});
+
 QuickSpecEnd
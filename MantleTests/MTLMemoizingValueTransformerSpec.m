@@ -0,0 +1,213 @@
+//
+//  MTLMemoizingValueTransformerSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+#import "MTLTransformerErrorExamples.h"
+
+QuickSpecBegin(MTLMemoizingValueTransformerSpec)
+
+__block NSUInteger forwardInvocations;
+__block NSUInteger reverseInvocations;
+__block MTLValueTransformer *countingTransformer;
+
+beforeEach(^{
+	forwardInvocations = 0;
+	reverseInvocations = 0;
+
+	countingTransformer = [MTLValueTransformer
+		transformerUsingForwardBlock:^ id (NSString *string, BOOL *success, NSError **error) {
+			forwardInvocations++;
+
+			if (![string isKindOfClass:NSString.class]) {
+				if (error != NULL) {
+					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:@{ MTLTransformerErrorHandlingInputValueErrorKey: string }];
+				}
+				*success = NO;
+				return nil;
+			}
+
+			if (string.length == 0) return nil;
+
+			return @(string.integerValue);
+		}
+		reverseBlock:^ id (NSNumber *number, BOOL *success, NSError **error) {
+			reverseInvocations++;
+
+			if (![number isKindOfClass:NSNumber.class]) {
+				if (error != NULL) {
+					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:@{ MTLTransformerErrorHandlingInputValueErrorKey: number }];
+				}
+				*success = NO;
+				return nil;
+			}
+
+			return number.stringValue;
+		}];
+});
+
+it(@"should only invoke the wrapped transformer once per input", ^{
+	MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:countingTransformer countLimit:10 memoizesReverseTransformations:NO];
+
+	expect([transformer transformedValue:@"5"]).to(equal(@5));
+	expect([transformer transformedValue:@"5"]).to(equal(@5));
+	expect([transformer transformedValue:@"6"]).to(equal(@6));
+
+	expect(@(forwardInvocations)).to(equal(@2));
+	expect(@(transformer.hitCount)).to(equal(@1));
+	expect(@(transformer.missCount)).to(equal(@2));
+});
+
+it(@"should cache nil results", ^{
+	MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:countingTransformer countLimit:10 memoizesReverseTransformations:NO];
+
+	BOOL success = NO;
+	expect([transformer transformedValue:@"" success:&success error:NULL]).to(beNil());
+	expect(@(success)).to(beTruthy());
+
+	success = NO;
+	expect([transformer transformedValue:@"" success:&success error:NULL]).to(beNil());
+	expect(@(success)).to(beTruthy());
+
+	expect(@(forwardInvocations)).to(equal(@1));
+});
+
+it(@"should not cache failures", ^{
+	MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:countingTransformer countLimit:10 memoizesReverseTransformations:NO];
+
+	for (NSUInteger i = 0; i < 2; i++) {
+		BOOL success = YES;
+		NSError *error = nil;
+		expect([transformer transformedValue:@42 success:&success error:&error]).to(beNil());
+		expect(@(success)).to(beFalsy());
+		expect(error.userInfo[MTLTransformerErrorHandlingInputValueErrorKey]).to(equal(@42));
+	}
+
+	expect(@(forwardInvocations)).to(equal(@2));
+});
+
+it(@"should cache numbers of different kinds separately", ^{
+	MTLValueTransformer *describingTransformer = [MTLValueTransformer transformerUsingForwardBlock:^(NSNumber *number, BOOL *success, NSError **error) {
+		forwardInvocations++;
+		return [NSString stringWithFormat:@"%@ %s", number, number.objCType];
+	}];
+
+	MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:describingTransformer countLimit:10 memoizesReverseTransformations:NO];
+
+	NSString *integerResult = [transformer transformedValue:@1];
+	NSString *booleanResult = [transformer transformedValue:@YES];
+	NSString *doubleResult = [transformer transformedValue:@1.0];
+
+	expect(@(forwardInvocations)).to(equal(@3));
+	expect(booleanResult).notTo(equal(integerResult));
+	expect(doubleResult).notTo(equal(integerResult));
+
+	expect([transformer transformedValue:@YES]).to(equal(booleanResult));
+	expect(@(forwardInvocations)).to(equal(@3));
+});
+
+it(@"should only memoize strings and numbers", ^{
+	MTLValueTransformer *identityTransformer = [MTLValueTransformer transformerUsingForwardBlock:^(id value, BOOL *success, NSError **error) {
+		forwardInvocations++;
+		return value;
+	}];
+
+	MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:identityTransformer countLimit:10 memoizesReverseTransformations:NO];
+
+	[transformer transformedValue:@{ @"key": @"value" }];
+	[transformer transformedValue:@{ @"key": @"value" }];
+
+	expect(@(forwardInvocations)).to(equal(@2));
+	expect(@(transformer.missCount)).to(equal(@0));
+});
+
+it(@"should not cache mutable results", ^{
+	MTLValueTransformer *mutableTransformer = [MTLValueTransformer transformerUsingForwardBlock:^(NSString *string, BOOL *success, NSError **error) {
+		forwardInvocations++;
+		return [NSMutableArray arrayWithObject:string];
+	}];
+
+	MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:mutableTransformer countLimit:10 memoizesReverseTransformations:NO];
+
+	NSMutableArray *first = [transformer transformedValue:@"foo"];
+	NSMutableArray *second = [transformer transformedValue:@"foo"];
+
+	expect(second).notTo(beIdenticalTo(first));
+	expect(@(forwardInvocations)).to(equal(@2));
+});
+
+it(@"should evict the least recently used results", ^{
+	MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:countingTransformer countLimit:2 memoizesReverseTransformations:NO];
+
+	[transformer transformedValue:@"1"];
+	[transformer transformedValue:@"2"];
+	[transformer transformedValue:@"1"];
+	[transformer transformedValue:@"3"];
+	expect(@(forwardInvocations)).to(equal(@3));
+
+	[transformer transformedValue:@"1"];
+	expect(@(forwardInvocations)).to(equal(@3));
+
+	[transformer transformedValue:@"2"];
+	expect(@(forwardInvocations)).to(equal(@4));
+});
+
+it(@"should only memoize reverse transformations if asked to", ^{
+	MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:countingTransformer countLimit:10 memoizesReverseTransformations:NO];
+	expect(@([transformer.class allowsReverseTransformation])).to(beTruthy());
+
+	[transformer reverseTransformedValue:@1];
+	[transformer reverseTransformedValue:@1];
+	expect(@(reverseInvocations)).to(equal(@2));
+
+	transformer = [MTLMemoizingValueTransformer transformerWithTransformer:countingTransformer countLimit:10 memoizesReverseTransformations:YES];
+
+	expect([transformer reverseTransformedValue:@1]).to(equal(@"1"));
+	expect([transformer reverseTransformedValue:@1]).to(equal(@"1"));
+	expect(@(reverseInvocations)).to(equal(@3));
+	expect(@(transformer.reverseHitCount)).to(equal(@1));
+});
+
+it(@"should not be reversible if the wrapped transformer is not", ^{
+	MTLValueTransformer *forwardTransformer = [MTLValueTransformer transformerUsingForwardBlock:^(id value, BOOL *success, NSError **error) {
+		return value;
+	}];
+
+	MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:forwardTransformer countLimit:10 memoizesReverseTransformations:YES];
+	expect(@([transformer.class allowsReverseTransformation])).to(beFalsy());
+});
+
+itBehavesLike(MTLTransformerErrorExamples, ^{
+	return @{
+		MTLTransformerErrorExamplesTransformer: [MTLMemoizingValueTransformer transformerWithTransformer:[NSValueTransformer valueTransformerForName:MTLURLValueTransformerName] countLimit:10 memoizesReverseTransformations:YES],
+		MTLTransformerErrorExamplesInvalidTransformationInput: @"not a valid URL",
+		MTLTransformerErrorExamplesInvalidReverseTransformationInput: NSNull.null
+	};
+});
+
+describe(@"MTLJSONAdapter", ^{
+	it(@"should share memoized transformers between adapters", ^{
+		NSDictionary *JSONDictionary = @{ @"URL": @"http://github.com/Mantle/Mantle" };
+
+		for (NSUInteger i = 0; i < 3; i++) {
+			NSError *error = nil;
+			MTLMemoizingTestModel *model = [MTLJSONAdapter modelOfClass:MTLMemoizingTestModel.class fromJSONDictionary:JSONDictionary error:&error];
+			expect(error).to(beNil());
+			expect(model.URL).to(equal([NSURL URLWithString:@"http://github.com/Mantle/Mantle"]));
+		}
+
+		MTLMemoizingValueTransformer *transformer = [MTLJSONAdapter memoizingTransformersForModelClass:MTLMemoizingTestModel.class][@"URL"];
+		expect(transformer).to(beAKindOf(MTLMemoizingValueTransformer.class));
+		expect(@(transformer.hitCount)).to(beGreaterThanOrEqualTo(@2));
+	});
+});
+
+QuickSpecEnd
@@ -0,0 +1,97 @@
+//
+//  MTLMessagePackAdapterSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLMessagePackAdapterSpec)
+
+__block MTLMessagePackTestModel *model;
+
+beforeEach(^{
+	model = [[MTLMessagePackTestModel alloc] init];
+	model.date = [NSDate dateWithTimeIntervalSince1970:1234567890.5];
+	model.data = [@"binary" dataUsingEncoding:NSUTF8StringEncoding];
+	model.count = 300;
+	model.ratio = 0.75;
+	model.URL = [NSURL URLWithString:@"http://github.com"];
+});
+
+it(@"should round-trip a model", ^{
+	NSError *error = nil;
+	NSData *data = [MTLMessagePackAdapter messagePackDataFromModel:model error:&error];
+	expect(data).notTo(beNil());
+	expect(error).to(beNil());
+
+	MTLMessagePackTestModel *decoded = [MTLMessagePackAdapter modelOfClass:MTLMessagePackTestModel.class fromMessagePackData:data error:&error];
+	expect(decoded).to(equal(model));
+	expect(error).to(beNil());
+});
+
+it(@"should write native types instead of JSON representations", ^{
+	NSData *data = [MTLMessagePackAdapter messagePackDataFromModel:model error:NULL];
+	NSDictionary *dictionary = [MTLMessagePackSerialization messagePackObjectWithData:data error:NULL];
+
+	expect(dictionary[@"date"]).to(beAKindOf(NSDate.class));
+	expect(dictionary[@"data"]).to(equal(model.data));
+	expect(dictionary[@"count"]).to(equal(@300));
+	expect(dictionary[@"ratio"]).to(equal(@0.75));
+	expect(dictionary[@"URL"]).to(equal(@"http://github.com"));
+});
+
+it(@"should decode values using JSON transformers", ^{
+	NSDictionary *dictionary = @{
+		@"date": @"2009-02-13T23:31:30Z",
+		@"count": @300,
+		@"URL": @"http://github.com",
+	};
+
+	NSData *data = [MTLMessagePackSerialization dataWithMessagePackObject:dictionary error:NULL];
+	MTLMessagePackTestModel *decoded = [MTLMessagePackAdapter modelOfClass:MTLMessagePackTestModel.class fromMessagePackData:data error:NULL];
+
+	expect(decoded.date).to(equal([NSDate dateWithTimeIntervalSince1970:1234567890]));
+	expect(@(decoded.count)).to(equal(@300));
+	expect(decoded.URL).to(equal(model.URL));
+});
+
+it(@"should not change the JSON representation", ^{
+	NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+	expect(JSONDictionary[@"date"]).to(equal(@"2009-02-13T23:31:30Z"));
+});
+
+it(@"should round-trip arrays of models", ^{
+	NSError *error = nil;
+	NSData *data = [MTLMessagePackAdapter messagePackDataFromModels:@[ model, model ] error:&error];
+	expect(data).notTo(beNil());
+
+	NSArray *models = [MTLMessagePackAdapter modelsOfClass:MTLMessagePackTestModel.class fromMessagePackData:data error:&error];
+	expect(models).to(equal(@[ model, model ]));
+	expect(error).to(beNil());
+});
+
+it(@"should fail for data which is not a map", ^{
+	NSData *data = [MTLMessagePackSerialization dataWithMessagePackObject:@[ @1 ] error:NULL];
+
+	NSError *error = nil;
+	MTLMessagePackTestModel *decoded = [MTLMessagePackAdapter modelOfClass:MTLMessagePackTestModel.class fromMessagePackData:data error:&error];
+	expect(decoded).to(beNil());
+	expect(error.domain).to(equal(MTLJSONAdapterErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorInvalidJSONDictionary)));
+});
+
+it(@"should fail for invalid data", ^{
+	NSError *error = nil;
+	MTLMessagePackTestModel *decoded = [MTLMessagePackAdapter modelOfClass:MTLMessagePackTestModel.class fromMessagePackData:[NSData dataWithBytes:"\x81" length:1] error:&error];
+	expect(decoded).to(beNil());
+	expect(error.domain).to(equal(MTLMessagePackSerializationErrorDomain));
+});
+
+QuickSpecEnd
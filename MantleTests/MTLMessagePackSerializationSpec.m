@@ -0,0 +1,169 @@
+//
+//  MTLMessagePackSerializationSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+static NSData *MTLDataWithBytes(NSArray *bytes) {
+	NSMutableData *data = [NSMutableData dataWithCapacity:bytes.count];
+	for (NSNumber *byte in bytes) {
+		uint8_t value = byte.unsignedCharValue;
+		[data appendBytes:&value length:1];
+	}
+
+	return data;
+}
+
+QuickSpecBegin(MTLMessagePackSerializationSpec)
+
+describe(@"writing", ^{
+	it(@"should use the smallest integer encoding", ^{
+		expect([MTLMessagePackSerialization dataWithMessagePackObject:@5 error:NULL]).to(equal(MTLDataWithBytes(@[ @0x05 ])));
+		expect([MTLMessagePackSerialization dataWithMessagePackObject:@-3 error:NULL]).to(equal(MTLDataWithBytes(@[ @0xfd ])));
+		expect([MTLMessagePackSerialization dataWithMessagePackObject:@200 error:NULL]).to(equal(MTLDataWithBytes(@[ @0xcc, @0xc8 ])));
+		expect([MTLMessagePackSerialization dataWithMessagePackObject:@-200 error:NULL]).to(equal(MTLDataWithBytes(@[ @0xd1, @0xff, @0x38 ])));
+		expect([MTLMessagePackSerialization dataWithMessagePackObject:@70000 error:NULL]).to(equal(MTLDataWithBytes(@[ @0xce, @0x00, @0x01, @0x11, @0x70 ])));
+	});
+
+	it(@"should write booleans, nil and floating-point numbers", ^{
+		expect([MTLMessagePackSerialization dataWithMessagePackObject:@YES error:NULL]).to(equal(MTLDataWithBytes(@[ @0xc3 ])));
+		expect([MTLMessagePackSerialization dataWithMessagePackObject:NSNull.null error:NULL]).to(equal(MTLDataWithBytes(@[ @0xc0 ])));
+		expect([MTLMessagePackSerialization dataWithMessagePackObject:@1.5f error:NULL]).to(equal(MTLDataWithBytes(@[ @0xca, @0x3f, @0xc0, @0x00, @0x00 ])));
+		expect([MTLMessagePackSerialization dataWithMessagePackObject:@1.5 error:NULL]).to(equal(MTLDataWithBytes(@[ @0xcb, @0x3f, @0xf8, @0x00, @0x00, @0x00, @0x00, @0x00, @0x00 ])));
+	});
+
+	it(@"should write strings, binary data and collections", ^{
+		expect([MTLMessagePackSerialization dataWithMessagePackObject:@"abc" error:NULL]).to(equal(MTLDataWithBytes(@[ @0xa3, @0x61, @0x62, @0x63 ])));
+		expect([MTLMessagePackSerialization dataWithMessagePackObject:MTLDataWithBytes(@[ @1, @2 ]) error:NULL]).to(equal(MTLDataWithBytes(@[ @0xc4, @0x02, @0x01, @0x02 ])));
+		expect([MTLMessagePackSerialization dataWithMessagePackObject:@[ @1, @"a" ] error:NULL]).to(equal(MTLDataWithBytes(@[ @0x92, @0x01, @0xa1, @0x61 ])));
+		expect([MTLMessagePackSerialization dataWithMessagePackObject:@{ @"a": @1 } error:NULL]).to(equal(MTLDataWithBytes(@[ @0x81, @0xa1, @0x61, @0x01 ])));
+	});
+
+	it(@"should write dates as timestamps", ^{
+		NSDate *date = [NSDate dateWithTimeIntervalSince1970:1];
+		expect([MTLMessagePackSerialization dataWithMessagePackObject:date error:NULL]).to(equal(MTLDataWithBytes(@[ @0xd6, @0xff, @0x00, @0x00, @0x00, @0x01 ])));
+
+		NSDate *fractionalDate = [NSDate dateWithTimeIntervalSince1970:1.5];
+		expect(@([MTLMessagePackSerialization dataWithMessagePackObject:fractionalDate error:NULL].length)).to(equal(@10));
+
+		NSDate *pastDate = [NSDate dateWithTimeIntervalSince1970:-1];
+		expect(@([MTLMessagePackSerialization dataWithMessagePackObject:pastDate error:NULL].length)).to(equal(@15));
+	});
+
+	it(@"should fail for dates which cannot be written as timestamps", ^{
+		for (NSNumber *interval in @[ @(INFINITY), @(-INFINITY), @(NAN), @1e19 ]) {
+			NSDate *date = [NSDate dateWithTimeIntervalSince1970:interval.doubleValue];
+
+			NSError *error = nil;
+			expect([MTLMessagePackSerialization dataWithMessagePackObject:date error:&error]).to(beNil());
+			expect(@(error.code)).to(equal(@(MTLMessagePackSerializationErrorUnsupportedType)));
+		}
+	});
+
+	it(@"should fail for strings which cannot be converted to UTF-8", ^{
+		unichar loneSurrogate = 0xd800;
+		NSString *string = [NSString stringWithCharacters:&loneSurrogate length:1];
+
+		NSError *error = nil;
+		expect([MTLMessagePackSerialization dataWithMessagePackObject:@[ @"a", string ] error:&error]).to(beNil());
+		expect(error.domain).to(equal(MTLMessagePackSerializationErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLMessagePackSerializationErrorUnsupportedType)));
+	});
+
+	it(@"should fail for unsupported objects", ^{
+		NSError *error = nil;
+		NSData *data = [MTLMessagePackSerialization dataWithMessagePackObject:@[ [NSURL URLWithString:@"http://github.com"] ] error:&error];
+
+		expect(data).to(beNil());
+		expect(error.domain).to(equal(MTLMessagePackSerializationErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLMessagePackSerializationErrorUnsupportedType)));
+	});
+});
+
+describe(@"reading", ^{
+	it(@"should round-trip supported objects", ^{
+		NSDictionary *object = @{
+			@"string": @"héllo",
+			@"integers": @[ @0, @-1, @127, @128, @-33, @65536, @(INT64_MAX), @(INT64_MIN), @(UINT64_MAX) ],
+			@"doubles": @[ @0.25, @-1e100 ],
+			@"boolean": @NO,
+			@"null": NSNull.null,
+			@"data": MTLDataWithBytes(@[ @0xde, @0xad ]),
+			@"dates": @[ [NSDate dateWithTimeIntervalSince1970:1000], [NSDate dateWithTimeIntervalSince1970:1000.25], [NSDate dateWithTimeIntervalSince1970:-1000.5] ],
+			@"nested": @{ @"long": [@"" stringByPaddingToLength:300 withString:@"x" startingAtIndex:0] },
+		};
+
+		NSError *error = nil;
+		NSData *data = [MTLMessagePackSerialization dataWithMessagePackObject:object error:&error];
+		expect(data).notTo(beNil());
+		expect(error).to(beNil());
+
+		id readObject = [MTLMessagePackSerialization messagePackObjectWithData:data error:&error];
+		expect(readObject).to(equal(object));
+		expect(error).to(beNil());
+	});
+
+	it(@"should read booleans as booleans", ^{
+		NSNumber *number = [MTLMessagePackSerialization messagePackObjectWithData:MTLDataWithBytes(@[ @0xc3 ]) error:NULL];
+		expect(number).to(equal(@YES));
+		expect(@(CFGetTypeID((__bridge CFTypeRef)number) == CFBooleanGetTypeID())).to(beTruthy());
+	});
+
+	it(@"should fail for truncated data", ^{
+		NSError *error = nil;
+		id object = [MTLMessagePackSerialization messagePackObjectWithData:MTLDataWithBytes(@[ @0x92, @0x01 ]) error:&error];
+
+		expect(object).to(beNil());
+		expect(error.domain).to(equal(MTLMessagePackSerializationErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLMessagePackSerializationErrorTruncatedData)));
+		expect(error.userInfo[MTLMessagePackSerializationOffsetErrorKey]).to(equal(@2));
+	});
+
+	it(@"should not trust collection lengths", ^{
+		NSError *error = nil;
+		id object = [MTLMessagePackSerialization messagePackObjectWithData:MTLDataWithBytes(@[ @0xdd, @0xff, @0xff, @0xff, @0xff ]) error:&error];
+
+		expect(object).to(beNil());
+		expect(@(error.code)).to(equal(@(MTLMessagePackSerializationErrorTruncatedData)));
+	});
+
+	it(@"should fail for invalid data", ^{
+		NSError *error = nil;
+
+		expect([MTLMessagePackSerialization messagePackObjectWithData:MTLDataWithBytes(@[ @0xc1 ]) error:&error]).to(beNil());
+		expect(@(error.code)).to(equal(@(MTLMessagePackSerializationErrorInvalidData)));
+
+		error = nil;
+		expect([MTLMessagePackSerialization messagePackObjectWithData:MTLDataWithBytes(@[ @0x01, @0x02 ]) error:&error]).to(beNil());
+		expect(@(error.code)).to(equal(@(MTLMessagePackSerializationErrorInvalidData)));
+
+		error = nil;
+		expect([MTLMessagePackSerialization messagePackObjectWithData:MTLDataWithBytes(@[ @0xa1, @0xff ]) error:&error]).to(beNil());
+		expect(@(error.code)).to(equal(@(MTLMessagePackSerializationErrorInvalidData)));
+
+		error = nil;
+		expect([MTLMessagePackSerialization messagePackObjectWithData:MTLDataWithBytes(@[ @0xd4, @0x01, @0x00 ]) error:&error]).to(beNil());
+		expect(@(error.code)).to(equal(@(MTLMessagePackSerializationErrorInvalidData)));
+	});
+
+	it(@"should limit the nesting depth", ^{
+		NSMutableData *data = [NSMutableData data];
+		for (NSUInteger i = 0; i < 1000; i++) {
+			[data appendData:MTLDataWithBytes(@[ @0x91 ])];
+		}
+
+		[data appendData:MTLDataWithBytes(@[ @0xc0 ])];
+
+		NSError *error = nil;
+		expect([MTLMessagePackSerialization messagePackObjectWithData:data error:&error]).to(beNil());
+		expect(@(error.code)).to(equal(@(MTLMessagePackSerializationErrorInvalidData)));
+	});
+});
+
+QuickSpecEnd
@@ -0,0 +1,193 @@
+//
+//  MTLMetricsSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+#import <pthread.h>
+
+#import "MTLTestModel.h"
+
+// Collects the kinds of all recorded measurements.
+@interface MTLRecordingMetricsSink : NSObject <MTLMetricsSink>
+
+@property (atomic, copy, readonly) NSArray *kinds;
+
+@end
+
+@implementation MTLRecordingMetricsSink
+
+- (void)recordMetricOfKind:(MTLMetricKind)kind modelClass:(Class)modelClass propertyKey:(NSString *)propertyKey duration:(uint64_t)duration success:(BOOL)success error:(NSError *)error {
+	@synchronized (self) {
+		_kinds = [(_kinds ?: @[]) arrayByAddingObject:@(kind)];
+	}
+}
+
+@end
+
+static const NSUInteger MTLMetricsSpecThreadCount = 4;
+static const NSUInteger MTLMetricsSpecDecodesPerThread = 10;
+
+// Decodes the JSON dictionary `context` into MTLTestModels a few times.
+static void *MTLMetricsSpecDecode(void *context) {
+	@autoreleasepool {
+		NSDictionary *values = (__bridge NSDictionary *)context;
+
+		for (NSUInteger index = 0; index < MTLMetricsSpecDecodesPerThread; index++) {
+			[MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL];
+		}
+	}
+
+	return NULL;
+}
+
+QuickSpecBegin(MTLMetricsSpec)
+
+NSDictionary *values = @{
+	@"username": @"foo",
+	@"count": @"5",
+	@"nested": @{ @"name": @"bar" },
+};
+
+beforeEach(^{
+	[MTLMetrics reset];
+	[MTLMetrics setEnabled:YES];
+});
+
+afterEach(^{
+	[MTLMetrics setEnabled:NO];
+	[MTLMetrics reset];
+});
+
+it(@"should not measure anything while disabled", ^{
+	[MTLMetrics setEnabled:NO];
+
+	MTLTestModel *model = [MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL];
+	expect(model).notTo(beNil());
+
+	MTLMetricsSnapshot *snapshot = [MTLMetrics snapshot];
+	expect(@([snapshot statisticsForKind:MTLMetricKindDecode].count)).to(equal(@0));
+	expect(snapshot.modelClasses).to(beEmpty());
+});
+
+it(@"should measure decoding per class and property", ^{
+	MTLTestModel *model = [MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL];
+	expect(model).notTo(beNil());
+
+	MTLMetricsSnapshot *snapshot = [MTLMetrics snapshot];
+	expect(snapshot.modelClasses).to(contain(MTLTestModel.class));
+
+	MTLMetricStatistics *decode = [snapshot statisticsForKind:MTLMetricKindDecode modelClass:MTLTestModel.class];
+	expect(@(decode.count)).to(equal(@1));
+	expect(@(decode.failureCount)).to(equal(@0));
+	expect(@(decode.totalDuration)).to(beGreaterThan(@0));
+	expect(@(decode.maximumDuration)).to(equal(@(decode.totalDuration)));
+
+	MTLMetricStatistics *countTransform = [snapshot statisticsForKind:MTLMetricKindTransform modelClass:MTLTestModel.class propertyKey:@"count"];
+	expect(@(countTransform.count)).to(equal(@1));
+
+	expect(@([snapshot statisticsForKind:MTLMetricKindValidation modelClass:MTLTestModel.class].count)).to(equal(@1));
+	expect(@([snapshot statisticsForKind:MTLMetricKindReflectionCacheHit].count)).to(beGreaterThan(@0));
+});
+
+it(@"should measure encoding", ^{
+	MTLTestModel *model = [MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL];
+	[MTLMetrics reset];
+
+	NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+	expect(JSONDictionary).notTo(beNil());
+
+	MTLMetricsSnapshot *snapshot = [MTLMetrics snapshot];
+	expect(@([snapshot statisticsForKind:MTLMetricKindEncode modelClass:MTLTestModel.class].count)).to(equal(@1));
+	expect(@([snapshot statisticsForKind:MTLMetricKindReverseTransform modelClass:MTLTestModel.class propertyKey:@"count"].count)).to(equal(@1));
+	expect(@([snapshot statisticsForKind:MTLMetricKindDecode].count)).to(equal(@0));
+});
+
+it(@"should count errors by domain and code", ^{
+	NSDictionary *invalidValues = @{ @"username": @"this is too long" };
+
+	NSError *error = nil;
+	MTLTestModel *model = [MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:invalidValues error:&error];
+	expect(model).to(beNil());
+	expect(error.domain).to(equal(MTLTestModelErrorDomain));
+
+	MTLMetricsSnapshot *snapshot = [MTLMetrics snapshot];
+	expect(@([snapshot statisticsForKind:MTLMetricKindDecode modelClass:MTLTestModel.class].failureCount)).to(equal(@1));
+
+	NSDictionary *errorCounts = [snapshot errorCountsForKind:MTLMetricKindDecode];
+	expect(errorCounts).to(equal(@{ MTLTestModelErrorDomain: @{ @(MTLTestModelNameTooLong): @1 } }));
+});
+
+it(@"should measure adapter and transformer caches", ^{
+	NSDictionary *clusterValues = @{
+		@"flavor": @"chocolate",
+		@"chocolate_bitterness": @"100",
+	};
+
+	MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLClassClusterModel.class];
+	[adapter modelFromJSONDictionary:clusterValues error:NULL];
+	[adapter modelFromJSONDictionary:clusterValues error:NULL];
+
+	MTLMetricsSnapshot *snapshot = [MTLMetrics snapshot];
+	expect(@([snapshot statisticsForKind:MTLMetricKindAdapterCacheMiss modelClass:MTLChocolateClassClusterModel.class].count)).to(equal(@1));
+	expect(@([snapshot statisticsForKind:MTLMetricKindAdapterCacheHit modelClass:MTLChocolateClassClusterModel.class].count)).to(equal(@1));
+
+	MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:[NSValueTransformer valueTransformerForName:MTLURLValueTransformerName] countLimit:10 memoizesReverseTransformations:NO];
+	[transformer transformedValue:@"https://github.com"];
+	[transformer transformedValue:@"https://github.com"];
+
+	snapshot = [MTLMetrics snapshot];
+	expect(@([snapshot statisticsForKind:MTLMetricKindTransformerCacheMiss].count)).to(equal(@1));
+	expect(@([snapshot statisticsForKind:MTLMetricKindTransformerCacheHit].count)).to(equal(@1));
+});
+
+it(@"should forward measurements to sinks", ^{
+	MTLRecordingMetricsSink *sink = [[MTLRecordingMetricsSink alloc] init];
+	[MTLMetrics addSink:sink];
+
+	[MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL];
+	expect(sink.kinds).to(contain(@(MTLMetricKindDecode)));
+	expect(sink.kinds).to(contain(@(MTLMetricKindTransform)));
+
+	NSUInteger count = sink.kinds.count;
+	[MTLMetrics removeSink:sink];
+
+	[MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL];
+	expect(@(sink.kinds.count)).to(equal(@(count)));
+});
+
+it(@"should combine measurements from all threads, including exited ones", ^{
+	pthread_t threads[MTLMetricsSpecThreadCount];
+	for (NSUInteger index = 0; index < MTLMetricsSpecThreadCount; index++) {
+		expect(@(pthread_create(&threads[index], NULL, MTLMetricsSpecDecode, (__bridge void *)values))).to(equal(@0));
+	}
+
+	// Joining waits for the threads to exit.
+	for (NSUInteger index = 0; index < MTLMetricsSpecThreadCount; index++) {
+		pthread_join(threads[index], NULL);
+	}
+
+	[MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL];
+
+	NSUInteger expectedCount = MTLMetricsSpecThreadCount * MTLMetricsSpecDecodesPerThread + 1;
+
+	MTLMetricsSnapshot *snapshot = [MTLMetrics snapshot];
+	expect(@([snapshot statisticsForKind:MTLMetricKindDecode modelClass:MTLTestModel.class].count)).to(equal(@(expectedCount)));
+	expect(@([snapshot statisticsForKind:MTLMetricKindTransform modelClass:MTLTestModel.class propertyKey:@"count"].count)).to(equal(@(expectedCount)));
+});
+
+it(@"should reset", ^{
+	[MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL];
+	[MTLMetrics reset];
+
+	MTLMetricsSnapshot *snapshot = [MTLMetrics snapshot];
+	expect(@([snapshot statisticsForKind:MTLMetricKindDecode].count)).to(equal(@0));
+	expect([snapshot errorCountsForKind:MTLMetricKindDecode]).to(beEmpty());
+});
+
+QuickSpecEnd
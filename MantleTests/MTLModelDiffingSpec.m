@@ -0,0 +1,132 @@
+//
+//  MTLModelDiffingSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLModelDiffingSpec)
+
+__block MTLDiffingTestModel *model;
+
+beforeEach(^{
+	MTLDiffingTestModel *child = [[MTLDiffingTestModel alloc] init];
+	child.name = @"child";
+
+	MTLDiffingTestModel *firstElement = [[MTLDiffingTestModel alloc] init];
+	firstElement.count = 1;
+
+	MTLDiffingTestModel *secondElement = [[MTLDiffingTestModel alloc] init];
+	secondElement.count = 2;
+
+	model = [[MTLDiffingTestModel alloc] init];
+	model.count = 5;
+	model.ratio = 0.5;
+	model.name = @"foobar";
+	model.child = child;
+	model.children = @[ firstElement, secondElement ];
+});
+
+describe(@"-changedPropertyKeysComparedToModel:", ^{
+	it(@"should return no keys for equal models", ^{
+		expect([model changedPropertyKeysComparedToModel:model]).to(equal(@[]));
+		expect([model changedPropertyKeysComparedToModel:[model copy]]).to(equal(@[]));
+	});
+
+	it(@"should return the changed keys sorted", ^{
+		MTLDiffingTestModel *other = [model copy];
+		other.ratio = 1.5;
+		other.name = @"changed";
+		other.count = 6;
+
+		expect([model changedPropertyKeysComparedToModel:other]).to(equal(@[ @"count", @"name", @"ratio" ]));
+	});
+
+	it(@"should report changes of nested models by their key", ^{
+		MTLDiffingTestModel *other = [model copy];
+		other.child = [model.child copy];
+		other.child.name = @"changed";
+
+		expect([model changedPropertyKeysComparedToModel:other]).to(equal(@[ @"child" ]));
+	});
+
+	it(@"should treat NaN as equal to NaN", ^{
+		model.ratio = NAN;
+		MTLDiffingTestModel *other = [model copy];
+
+		expect([model changedPropertyKeysComparedToModel:other]).to(equal(@[]));
+	});
+
+	it(@"should ignore transitory properties", ^{
+		MTLDiffingTestModel *other = [model copy];
+		other.parent = model;
+
+		expect([model changedPropertyKeysComparedToModel:other]).to(equal(@[]));
+	});
+
+	it(@"should agree with -isEqual:", ^{
+		MTLDiffingTestModel *other = [model copy];
+		expect(@([model isEqual:other])).to(beTruthy());
+
+		other.name = nil;
+		expect(@([model isEqual:other])).to(beFalsy());
+		expect([model changedPropertyKeysComparedToModel:other]).to(equal(@[ @"name" ]));
+	});
+});
+
+describe(@"-changedKeyPathsComparedToModel:", ^{
+	it(@"should return no key paths for equal models", ^{
+		expect([model changedKeyPathsComparedToModel:[model copy]]).to(equal(@[]));
+	});
+
+	it(@"should descend into nested models", ^{
+		MTLDiffingTestModel *other = [model copy];
+		other.child = [model.child copy];
+		other.child.name = @"changed";
+		other.child.count = 3;
+
+		expect([model changedKeyPathsComparedToModel:other]).to(equal(@[ @"child.count", @"child.name" ]));
+	});
+
+	it(@"should report a nested model replaced by nil by its key", ^{
+		MTLDiffingTestModel *other = [model copy];
+		other.child = nil;
+
+		expect([model changedKeyPathsComparedToModel:other]).to(equal(@[ @"child" ]));
+	});
+
+	it(@"should descend into arrays of the same length", ^{
+		MTLDiffingTestModel *changedElement = [model.children[1] copy];
+		changedElement.name = @"changed";
+
+		MTLDiffingTestModel *other = [model copy];
+		other.children = @[ model.children[0], changedElement ];
+
+		expect([model changedKeyPathsComparedToModel:other]).to(equal(@[ @"children.1.name" ]));
+	});
+
+	it(@"should report arrays of different lengths by their key", ^{
+		MTLDiffingTestModel *other = [model copy];
+		other.children = @[ model.children[0] ];
+
+		expect([model changedKeyPathsComparedToModel:other]).to(equal(@[ @"children" ]));
+	});
+
+	it(@"should report changed non-model elements by their index", ^{
+		model.children = @[ @"a", @"b", @"c" ];
+
+		MTLDiffingTestModel *other = [model copy];
+		other.children = @[ @"a", @"x", @"c" ];
+
+		expect([model changedKeyPathsComparedToModel:other]).to(equal(@[ @"children.1" ]));
+	});
+});
+
+QuickSpecEnd
@@ -0,0 +1,224 @@
+//
+//  MTLModelUpdatingSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLModelUpdatingSpec)
+
+describe(@"-modelByUpdatingValues:error:", ^{
+	__block MTLDiffingTestModel *model;
+
+	beforeEach(^{
+		model = [[MTLDiffingTestModel alloc] init];
+		model.count = 3;
+		model.ratio = 0.5;
+		model.name = @"foo";
+		model.child = [[MTLDiffingTestModel alloc] init];
+		model.children = @[ [[MTLDiffingTestModel alloc] init] ];
+	});
+
+	it(@"should return a new model with the values replaced", ^{
+		NSError *error = nil;
+		MTLDiffingTestModel *updatedModel = [model modelByUpdatingValues:@{ @"name": @"bar", @"count": @4 } error:&error];
+		expect(updatedModel).notTo(beNil());
+		expect(error).to(beNil());
+
+		expect(updatedModel).notTo(beIdenticalTo(model));
+		expect(updatedModel.name).to(equal(@"bar"));
+		expect(@(updatedModel.count)).to(equal(@4));
+		expect(@(updatedModel.ratio)).to(equal(@0.5));
+
+		expect(model.name).to(equal(@"foo"));
+		expect(@(model.count)).to(equal(@3));
+	});
+
+	it(@"should share unchanged values", ^{
+		MTLDiffingTestModel *updatedModel = [model modelByUpdatingValues:@{ @"name": @"bar" } error:NULL];
+
+		expect(updatedModel.child).to(beIdenticalTo(model.child));
+		expect(updatedModel.children).to(beIdenticalTo(model.children));
+	});
+
+	it(@"should convert NSNull to nil", ^{
+		MTLDiffingTestModel *updatedModel = [model modelByUpdatingValues:@{ @"child": NSNull.null } error:NULL];
+		expect(updatedModel).notTo(beNil());
+		expect(updatedModel.child).to(beNil());
+	});
+
+	it(@"should return a new model even if nothing changed", ^{
+		MTLDiffingTestModel *updatedModel = [model modelByUpdatingValues:@{} error:NULL];
+
+		expect(updatedModel).to(equal(model));
+		expect(updatedModel).notTo(beIdenticalTo(model));
+	});
+
+	it(@"should fail for unknown keys", ^{
+		NSError *error = nil;
+		MTLDiffingTestModel *updatedModel = [model modelByUpdatingValues:@{ @"foobar": @"baz" } error:&error];
+		expect(updatedModel).to(beNil());
+
+		expect(error.domain).to(equal(MTLModelUpdatingErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLModelUpdatingErrorUnknownKey)));
+		expect(error.userInfo[MTLModelUpdatingKeyPathErrorKey]).to(equal(@"foobar"));
+	});
+
+	it(@"should update sparse models", ^{
+		MTLSparseTestModel *sparseModel = [[MTLSparseTestModel alloc] init];
+		sparseModel.name = @"foo";
+		sparseModel.count = 2;
+		sparseModel.identifier = @"1";
+
+		MTLSparseTestModel *updatedModel = [sparseModel modelByUpdatingValues:@{ @"count": @0, @"title": @"bar" } error:NULL];
+		expect(updatedModel.name).to(equal(@"foo"));
+		expect(updatedModel.title).to(equal(@"bar"));
+		expect(updatedModel.identifier).to(equal(@"1"));
+		expect(@(updatedModel.count)).to(equal(@0));
+		expect(@(updatedModel.populatedSparsePropertyCount)).to(equal(@2));
+	});
+
+	it(@"should return new models from -modelBySettingValue:forKeyPath:error: even if nothing changed", ^{
+		MTLDiffingTestModel *updatedModel = [model modelBySettingValue:nil forKeyPath:@"child.name" error:NULL];
+		expect(updatedModel).to(equal(model));
+		expect(updatedModel).notTo(beIdenticalTo(model));
+		expect(updatedModel.child).notTo(beIdenticalTo(model.child));
+
+		updatedModel = [model modelBySettingValue:nil forKeyPath:@"children.0.name" error:NULL];
+		expect(updatedModel).to(equal(model));
+		expect(updatedModel).notTo(beIdenticalTo(model));
+		expect(updatedModel.children[0]).notTo(beIdenticalTo(model.children[0]));
+	});
+});
+
+describe(@"immutable models", ^{
+	__block MTLImmutableTestModel *model;
+
+	beforeEach(^{
+		MTLImmutableTestModel *child = [MTLImmutableTestModel modelWithDictionary:@{ @"name": @"child" } error:NULL];
+		MTLImmutableTestModel *element = [MTLImmutableTestModel modelWithDictionary:@{ @"name": @"element", @"child": child } error:NULL];
+
+		model = [MTLImmutableTestModel modelWithDictionary:@{
+			@"name": @"foo",
+			@"count": @3,
+			@"child": child,
+			@"children": @[ element, [[MTLImmutableTestModel alloc] init] ],
+		} error:NULL];
+
+		expect(model).notTo(beNil());
+	});
+
+	it(@"should return itself from -copy", ^{
+		expect([model copy]).to(beIdenticalTo(model));
+	});
+
+	it(@"should return itself if no value changed", ^{
+		expect([model modelByUpdatingValues:@{ @"name": @"foo", @"count": @3 } error:NULL]).to(beIdenticalTo(model));
+		expect([model modelBySettingValue:@"child" forKeyPath:@"child.name" error:NULL]).to(beIdenticalTo(model));
+	});
+
+	it(@"should validate updated values", ^{
+		NSError *error = nil;
+		MTLImmutableTestModel *updatedModel = [model modelByUpdatingValues:@{ @"name": @"this name is too long" } error:&error];
+		expect(updatedModel).to(beNil());
+
+		expect(error.domain).to(equal(MTLTestModelErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLTestModelNameTooLong)));
+	});
+
+	it(@"should not validate values which are not updated", ^{
+		[model setValue:@"this name is too long" forKey:@"name"];
+
+		NSError *error = nil;
+		MTLImmutableTestModel *updatedModel = [model modelByUpdatingValues:@{ @"count": @4 } error:&error];
+		expect(updatedModel).notTo(beNil());
+		expect(error).to(beNil());
+
+		expect(updatedModel.name).to(equal(@"this name is too long"));
+		expect(@(updatedModel.count)).to(equal(@4));
+	});
+
+	describe(@"-modelBySettingValue:forKeyPath:error:", ^{
+		it(@"should set a property of the receiver", ^{
+			MTLImmutableTestModel *updatedModel = [model modelBySettingValue:@2.5 forKeyPath:@"ratio" error:NULL];
+
+			expect(@(updatedModel.ratio)).to(equal(@2.5));
+			expect(updatedModel.child).to(beIdenticalTo(model.child));
+			expect(updatedModel.children).to(beIdenticalTo(model.children));
+		});
+
+		it(@"should copy nested models along the key path", ^{
+			MTLImmutableTestModel *updatedModel = [model modelBySettingValue:@"bar" forKeyPath:@"child.name" error:NULL];
+
+			expect(updatedModel).notTo(beIdenticalTo(model));
+			expect(updatedModel.child).notTo(beIdenticalTo(model.child));
+			expect(updatedModel.child.name).to(equal(@"bar"));
+			expect(updatedModel.children).to(beIdenticalTo(model.children));
+
+			expect(model.child.name).to(equal(@"child"));
+		});
+
+		it(@"should copy arrays along the key path", ^{
+			MTLImmutableTestModel *updatedModel = [model modelBySettingValue:@"bar" forKeyPath:@"children.0.child.name" error:NULL];
+
+			MTLImmutableTestModel *element = updatedModel.children[0];
+			MTLImmutableTestModel *originalElement = model.children[0];
+
+			expect(element.child.name).to(equal(@"bar"));
+			expect(element.name).to(equal(@"element"));
+			expect(originalElement.child.name).to(equal(@"child"));
+
+			expect(updatedModel.children[1]).to(beIdenticalTo(model.children[1]));
+			expect(updatedModel.child).to(beIdenticalTo(model.child));
+		});
+
+		it(@"should set nil values", ^{
+			MTLImmutableTestModel *updatedModel = [model modelBySettingValue:nil forKeyPath:@"child.name" error:NULL];
+			expect(updatedModel).notTo(beNil());
+			expect(updatedModel.child.name).to(beNil());
+		});
+
+		it(@"should validate the updated value", ^{
+			NSError *error = nil;
+			MTLImmutableTestModel *updatedModel = [model modelBySettingValue:@"this name is too long" forKeyPath:@"children.1.name" error:&error];
+			expect(updatedModel).to(beNil());
+
+			expect(@(error.code)).to(equal(@(MTLTestModelNameTooLong)));
+		});
+
+		it(@"should fail for unknown keys", ^{
+			NSError *error = nil;
+			expect([model modelBySettingValue:@"bar" forKeyPath:@"child.foobar" error:&error]).to(beNil());
+
+			expect(error.domain).to(equal(MTLModelUpdatingErrorDomain));
+			expect(@(error.code)).to(equal(@(MTLModelUpdatingErrorUnknownKey)));
+			expect(error.userInfo[MTLModelUpdatingKeyPathErrorKey]).to(equal(@"child.foobar"));
+		});
+
+		it(@"should fail for indexes out of bounds", ^{
+			NSError *error = nil;
+			expect([model modelBySettingValue:@"bar" forKeyPath:@"children.2.name" error:&error]).to(beNil());
+
+			expect(error.domain).to(equal(MTLModelUpdatingErrorDomain));
+			expect(@(error.code)).to(equal(@(MTLModelUpdatingErrorInvalidKeyPath)));
+		});
+
+		it(@"should fail for key paths through other values", ^{
+			NSError *error = nil;
+			expect([model modelBySettingValue:@"bar" forKeyPath:@"name.length" error:&error]).to(beNil());
+			expect(@(error.code)).to(equal(@(MTLModelUpdatingErrorInvalidKeyPath)));
+
+			expect([model modelBySettingValue:@"bar" forKeyPath:@"children.1.child.name" error:&error]).to(beNil());
+			expect(@(error.code)).to(equal(@(MTLModelUpdatingErrorInvalidKeyPath)));
+		});
+	});
+});
+
+QuickSpecEnd
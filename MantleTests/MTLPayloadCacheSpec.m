@@ -0,0 +1,190 @@
+//
+//  MTLPayloadCacheSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLPayloadCacheSpec)
+
+__block MTLPayloadCache *cache;
+__block NSUInteger decodeCount;
+
+beforeEach(^{
+	cache = [[MTLPayloadCache alloc] initWithTotalByteLimit:16];
+	decodeCount = 0;
+});
+
+id (^decodeObject)(id) = ^(id object) {
+	return ^{
+		decodeCount++;
+		return object;
+	};
+};
+
+it(@"should return the cached object for identical payloads", ^{
+	NSData *payload = [@"payload" dataUsingEncoding:NSUTF8StringEncoding];
+	NSData *samePayload = [payload mutableCopy];
+
+	id first = [cache objectForPayload:payload modelClass:MTLTestModel.class decodingWithBlock:decodeObject(@"first")];
+	id second = [cache objectForPayload:samePayload modelClass:MTLTestModel.class decodingWithBlock:decodeObject(@"second")];
+
+	expect(first).to(equal(@"first"));
+	expect(second).to(beIdenticalTo(first));
+	expect(@(decodeCount)).to(equal(@1));
+	expect(@(cache.hitCount)).to(equal(@1));
+	expect(@(cache.missCount)).to(equal(@1));
+	expect(@(cache.totalBytes)).to(beGreaterThan(@0));
+});
+
+it(@"should key entries by configuration", ^{
+	NSData *payload = [@"payload" dataUsingEncoding:NSUTF8StringEncoding];
+
+	id first = [cache objectForPayload:payload modelClass:MTLTestModel.class configuration:@[ @"a" ] decodingWithBlock:decodeObject(@"first")];
+	id other = [cache objectForPayload:payload modelClass:MTLTestModel.class configuration:@[ @"b" ] decodingWithBlock:decodeObject(@"second")];
+	id same = [cache objectForPayload:payload modelClass:MTLTestModel.class configuration:@[ @"a" ] decodingWithBlock:decodeObject(@"third")];
+
+	expect(other).to(equal(@"second"));
+	expect(same).to(beIdenticalTo(first));
+	expect(@(decodeCount)).to(equal(@2));
+});
+
+it(@"should not retain payloads", ^{
+	__weak NSData *weakPayload = nil;
+
+	@autoreleasepool {
+		NSData *payload = [[@"payload" dataUsingEncoding:NSUTF8StringEncoding] mutableCopy];
+		weakPayload = payload;
+
+		[cache objectForPayload:payload modelClass:MTLTestModel.class decodingWithBlock:decodeObject(@"first")];
+	}
+
+	expect(weakPayload).to(beNil());
+	expect(@(cache.count)).to(equal(@1));
+});
+
+it(@"should key entries by model class", ^{
+	NSData *payload = [@"payload" dataUsingEncoding:NSUTF8StringEncoding];
+
+	[cache objectForPayload:payload modelClass:MTLTestModel.class decodingWithBlock:decodeObject(@"first")];
+	id other = [cache objectForPayload:payload modelClass:MTLEmptyTestModel.class decodingWithBlock:decodeObject(@"second")];
+
+	expect(other).to(equal(@"second"));
+	expect(@(decodeCount)).to(equal(@2));
+});
+
+it(@"should not cache failures", ^{
+	NSData *payload = [@"payload" dataUsingEncoding:NSUTF8StringEncoding];
+
+	expect([cache objectForPayload:payload modelClass:MTLTestModel.class decodingWithBlock:decodeObject(nil)]).to(beNil());
+	expect([cache objectForPayload:payload modelClass:MTLTestModel.class decodingWithBlock:decodeObject(@"second")]).to(equal(@"second"));
+	expect(@(cache.count)).to(equal(@1));
+});
+
+it(@"should evict the least recently used objects beyond its byte limit", ^{
+	cache = [[MTLPayloadCache alloc] initWithTotalByteLimit:1024];
+
+	NSData *first = [@"1" dataUsingEncoding:NSUTF8StringEncoding];
+	NSData *second = [@"2" dataUsingEncoding:NSUTF8StringEncoding];
+	NSData *third = [@"3" dataUsingEncoding:NSUTF8StringEncoding];
+
+	// The decoded objects are far larger than their payloads.
+	id (^decodeLargeObject)(void) = ^{
+		decodeCount++;
+		return [NSMutableData dataWithLength:400];
+	};
+
+	[cache objectForPayload:first modelClass:MTLTestModel.class decodingWithBlock:decodeLargeObject];
+	[cache objectForPayload:second modelClass:MTLTestModel.class decodingWithBlock:decodeLargeObject];
+	[cache objectForPayload:first modelClass:MTLTestModel.class decodingWithBlock:decodeLargeObject];
+	[cache objectForPayload:third modelClass:MTLTestModel.class decodingWithBlock:decodeLargeObject];
+
+	expect(@(cache.count)).to(equal(@2));
+	expect(@(cache.totalBytes)).to(beGreaterThanOrEqualTo(@800));
+	expect(@(cache.totalBytes)).to(beLessThanOrEqualTo(@1024));
+	expect(@(decodeCount)).to(equal(@3));
+
+	[cache objectForPayload:second modelClass:MTLTestModel.class decodingWithBlock:decodeLargeObject];
+	expect(@(decodeCount)).to(equal(@4));
+});
+
+it(@"should not cache objects larger than its byte limit", ^{
+	NSData *payload = [@"payload" dataUsingEncoding:NSUTF8StringEncoding];
+
+	NSData *object = [cache objectForPayload:payload modelClass:MTLTestModel.class decodingWithBlock:decodeObject([NSMutableData dataWithLength:64])];
+	expect(@(object.length)).to(equal(@64));
+	expect(@(cache.count)).to(equal(@0));
+});
+
+it(@"should remove all objects", ^{
+	NSData *payload = [@"payload" dataUsingEncoding:NSUTF8StringEncoding];
+	[cache objectForPayload:payload modelClass:MTLTestModel.class decodingWithBlock:decodeObject(@1)];
+	[cache removeAllObjects];
+
+	expect(@(cache.count)).to(equal(@0));
+	expect(@(cache.totalBytes)).to(equal(@0));
+});
+
+describe(@"MTLJSONAdapter", ^{
+	NSData *data = [@"{\"username\": \"foo\", \"count\": \"5\"}" dataUsingEncoding:NSUTF8StringEncoding];
+
+	it(@"should decode models from JSON data", ^{
+		NSError *error = nil;
+		MTLTestModel *model = [MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONData:data error:&error];
+		expect(error).to(beNil());
+		expect(model.name).to(equal(@"foo"));
+		expect(@(model.count)).to(equal(@5));
+	});
+
+	it(@"should return cached models for identical JSON data", ^{
+		cache = [[MTLPayloadCache alloc] initWithTotalByteLimit:1024 * 1024];
+
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+		adapter.payloadCache = cache;
+
+		MTLTestModel *first = [adapter modelFromJSONData:data error:NULL];
+		MTLTestModel *second = [adapter modelFromJSONData:[data mutableCopy] error:NULL];
+
+		expect(first).notTo(beNil());
+		expect(second).to(beIdenticalTo(first));
+		expect(@(cache.hitCount)).to(equal(@1));
+	});
+
+	it(@"should not share models between adapters with different uniquing contexts", ^{
+		cache = [[MTLPayloadCache alloc] initWithTotalByteLimit:1024 * 1024];
+
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+		adapter.payloadCache = cache;
+
+		MTLJSONAdapter *uniquingAdapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+		uniquingAdapter.payloadCache = cache;
+		uniquingAdapter.uniquingContext = [[MTLUniquingContext alloc] init];
+
+		MTLTestModel *first = [adapter modelFromJSONData:data error:NULL];
+		MTLTestModel *second = [uniquingAdapter modelFromJSONData:data error:NULL];
+
+		expect(second).to(equal(first));
+		expect(second).notTo(beIdenticalTo(first));
+		expect(@(cache.count)).to(equal(@2));
+	});
+
+	it(@"should return an error for invalid JSON data", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+		adapter.payloadCache = cache;
+
+		NSError *error = nil;
+		MTLTestModel *model = [adapter modelFromJSONData:[@"{" dataUsingEncoding:NSUTF8StringEncoding] error:&error];
+		expect(model).to(beNil());
+		expect(error).notTo(beNil());
+		expect(@(cache.count)).to(equal(@0));
+	});
+});
+
+QuickSpecEnd
@@ -118,6 +118,77 @@ describe(@"The number transformer", ^{
 	});
 });
 
+describe(@"The data encoding transformers", ^{
+	// Bytes which need every character of the alphabets.
+	NSMutableData *data = [NSMutableData data];
+	for (NSUInteger i = 0; i < 256; i++) {
+		uint8_t byte = (uint8_t)(255 - i);
+		[data appendBytes:&byte length:1];
+	}
+
+	it(@"should convert standard base64 strings to data and back", ^{
+		NSValueTransformer *transformer = [NSValueTransformer valueTransformerForName:MTLBase64ValueTransformerName];
+		expect(@([transformer.class allowsReverseTransformation])).to(beTruthy());
+
+		NSString *string = [data base64EncodedStringWithOptions:0];
+		expect([transformer transformedValue:string]).to(equal(data));
+		expect([transformer reverseTransformedValue:data]).to(equal(string));
+
+		NSData *shortData = [@"Mantle" dataUsingEncoding:NSUTF8StringEncoding];
+		for (NSUInteger length = 0; length <= shortData.length; length++) {
+			NSData *prefix = [shortData subdataWithRange:NSMakeRange(0, length)];
+			NSString *prefixString = [prefix base64EncodedStringWithOptions:0];
+
+			expect([transformer reverseTransformedValue:prefix]).to(equal(prefixString));
+			expect([transformer transformedValue:prefixString]).to(equal(prefix));
+		}
+	});
+
+	it(@"should convert base64url strings to data and back", ^{
+		NSValueTransformer *transformer = [NSValueTransformer valueTransformerForName:MTLBase64URLValueTransformerName];
+
+		NSString *string = [[[[data base64EncodedStringWithOptions:0]
+			stringByReplacingOccurrencesOfString:@"+" withString:@"-"]
+			stringByReplacingOccurrencesOfString:@"/" withString:@"_"]
+			stringByReplacingOccurrencesOfString:@"=" withString:@""];
+
+		expect([transformer transformedValue:string]).to(equal(data));
+		expect([transformer transformedValue:[string stringByAppendingString:@"=="]]).to(equal(data));
+		expect([transformer reverseTransformedValue:data]).to(equal(string));
+	});
+
+	it(@"should convert hexadecimal strings to data and back", ^{
+		NSValueTransformer *transformer = [NSValueTransformer valueTransformerForName:MTLHexValueTransformerName];
+
+		uint8_t bytes[] = { 0x00, 0x7f, 0xab, 0xff };
+		NSData *hexData = [NSData dataWithBytes:bytes length:sizeof(bytes)];
+
+		expect([transformer transformedValue:@"007fabff"]).to(equal(hexData));
+		expect([transformer transformedValue:@"007FABFF"]).to(equal(hexData));
+		expect([transformer reverseTransformedValue:hexData]).to(equal(@"007fabff"));
+		expect([transformer reverseTransformedValue:NSData.data]).to(equal(@""));
+	});
+
+	it(@"should reject malformed strings", ^{
+		NSValueTransformer *base64Transformer = [NSValueTransformer valueTransformerForName:MTLBase64ValueTransformerName];
+		expect([base64Transformer transformedValue:@"TWFudGxl\n"]).to(beNil());
+		expect([base64Transformer transformedValue:@"TWFudGx"]).to(beNil());
+		expect([base64Transformer transformedValue:@"TWFudGxl\u00e9AAA"]).to(beNil());
+
+		NSValueTransformer *hexTransformer = [NSValueTransformer valueTransformerForName:MTLHexValueTransformerName];
+		expect([hexTransformer transformedValue:@"abc"]).to(beNil());
+		expect([hexTransformer transformedValue:@"zz"]).to(beNil());
+	});
+
+	itBehavesLike(MTLTransformerErrorExamples, ^{
+		return @{
+			MTLTransformerErrorExamplesTransformer: [NSValueTransformer valueTransformerForName:MTLBase64ValueTransformerName],
+			MTLTransformerErrorExamplesInvalidTransformationInput: @"not valid base64!",
+			MTLTransformerErrorExamplesInvalidReverseTransformationInput: @"not data"
+		};
+	});
+});
+
 describe(@"+mtl_arrayMappingTransformerWithTransformer:", ^{
 	__block NSValueTransformer *transformer;
 
@@ -150,6 +221,57 @@ describe(@"+mtl_arrayMappingTransformerWithTransformer:", ^{
 		it(@"should apply the transformer to each element in reverse", ^{
 			expect([transformer reverseTransformedValue:URLs]).to(equal(URLStrings));
 		});
+
+		it(@"should keep NSNull elements", ^{
+			NSArray *values = @[ URLStrings[0], NSNull.null, URLStrings[1] ];
+
+			expect([transformer transformedValue:values]).to(equal(@[ URLs[0], NSNull.null, URLs[1] ]));
+		});
+
+		it(@"should report the index of an element which could not be transformed", ^{
+			NSArray *values = @[ NSNull.null, URLStrings[0], NSNull.null, @5 ];
+
+			BOOL success = YES;
+			NSError *error = nil;
+			expect([(id<MTLTransformerErrorHandling>)transformer transformedValue:values success:&success error:&error]).to(beNil());
+			expect(@(success)).to(beFalsy());
+			expect(error.userInfo[MTLTransformerErrorHandlingIndexErrorKey]).to(equal(@3));
+			expect(error.userInfo[MTLTransformerErrorHandlingInputValueErrorKey]).to(equal(values));
+		});
+	});
+
+	describe(@"when called with a transformer without batch support", ^{
+		beforeEach(^{
+			NSValueTransformer *appliedTransformer = [MTLMemoizingValueTransformer transformerWithTransformer:[NSValueTransformer valueTransformerForName:MTLURLValueTransformerName] countLimit:10 memoizesReverseTransformations:YES];
+			expect(@([appliedTransformer conformsToProtocol:@protocol(MTLTransformerBatchHandling)])).to(beFalsy());
+
+			transformer = [NSValueTransformer mtl_arrayMappingTransformerWithTransformer:appliedTransformer];
+			expect(transformer).notTo(beNil());
+		});
+
+		it(@"should apply the transformer to each element", ^{
+			expect([transformer transformedValue:URLStrings]).to(equal(URLs));
+			expect([transformer reverseTransformedValue:URLs]).to(equal(URLStrings));
+		});
+	});
+
+	it(@"should map NSNull and nil results the same with or without batch support", ^{
+		MTLValueTransformerBlock block = ^ id (NSString *str, BOOL *success, NSError **error) {
+			if ([str isEqual:@"null"]) return NSNull.null;
+			if ([str isEqual:@"nil"]) return nil;
+
+			return [str stringByAppendingString:@"bar"];
+		};
+
+		NSValueTransformer *batchingTransformer = [MTLValueTransformer transformerUsingForwardBlock:block];
+		NSValueTransformer *elementTransformer = [MTLMemoizingValueTransformer transformerWithTransformer:batchingTransformer countLimit:10 memoizesReverseTransformations:NO];
+		expect(@([elementTransformer conformsToProtocol:@protocol(MTLTransformerBatchHandling)])).to(beFalsy());
+
+		NSArray *values = @[ @"foo", @"null", NSNull.null, @"nil", @"baz" ];
+		NSArray *expected = @[ @"foobar", NSNull.null, NSNull.null, @"bazbar" ];
+
+		expect([[NSValueTransformer mtl_arrayMappingTransformerWithTransformer:batchingTransformer] transformedValue:values]).to(equal(expected));
+		expect([[NSValueTransformer mtl_arrayMappingTransformerWithTransformer:elementTransformer] transformedValue:values]).to(equal(expected));
 	});
 
 	describe(@"when called with a non-reversible transformer", ^{
@@ -179,6 +301,98 @@ describe(@"+mtl_arrayMappingTransformerWithTransformer:", ^{
 	});
 });
 
+describe(@"+mtl_packedNumberArrayTransformerWithType:", ^{
+	it(@"should pack doubles and unpack them again", ^{
+		NSValueTransformer *transformer = [NSValueTransformer mtl_packedNumberArrayTransformerWithType:MTLPackedNumberTypeDouble];
+		expect(@([transformer.class allowsReverseTransformation])).to(beTruthy());
+
+		NSArray *numbers = @[ @1.5, @-2, @1e10 ];
+		double expected[] = { 1.5, -2, 1e10 };
+
+		NSData *data = [transformer transformedValue:numbers];
+		expect(data).to(equal([NSData dataWithBytes:expected length:sizeof(expected)]));
+		expect([transformer reverseTransformedValue:data]).to(equal(numbers));
+	});
+
+	it(@"should pack more numbers than fit into a single batch", ^{
+		NSValueTransformer *transformer = [NSValueTransformer mtl_packedNumberArrayTransformerWithType:MTLPackedNumberTypeInt32];
+
+		NSMutableArray *numbers = [NSMutableArray array];
+		for (int32_t i = 0; i < 1000; i++) {
+			[numbers addObject:@(i * 3)];
+		}
+
+		NSData *data = [transformer transformedValue:numbers];
+		expect(@(data.length)).to(equal(@(1000 * sizeof(int32_t))));
+		expect(@(((const int32_t *)data.bytes)[999])).to(equal(@2997));
+		expect([transformer reverseTransformedValue:data]).to(equal(numbers));
+	});
+
+	it(@"should convert numbers to the element type", ^{
+		NSValueTransformer *transformer = [NSValueTransformer mtl_packedNumberArrayTransformerWithType:MTLPackedNumberTypeInt64];
+
+		NSData *data = [transformer transformedValue:@[ @2.0, @(INT64_MAX) ]];
+		int64_t expected[] = { 2, INT64_MAX };
+		expect(data).to(equal([NSData dataWithBytes:expected length:sizeof(expected)]));
+
+		transformer = [NSValueTransformer mtl_packedNumberArrayTransformerWithType:MTLPackedNumberTypeFloat];
+		expect([transformer reverseTransformedValue:[transformer transformedValue:@[ @0.5, @4 ]]]).to(equal(@[ @0.5f, @4.0f ]));
+	});
+
+	it(@"should report the index of an element which is not a number", ^{
+		NSValueTransformer<MTLTransformerErrorHandling> *transformer = [NSValueTransformer mtl_packedNumberArrayTransformerWithType:MTLPackedNumberTypeDouble];
+
+		BOOL success = YES;
+		NSError *error = nil;
+		expect([transformer transformedValue:@[ @1, @2, @"3" ] success:&success error:&error]).to(beNil());
+		expect(@(success)).to(beFalsy());
+		expect(error.domain).to(equal(MTLTransformerErrorHandlingErrorDomain));
+		expect(error.userInfo[MTLTransformerErrorHandlingIndexErrorKey]).to(equal(@2));
+	});
+
+	it(@"should report the index of an element which the element type cannot hold", ^{
+		NSArray *invalidElementsByType = @[
+			@[ @(MTLPackedNumberTypeInt32), @2.75 ],
+			@[ @(MTLPackedNumberTypeInt32), @((int64_t)INT32_MAX + 1) ],
+			@[ @(MTLPackedNumberTypeInt32), @(INT32_MIN - 1.0) ],
+			@[ @(MTLPackedNumberTypeInt64), @-0.5 ],
+			@[ @(MTLPackedNumberTypeInt64), @(UINT64_MAX) ],
+			@[ @(MTLPackedNumberTypeInt64), @1e19 ],
+			@[ @(MTLPackedNumberTypeInt64), @(NAN) ],
+			@[ @(MTLPackedNumberTypeFloat), @1e300 ],
+		];
+
+		for (NSArray *typeAndElement in invalidElementsByType) {
+			NSValueTransformer<MTLTransformerErrorHandling> *transformer = [NSValueTransformer mtl_packedNumberArrayTransformerWithType:[typeAndElement[0] unsignedIntegerValue]];
+
+			BOOL success = YES;
+			NSError *error = nil;
+			expect([transformer transformedValue:@[ @1, typeAndElement[1] ] success:&success error:&error]).to(beNil());
+			expect(@(success)).to(beFalsy());
+			expect(error.userInfo[MTLTransformerErrorHandlingIndexErrorKey]).to(equal(@1));
+		}
+	});
+
+	it(@"should reject data of an invalid length", ^{
+		NSValueTransformer<MTLTransformerErrorHandling> *transformer = [NSValueTransformer mtl_packedNumberArrayTransformerWithType:MTLPackedNumberTypeInt32];
+
+		BOOL success = YES;
+		NSError *error = nil;
+		NSData *data = [NSData dataWithBytes:"abcde" length:5];
+		expect([transformer reverseTransformedValue:data success:&success error:&error]).to(beNil());
+		expect(@(success)).to(beFalsy());
+		expect(error.userInfo[MTLTransformerErrorHandlingInputValueErrorKey]).to(equal(data));
+	});
+
+	itBehavesLike(MTLTransformerErrorExamples, ^{
+		return @{
+			MTLTransformerErrorExamplesTransformer: [NSValueTransformer mtl_packedNumberArrayTransformerWithType:MTLPackedNumberTypeDouble],
+			MTLTransformerErrorExamplesInvalidTransformationInput: NSNull.null,
+			MTLTransformerErrorExamplesInvalidReverseTransformationInput: NSNull.null
+		};
+	});
+});
+
 describe(@"value mapping transformer", ^{
 	__block NSValueTransformer *transformer;
 
@@ -0,0 +1,108 @@
+//
+//  MTLReconciliationSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLReconciliationSpec)
+
+__block MTLIdentityTestModel *first;
+__block MTLIdentityTestModel *second;
+__block MTLIdentityTestModel *third;
+
+beforeEach(^{
+	first = [MTLIdentityTestModel modelWithIdentifier:1 name:@"one"];
+	second = [MTLIdentityTestModel modelWithIdentifier:2 name:@"two"];
+	third = [MTLIdentityTestModel modelWithIdentifier:3 name:@"three"];
+});
+
+it(@"should report inserted, updated and removed models", ^{
+	MTLIdentityTestModel *changedSecond = [MTLIdentityTestModel modelWithIdentifier:2 name:@"deux"];
+	MTLIdentityTestModel *unchangedThird = [MTLIdentityTestModel modelWithIdentifier:3 name:@"three"];
+	MTLIdentityTestModel *fourth = [MTLIdentityTestModel modelWithIdentifier:4 name:@"four"];
+
+	MTLReconciliation *reconciliation = [MTLReconciliation reconciliationWithExistingModels:@[ first, second, third ] incomingModels:@[ fourth, unchangedThird, changedSecond ]];
+
+	expect(reconciliation.insertedModels).to(equal(@[ fourth ]));
+	expect(@(reconciliation.updatedModels.count)).to(equal(@1));
+	expect(reconciliation.updatedModels.firstObject).to(beIdenticalTo(second));
+	expect(@(reconciliation.removedModels.count)).to(equal(@1));
+	expect(reconciliation.removedModels.firstObject).to(beIdenticalTo(first));
+});
+
+it(@"should update existing instances in place", ^{
+	MTLIdentityTestModel *changedSecond = [MTLIdentityTestModel modelWithIdentifier:2 name:@"deux"];
+
+	MTLReconciliation *reconciliation = [MTLReconciliation reconciliationWithExistingModels:@[ first, second ] incomingModels:@[ changedSecond, first ]];
+
+	expect(second.name).to(equal(@"deux"));
+	expect(reconciliation.models[0]).to(beIdenticalTo(second));
+	expect(reconciliation.models[1]).to(beIdenticalTo(first));
+	expect(reconciliation.updatedModels).to(equal(@[ second ]));
+	expect(reconciliation.insertedModels).to(equal(@[]));
+	expect(reconciliation.removedModels).to(equal(@[]));
+});
+
+it(@"should keep the existing instances of unchanged models", ^{
+	MTLIdentityTestModel *unchangedFirst = [first copy];
+
+	MTLReconciliation *reconciliation = [MTLReconciliation reconciliationWithExistingModels:@[ first ] incomingModels:@[ unchangedFirst ]];
+
+	expect(reconciliation.models.firstObject).to(beIdenticalTo(first));
+	expect(reconciliation.updatedModels).to(equal(@[]));
+});
+
+it(@"should handle empty collections", ^{
+	MTLReconciliation *reconciliation = [MTLReconciliation reconciliationWithExistingModels:@[] incomingModels:@[ first ]];
+	expect(reconciliation.insertedModels).to(equal(@[ first ]));
+
+	reconciliation = [MTLReconciliation reconciliationWithExistingModels:@[ first ] incomingModels:@[]];
+	expect(reconciliation.removedModels).to(equal(@[ first ]));
+	expect(reconciliation.models).to(equal(@[]));
+});
+
+it(@"should match composite identities", ^{
+	MTLCompositeIdentityTestModel *existing = [[MTLCompositeIdentityTestModel alloc] init];
+	existing.domain = @"net";
+	existing.code = 1;
+	existing.message = @"old";
+
+	MTLCompositeIdentityTestModel *sameDomain = [existing copy];
+	sameDomain.code = 2;
+
+	MTLCompositeIdentityTestModel *incoming = [existing copy];
+	incoming.message = @"new";
+
+	MTLReconciliation *reconciliation = [MTLReconciliation reconciliationWithExistingModels:@[ existing ] incomingModels:@[ sameDomain, incoming ]];
+
+	expect(reconciliation.insertedModels).to(equal(@[ sameDomain ]));
+	expect(reconciliation.updatedModels.firstObject).to(beIdenticalTo(existing));
+	expect(existing.message).to(equal(@"new"));
+});
+
+it(@"should reconcile large collections", ^{
+	NSMutableArray *existingModels = [NSMutableArray array];
+	NSMutableArray *incomingModels = [NSMutableArray array];
+
+	for (NSUInteger identifier = 0; identifier < 10000; identifier++) {
+		[existingModels addObject:[MTLIdentityTestModel modelWithIdentifier:identifier name:@"old"]];
+		[incomingModels addObject:[MTLIdentityTestModel modelWithIdentifier:identifier + 5000 name:@"new"]];
+	}
+
+	MTLReconciliation *reconciliation = [MTLReconciliation reconciliationWithExistingModels:existingModels incomingModels:incomingModels];
+
+	expect(@(reconciliation.insertedModels.count)).to(equal(@5000));
+	expect(@(reconciliation.removedModels.count)).to(equal(@5000));
+	expect(@(reconciliation.updatedModels.count)).to(equal(@5000));
+	expect(@(reconciliation.models.count)).to(equal(@10000));
+});
+
+QuickSpecEnd
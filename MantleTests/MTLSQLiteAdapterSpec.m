@@ -0,0 +1,235 @@
+//
+//  MTLSQLiteAdapterSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLSQLiteAdapterSpec)
+
+__block MTLSQLiteAdapter *adapter;
+__block MTLSQLiteTestModel *model;
+
+beforeEach(^{
+	NSError *error = nil;
+	adapter = [[MTLSQLiteAdapter alloc] initWithURL:nil error:&error];
+	expect(adapter).notTo(beNil());
+	expect(error).to(beNil());
+
+	BOOL success = [adapter createTableForModelClass:MTLSQLiteTestModel.class error:&error];
+	expect(@(success)).to(beTruthy());
+	expect(error).to(beNil());
+
+	model = [[MTLSQLiteTestModel alloc] init];
+	model.identifier = 1;
+	model.enabled = YES;
+	model.score = 2.5;
+	model.name = @"héllo";
+	model.URL = [NSURL URLWithString:@"http://github.com"];
+	model.data = [@"bytes" dataUsingEncoding:NSUTF8StringEncoding];
+	model.date = [NSDate dateWithTimeIntervalSince1970:1000.5];
+	model.tags = @[ @"a", @"b" ];
+	model.payload = @"payload";
+	model.note = @"not stored";
+});
+
+it(@"should round trip models", ^{
+	NSError *error = nil;
+	BOOL success = [adapter insertModels:@[ model ] error:&error];
+	expect(@(success)).to(beTruthy());
+	expect(error).to(beNil());
+
+	NSArray *models = [adapter modelsOfClass:MTLSQLiteTestModel.class where:nil arguments:nil error:&error];
+	expect(error).to(beNil());
+	expect(@(models.count)).to(equal(@1));
+
+	MTLSQLiteTestModel *loaded = models.firstObject;
+	expect(@(loaded.identifier)).to(equal(@1));
+	expect(@(loaded.enabled)).to(beTruthy());
+	expect(@(loaded.score)).to(equal(@2.5));
+	expect(loaded.name).to(equal(@"héllo"));
+	expect(loaded.URL).to(equal(model.URL));
+	expect(loaded.data).to(equal(model.data));
+	expect(loaded.date).to(equal(model.date));
+	expect(loaded.tags).to(equal(model.tags));
+	expect(loaded.payload).to(equal(@"payload"));
+	expect(loaded.note).to(beNil());
+});
+
+it(@"should leave properties of NULL columns unset", ^{
+	MTLSQLiteTestModel *empty = [[MTLSQLiteTestModel alloc] init];
+	empty.identifier = 2;
+
+	expect(@([adapter insertModels:@[ empty ] error:NULL])).to(beTruthy());
+
+	MTLSQLiteTestModel *loaded = [adapter modelsOfClass:MTLSQLiteTestModel.class where:nil arguments:nil error:NULL].firstObject;
+	expect(loaded).to(equal(empty));
+});
+
+it(@"should filter models with arguments", ^{
+	MTLSQLiteTestModel *other = [model copy];
+	other.identifier = 2;
+	other.score = 10;
+
+	expect(@([adapter insertModels:@[ model, other ] error:NULL])).to(beTruthy());
+
+	NSArray *models = [adapter modelsOfClass:MTLSQLiteTestModel.class where:@"score > ? ORDER BY id" arguments:@[ @5 ] error:NULL];
+	expect([models valueForKey:@"identifier"]).to(equal(@[ @2 ]));
+
+	// The cached statement should be reset and rebound.
+	models = [adapter modelsOfClass:MTLSQLiteTestModel.class where:@"score > ? ORDER BY id" arguments:@[ @0 ] error:NULL];
+	expect([models valueForKey:@"identifier"]).to(equal(@[ @1, @2 ]));
+});
+
+it(@"should fail to insert a duplicate primary key", ^{
+	expect(@([adapter insertModels:@[ model ] error:NULL])).to(beTruthy());
+
+	NSError *error = nil;
+	BOOL success = [adapter insertModels:@[ model ] error:&error];
+	expect(@(success)).to(beFalsy());
+	expect(error.domain).to(equal(MTLSQLiteAdapterErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLSQLiteAdapterErrorSQLite)));
+	expect(error.userInfo[MTLSQLiteAdapterResultCodeErrorKey]).notTo(beNil());
+});
+
+it(@"should update models with the same primary key when saving", ^{
+	expect(@([adapter insertModels:@[ model ] error:NULL])).to(beTruthy());
+
+	model.name = @"changed";
+	expect(@([adapter saveModels:@[ model ] error:NULL])).to(beTruthy());
+
+	NSArray *models = [adapter modelsOfClass:MTLSQLiteTestModel.class where:nil arguments:nil error:NULL];
+	expect([models valueForKey:@"name"]).to(equal(@[ @"changed" ]));
+});
+
+it(@"should insert new models when saving", ^{
+	MTLSQLiteTestModel *other = [model copy];
+	other.identifier = 2;
+
+	expect(@([adapter insertModels:@[ model ] error:NULL])).to(beTruthy());
+	expect(@([adapter saveModels:@[ model, other ] error:NULL])).to(beTruthy());
+
+	NSArray *models = [adapter modelsOfClass:MTLSQLiteTestModel.class where:@"1 ORDER BY id" arguments:nil error:NULL];
+	expect([models valueForKey:@"identifier"]).to(equal(@[ @1, @2 ]));
+});
+
+it(@"should keep the rowid and unmapped columns of saved rows", ^{
+	expect(@([adapter executeSQL:@"ALTER TABLE sqlite_test_models ADD COLUMN extra TEXT" error:NULL])).to(beTruthy());
+	expect(@([adapter insertModels:@[ model ] error:NULL])).to(beTruthy());
+	expect(@([adapter executeSQL:@"UPDATE sqlite_test_models SET extra = 'kept', rowid = 42" error:NULL])).to(beTruthy());
+
+	model.name = @"changed";
+	expect(@([adapter saveModels:@[ model ] error:NULL])).to(beTruthy());
+
+	NSArray *models = [adapter modelsOfClass:MTLSQLiteTestModel.class where:@"extra = 'kept' AND rowid = 42" arguments:nil error:NULL];
+	expect([models valueForKey:@"name"]).to(equal(@[ @"changed" ]));
+});
+
+it(@"should fail to store unsigned values greater than INT64_MAX", ^{
+	model.payload = @(ULLONG_MAX);
+
+	NSError *error = nil;
+	BOOL success = [adapter insertModels:@[ model ] error:&error];
+	expect(@(success)).to(beFalsy());
+	expect(error.domain).to(equal(MTLSQLiteAdapterErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLSQLiteAdapterErrorUnsupportedValue)));
+
+	model.payload = @((unsigned long long)INT64_MAX);
+	expect(@([adapter insertModels:@[ model ] error:NULL])).to(beTruthy());
+
+	MTLSQLiteTestModel *loaded = [adapter modelsOfClass:MTLSQLiteTestModel.class where:nil arguments:nil error:NULL].firstObject;
+	expect(loaded.payload).to(equal(@(INT64_MAX)));
+});
+
+it(@"should fail to load dates from text", ^{
+	expect(@([adapter insertModels:@[ model ] error:NULL])).to(beTruthy());
+	expect(@([adapter executeSQL:@"UPDATE sqlite_test_models SET date = 'yesterday'" error:NULL])).to(beTruthy());
+
+	NSError *error = nil;
+	NSArray *models = [adapter modelsOfClass:MTLSQLiteTestModel.class where:nil arguments:nil error:&error];
+	expect(models).to(beNil());
+	expect(error.domain).to(equal(MTLSQLiteAdapterErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLSQLiteAdapterErrorUnsupportedValue)));
+});
+
+it(@"should round trip strings containing NUL characters", ^{
+	model.name = [NSString stringWithFormat:@"a%Cb", (unichar)0];
+	expect(@([adapter insertModels:@[ model ] error:NULL])).to(beTruthy());
+
+	MTLSQLiteTestModel *loaded = [adapter modelsOfClass:MTLSQLiteTestModel.class where:nil arguments:nil error:NULL].firstObject;
+	expect(@(loaded.name.length)).to(equal(@3));
+	expect(loaded.name).to(equal(model.name));
+});
+
+it(@"should insert none of the models if one fails", ^{
+	MTLSQLiteTestModel *other = [model copy];
+	other.identifier = 2;
+	other.payload = @[ @"unsupported" ];
+
+	NSError *error = nil;
+	BOOL success = [adapter insertModels:@[ model, other ] error:&error];
+	expect(@(success)).to(beFalsy());
+	expect(error.domain).to(equal(MTLSQLiteAdapterErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLSQLiteAdapterErrorUnsupportedValue)));
+
+	NSArray *models = [adapter modelsOfClass:MTLSQLiteTestModel.class where:nil arguments:nil error:NULL];
+	expect(models).to(equal(@[]));
+});
+
+it(@"should only roll back a failed nested transaction", ^{
+	NSError *error = nil;
+	BOOL success = [adapter performTransaction:^(NSError **error) {
+		if (![adapter insertModels:@[ model ] error:error]) return NO;
+
+		MTLSQLiteTestModel *other = [model copy];
+		other.identifier = 2;
+
+		BOOL innerSuccess = [adapter performTransaction:^(NSError **error) {
+			return [adapter insertModels:@[ other ] error:error] && NO;
+		} error:NULL];
+		expect(@(innerSuccess)).to(beFalsy());
+
+		return YES;
+	} error:&error];
+
+	expect(@(success)).to(beTruthy());
+	expect(error).to(beNil());
+
+	NSArray *models = [adapter modelsOfClass:MTLSQLiteTestModel.class where:nil arguments:nil error:NULL];
+	expect([models valueForKey:@"identifier"]).to(equal(@[ @1 ]));
+});
+
+it(@"should persist models to a file", ^{
+	NSURL *URL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString]];
+
+	MTLSQLiteAdapter *fileAdapter = [[MTLSQLiteAdapter alloc] initWithURL:URL error:NULL];
+	expect(fileAdapter.URL).to(equal(URL));
+	expect(@([fileAdapter createTableForModelClass:MTLSQLiteTestModel.class error:NULL])).to(beTruthy());
+	expect(@([fileAdapter insertModels:@[ model ] error:NULL])).to(beTruthy());
+	fileAdapter = nil;
+
+	fileAdapter = [[MTLSQLiteAdapter alloc] initWithURL:URL error:NULL];
+	NSArray *models = [fileAdapter modelsOfClass:MTLSQLiteTestModel.class where:@"id = ?" arguments:@[ @1 ] error:NULL];
+	expect([models valueForKey:@"name"]).to(equal(@[ @"héllo" ]));
+
+	fileAdapter = nil;
+	[NSFileManager.defaultManager removeItemAtURL:URL error:NULL];
+});
+
+it(@"should fail to load from a missing table", ^{
+	NSError *error = nil;
+	[adapter executeSQL:@"DROP TABLE sqlite_test_models" error:NULL];
+
+	NSArray *models = [adapter modelsOfClass:MTLSQLiteTestModel.class where:nil arguments:nil error:&error];
+	expect(models).to(beNil());
+	expect(@(error.code)).to(equal(@(MTLSQLiteAdapterErrorSQLite)));
+});
+
+QuickSpecEnd
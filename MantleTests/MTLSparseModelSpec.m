@@ -0,0 +1,198 @@
+//
+//  MTLSparseModelSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLSparseModelSpec)
+
+__block MTLSparseTestModel *model;
+
+beforeEach(^{
+	model = [[MTLSparseTestModel alloc] init];
+	model.name = @"foobar";
+	model.count = 5;
+	model.identifier = @"1";
+});
+
+it(@"should store only @dynamic properties sparsely", ^{
+	expect([MTLSparseTestModel sparsePropertyKeys]).to(equal((@[ @"cachedDescription", @"child", @"count", @"flag", @"name", @"ratio", @"title" ])));
+	expect([MTLSparseSubclassTestModel sparsePropertyKeys]).to(equal((@[ @"author", @"cachedDescription", @"child", @"count", @"flag", @"name", @"ratio", @"title" ])));
+});
+
+it(@"should include sparse properties in +propertyKeys", ^{
+	NSSet *expectedKeys = [NSSet setWithObjects:@"cachedDescription", @"child", @"count", @"flag", @"name", @"ratio", @"title", @"identifier", nil];
+	expect([MTLSparseTestModel propertyKeys]).to(equal(expectedKeys));
+});
+
+describe(@"accessors", ^{
+	it(@"should read back the values they were set to", ^{
+		model.ratio = 0.5;
+		model.flag = YES;
+
+		expect(model.name).to(equal(@"foobar"));
+		expect(@(model.count)).to(equal(@5));
+		expect(@(model.ratio)).to(equal(@0.5));
+		expect(@(model.flag)).to(beTruthy());
+		expect(model.child).to(beNil());
+		expect(model.identifier).to(equal(@"1"));
+
+		expect(@(model.populatedSparsePropertyCount)).to(equal(@4));
+	});
+
+	it(@"should copy values of copy properties", ^{
+		NSMutableString *name = [NSMutableString stringWithString:@"foo"];
+		model.name = name;
+		[name appendString:@"bar"];
+
+		expect(model.name).to(equal(@"foo"));
+	});
+
+	it(@"should depopulate properties set to nil or zero", ^{
+		model.name = nil;
+		model.count = 0;
+
+		expect(model.name).to(beNil());
+		expect(@(model.count)).to(equal(@0));
+		expect(@(model.populatedSparsePropertyCount)).to(equal(@0));
+	});
+
+	it(@"should set readonly properties with key-value coding", ^{
+		[model setValue:@"title" forKey:@"title"];
+		[model setValue:@7 forKey:@"count"];
+
+		expect(model.title).to(equal(@"title"));
+		expect([model valueForKey:@"count"]).to(equal(@7));
+	});
+
+	it(@"should store the properties of subclasses after those of the superclass", ^{
+		MTLSparseSubclassTestModel *subclassModel = [[MTLSparseSubclassTestModel alloc] init];
+		subclassModel.name = @"foo";
+		subclassModel.author = @"bar";
+
+		expect(subclassModel.name).to(equal(@"foo"));
+		expect(subclassModel.author).to(equal(@"bar"));
+		expect(@(subclassModel.populatedSparsePropertyCount)).to(equal(@2));
+	});
+});
+
+it(@"should initialize from a dictionary", ^{
+	NSError *error = nil;
+	MTLSparseTestModel *dictionaryModel = [[MTLSparseTestModel alloc] initWithDictionary:@{ @"name": @"foo", @"count": @3, @"child": NSNull.null } error:&error];
+	expect(dictionaryModel).notTo(beNil());
+	expect(error).to(beNil());
+
+	expect(dictionaryModel.name).to(equal(@"foo"));
+	expect(@(dictionaryModel.count)).to(equal(@3));
+	expect(@(dictionaryModel.populatedSparsePropertyCount)).to(equal(@2));
+});
+
+it(@"should include unpopulated properties in its dictionary value", ^{
+	expect(model.dictionaryValue).to(equal((@{
+		@"cachedDescription": NSNull.null,
+		@"child": NSNull.null,
+		@"count": @5,
+		@"flag": @NO,
+		@"identifier": @"1",
+		@"name": @"foobar",
+		@"ratio": @0,
+		@"title": NSNull.null,
+	})));
+});
+
+describe(@"equality", ^{
+	__block MTLSparseTestModel *otherModel;
+
+	beforeEach(^{
+		otherModel = [[MTLSparseTestModel alloc] init];
+		otherModel.name = @"foobar";
+		otherModel.count = 5;
+		otherModel.identifier = @"1";
+	});
+
+	it(@"should be equal to a model with the same values", ^{
+		expect(model).to(equal(otherModel));
+		expect(@(model.hash)).to(equal(@(otherModel.hash)));
+	});
+
+	it(@"should ignore transitory properties", ^{
+		otherModel.cachedDescription = @"description";
+
+		expect(model).to(equal(otherModel));
+		expect(@(model.hash)).to(equal(@(otherModel.hash)));
+	});
+
+	it(@"should not be equal to a model with other values", ^{
+		otherModel.name = @"other";
+		expect(model).notTo(equal(otherModel));
+	});
+
+	it(@"should not be equal to a model with other populated properties", ^{
+		otherModel.ratio = 1;
+		expect(model).notTo(equal(otherModel));
+	});
+
+	it(@"should compare properties which are not stored sparsely", ^{
+		otherModel.identifier = @"2";
+		expect(model).notTo(equal(otherModel));
+	});
+
+	it(@"should be equal again after properties are depopulated", ^{
+		otherModel.ratio = 1;
+		otherModel.ratio = 0;
+
+		expect(model).to(equal(otherModel));
+	});
+});
+
+it(@"should copy", ^{
+	model.cachedDescription = @"description";
+
+	MTLSparseTestModel *copy = [model copy];
+	expect(copy).to(equal(model));
+	expect(copy).notTo(beIdenticalTo(model));
+	expect(copy.cachedDescription).to(equal(@"description"));
+	expect(copy.identifier).to(equal(@"1"));
+	expect(@(copy.populatedSparsePropertyCount)).to(equal(@3));
+
+	copy.name = @"other";
+	expect(model.name).to(equal(@"foobar"));
+});
+
+it(@"should archive populated properties", ^{
+	model.child = [[MTLSparseTestModel alloc] init];
+	model.child.name = @"child";
+
+	NSData *data = [NSKeyedArchiver archivedDataWithRootObject:model];
+	MTLSparseTestModel *unarchivedModel = [NSKeyedUnarchiver unarchiveObjectWithData:data];
+
+	expect(unarchivedModel).to(equal(model));
+	expect(unarchivedModel.child.name).to(equal(@"child"));
+});
+
+it(@"should round trip through JSON", ^{
+	model.child = [[MTLSparseTestModel alloc] init];
+	model.child.count = 2;
+
+	NSError *error = nil;
+	NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:model error:&error];
+	expect(JSONDictionary).notTo(beNil());
+	expect(error).to(beNil());
+
+	expect(JSONDictionary[@"name"]).to(equal(@"foobar"));
+	expect(JSONDictionary[@"title"]).to(equal(NSNull.null));
+
+	MTLSparseTestModel *decodedModel = [MTLJSONAdapter modelOfClass:MTLSparseTestModel.class fromJSONDictionary:JSONDictionary error:&error];
+	expect(decodedModel).to(equal(model));
+	expect(@(decodedModel.child.count)).to(equal(@2));
+});
+
+QuickSpecEnd
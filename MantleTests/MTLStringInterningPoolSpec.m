@@ -0,0 +1,145 @@
+//
+//  MTLStringInterningPoolSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+// Returns a new heap-allocated string, so that equal strings are never
+// identical before interning.
+static NSString *MTLDistinctString(NSString *string) {
+	return [[NSMutableString stringWithFormat:@"%@ (a string too long to be tagged)", string] copy];
+}
+
+QuickSpecBegin(MTLStringInterningPoolSpec)
+
+describe(@"interning", ^{
+	__block MTLStringInterningPool *pool;
+
+	beforeEach(^{
+		pool = [[MTLStringInterningPool alloc] init];
+	});
+
+	it(@"should return the same instance for equal strings", ^{
+		NSString *first = MTLDistinctString(@"open");
+		NSString *second = MTLDistinctString(@"open");
+		expect(second).notTo(beIdenticalTo(first));
+
+		NSString *interned = [pool internedString:first];
+		expect(interned).to(equal(first));
+		expect([pool internedString:second]).to(beIdenticalTo(interned));
+		expect(@(pool.count)).to(equal(@1));
+	});
+
+	it(@"should store immutable copies of mutable strings", ^{
+		NSMutableString *string = [NSMutableString stringWithString:MTLDistinctString(@"closed")];
+		NSString *interned = [pool internedString:string];
+
+		[string appendString:@"!"];
+		expect(interned).to(equal(MTLDistinctString(@"closed")));
+	});
+
+	it(@"should return nil for nil", ^{
+		expect([pool internedString:nil]).to(beNil());
+		expect(@(pool.count)).to(equal(@0));
+	});
+
+	it(@"should remove all strings", ^{
+		[pool internedString:MTLDistinctString(@"open")];
+		[pool removeAllStrings];
+
+		expect(@(pool.count)).to(equal(@0));
+		expect(@(pool.byteCount)).to(equal(@0));
+	});
+});
+
+describe(@"byte limit", ^{
+	it(@"should stop growing once the limit has been reached", ^{
+		NSString *first = MTLDistinctString(@"a");
+		MTLStringInterningPool *pool = [[MTLStringInterningPool alloc] initWithByteLimit:first.length * sizeof(unichar)];
+
+		expect([pool internedString:first]).to(beIdenticalTo(first));
+
+		NSString *second = MTLDistinctString(@"b");
+		expect([pool internedString:second]).to(beIdenticalTo(second));
+		expect(@(pool.count)).to(equal(@1));
+
+		expect([pool internedString:MTLDistinctString(@"a")]).to(beIdenticalTo(first));
+	});
+
+	it(@"should have a shared pool", ^{
+		expect([MTLStringInterningPool sharedPool]).to(beIdenticalTo([MTLStringInterningPool sharedPool]));
+		expect(@([MTLStringInterningPool sharedPool].byteLimit)).to(beGreaterThan(@0));
+	});
+});
+
+describe(@"MTLJSONAdapter", ^{
+	it(@"should intern the configured properties", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLInterningTestModel.class];
+		adapter.stringInterningPool = [[MTLStringInterningPool alloc] init];
+
+		NSError *error = nil;
+		MTLInterningTestModel *first = [adapter modelFromJSONDictionary:@{ @"state": MTLDistinctString(@"open"), @"body": MTLDistinctString(@"body") } error:&error];
+		expect(error).to(beNil());
+
+		MTLInterningTestModel *second = [adapter modelFromJSONDictionary:@{ @"state": MTLDistinctString(@"open"), @"body": MTLDistinctString(@"body") } error:&error];
+		expect(error).to(beNil());
+
+		expect(second.state).to(beIdenticalTo(first.state));
+		expect(second.body).to(equal(first.body));
+		expect(second.body).notTo(beIdenticalTo(first.body));
+	});
+
+	it(@"should intern strings inside arrays", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLInterningTestModel.class];
+		adapter.stringInterningPool = [[MTLStringInterningPool alloc] init];
+
+		MTLInterningTestModel *first = [adapter modelFromJSONDictionary:@{ @"labels": @[ MTLDistinctString(@"bug"), @1 ] } error:NULL];
+		MTLInterningTestModel *second = [adapter modelFromJSONDictionary:@{ @"labels": @[ MTLDistinctString(@"bug"), @1 ] } error:NULL];
+
+		expect(second.labels).to(equal(first.labels));
+		expect(second.labels[0]).to(beIdenticalTo(first.labels[0]));
+	});
+
+	it(@"should intern the properties of nested models", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLInterningTestModel.class];
+		adapter.stringInterningPool = [[MTLStringInterningPool alloc] init];
+
+		MTLInterningTestModel *first = [adapter modelFromJSONDictionary:@{ @"child": @{ @"state": MTLDistinctString(@"open") } } error:NULL];
+		MTLInterningTestModel *second = [adapter modelFromJSONDictionary:@{ @"child": @{ @"state": MTLDistinctString(@"open") } } error:NULL];
+
+		expect(second.child.state).to(beIdenticalTo(first.child.state));
+	});
+
+	it(@"should only use the pool during decodes by its adapter", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLInterningTestModel.class];
+		adapter.stringInterningPool = [[MTLStringInterningPool alloc] init];
+
+		MTLInterningTestModel *first = [adapter modelFromJSONDictionary:@{ @"child": @{ @"state": MTLDistinctString(@"open") } } error:NULL];
+
+		adapter.stringInterningPool = nil;
+		MTLInterningTestModel *second = [adapter modelFromJSONDictionary:@{ @"child": @{ @"state": MTLDistinctString(@"open") } } error:NULL];
+
+		expect(second.child.state).to(equal(first.child.state));
+		expect(second.child.state).notTo(beIdenticalTo(first.child.state));
+	});
+
+	it(@"should not intern without a pool", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLInterningTestModel.class];
+
+		MTLInterningTestModel *first = [adapter modelFromJSONDictionary:@{ @"state": MTLDistinctString(@"open") } error:NULL];
+		MTLInterningTestModel *second = [adapter modelFromJSONDictionary:@{ @"state": MTLDistinctString(@"open") } error:NULL];
+
+		expect(second.state).to(equal(first.state));
+		expect(second.state).notTo(beIdenticalTo(first.state));
+	});
+});
+
+QuickSpecEnd
@@ -0,0 +1,45 @@
+//
+//  MTLTestAllocationCounter.h
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// The allocations made while a block was being counted.
+typedef struct {
+	// The number of blocks allocated, including reallocations.
+	uint64_t count;
+
+	// The number of bytes requested by those allocations.
+	uint64_t bytes;
+} MTLTestAllocationCounts;
+
+// Returns whether allocations can be counted on this platform.
+//
+// This relies on the malloc logger hook of Darwin's libmalloc.
+BOOL MTLTestAllocationCounterIsAvailable(void);
+
+// Counts the heap allocations the process makes, on any thread, while `block`
+// runs.
+//
+// The malloc logger is only replaced for the duration of `block`, and any
+// logger which was installed before, such as MallocStackLogging, is still
+// called. Calls must not be nested or made from several threads at once.
+//
+// Returns zeroes if MTLTestAllocationCounterIsAvailable() returns NO.
+MTLTestAllocationCounts MTLTestCountAllocations(void (^block)(void));
+
+// Returns whether the bytes allocated by the process can be determined on this
+// platform.
+//
+// This uses malloc zone statistics on Darwin and mallinfo2() on glibc, so it is
+// available in more places than allocation counting.
+BOOL MTLTestAllocatedBytesInUseIsAvailable(void);
+
+// Returns the number of bytes currently allocated by the process, including
+// malloc's own rounding, or 0 if MTLTestAllocatedBytesInUseIsAvailable()
+// returns NO.
+uint64_t MTLTestAllocatedBytesInUse(void);
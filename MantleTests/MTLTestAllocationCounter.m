@@ -0,0 +1,125 @@
+//
+//  MTLTestAllocationCounter.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLTestAllocationCounter.h"
+
+#import <stdatomic.h>
+
+#if !__APPLE__ && defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#define MTL_HAS_MALLINFO2 1
+#import <malloc.h>
+#endif
+
+#if __APPLE__
+#import <malloc/malloc.h>
+
+// The hook libmalloc calls for every allocation and deallocation, which is
+// what MallocStackLogging uses. It is exported, but not declared in any public
+// header.
+typedef void (MTLMallocLogger)(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t numberOfHotFramesToSkip);
+extern MTLMallocLogger *malloc_logger;
+
+// Flags passed to the malloc logger as `type`.
+static const uint32_t MTLMallocLogTypeAllocate = 2;
+static const uint32_t MTLMallocLogTypeDeallocate = 4;
+
+static _Atomic uint64_t MTLAllocationCount;
+static _Atomic uint64_t MTLAllocatedBytes;
+
+// The logger which was installed before counting started.
+static MTLMallocLogger *MTLPreviousMallocLogger;
+
+static void MTLCountingMallocLogger(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t numberOfHotFramesToSkip) {
+	// This runs inside the allocator, so it must not allocate or take locks.
+	if ((type & MTLMallocLogTypeAllocate) != 0) {
+		// Reallocations pass the new size as `arg3`, allocations as `arg2`.
+		uintptr_t size = ((type & MTLMallocLogTypeDeallocate) != 0 ? arg3 : arg2);
+
+		atomic_fetch_add_explicit(&MTLAllocationCount, 1, memory_order_relaxed);
+		atomic_fetch_add_explicit(&MTLAllocatedBytes, size, memory_order_relaxed);
+	}
+
+	if (MTLPreviousMallocLogger != NULL) {
+		MTLPreviousMallocLogger(type, arg1, arg2, arg3, result, numberOfHotFramesToSkip + 1);
+	}
+}
+
+BOOL MTLTestAllocationCounterIsAvailable(void) {
+	return YES;
+}
+
+MTLTestAllocationCounts MTLTestCountAllocations(void (^block)(void)) {
+	NSCParameterAssert(block != nil);
+	NSCAssert(malloc_logger != MTLCountingMallocLogger, @"Allocations are already being counted");
+
+	atomic_store_explicit(&MTLAllocationCount, 0, memory_order_relaxed);
+	atomic_store_explicit(&MTLAllocatedBytes, 0, memory_order_relaxed);
+
+	MTLPreviousMallocLogger = malloc_logger;
+	malloc_logger = MTLCountingMallocLogger;
+
+	block();
+
+	malloc_logger = MTLPreviousMallocLogger;
+	MTLPreviousMallocLogger = NULL;
+
+	return (MTLTestAllocationCounts){
+		.count = atomic_load_explicit(&MTLAllocationCount, memory_order_relaxed),
+		.bytes = atomic_load_explicit(&MTLAllocatedBytes, memory_order_relaxed),
+	};
+}
+
+BOOL MTLTestAllocatedBytesInUseIsAvailable(void) {
+	return YES;
+}
+
+uint64_t MTLTestAllocatedBytesInUse(void) {
+	malloc_statistics_t statistics;
+	malloc_zone_statistics(NULL, &statistics);
+
+	return statistics.size_in_use;
+}
+
+#else
+
+BOOL MTLTestAllocationCounterIsAvailable(void) {
+	return NO;
+}
+
+MTLTestAllocationCounts MTLTestCountAllocations(void (^block)(void)) {
+	NSCParameterAssert(block != nil);
+
+	block();
+	return (MTLTestAllocationCounts){ 0, 0 };
+}
+
+#if MTL_HAS_MALLINFO2
+
+BOOL MTLTestAllocatedBytesInUseIsAvailable(void) {
+	return YES;
+}
+
+uint64_t MTLTestAllocatedBytesInUse(void) {
+	// Blocks served from the main heap and from mmap() alike.
+	struct mallinfo2 info = mallinfo2();
+	return info.uordblks + info.hblkhd;
+}
+
+#else
+
+BOOL MTLTestAllocatedBytesInUseIsAvailable(void) {
+	return NO;
+}
+
+uint64_t MTLTestAllocatedBytesInUse(void) {
+	return 0;
+}
+
+#endif
+
+#endif
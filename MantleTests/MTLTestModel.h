@@ -227,3 +227,194 @@ extern const NSInteger MTLTestModelNameMissing;
 @property (readwrite, nonatomic, strong) NSString *property;
 
 @end
+
+@interface MTLInterningTestModel : MTLModel <MTLJSONSerializing>
+
+// Interned when the adapter has a string interning pool.
+@property (readwrite, nonatomic, copy) NSString *state;
+
+// Never interned.
+@property (readwrite, nonatomic, copy) NSString *body;
+
+// Interned element by element.
+@property (readwrite, nonatomic, copy) NSArray *labels;
+
+@property (readwrite, nonatomic, strong) MTLInterningTestModel *child;
+
+@end
+
+@interface MTLMemoizingTestModel : MTLModel <MTLJSONSerializing>
+
+// The transformer for this property is memoized.
+@property (readwrite, nonatomic, strong) NSURL *URL;
+
+@end
+
+@interface MTLMessagePackTestModel : MTLModel <MTLJSONSerializing>
+
+// Formatted as an ISO 8601 string in JSON.
+@property (readwrite, nonatomic, strong) NSDate *date;
+
+@property (readwrite, nonatomic, copy) NSData *data;
+@property (readwrite, nonatomic, assign) NSInteger count;
+@property (readwrite, nonatomic, assign) double ratio;
+
+// Transformed as in JSON.
+@property (readwrite, nonatomic, strong) NSURL *URL;
+
+@end
+
+@interface MTLColumnarTestModel : MTLModel
+
+@property (readwrite, nonatomic, assign) BOOL flag;
+@property (readwrite, nonatomic, assign) short smallNumber;
+@property (readwrite, nonatomic, assign) unsigned long long largeNumber;
+@property (readwrite, nonatomic, assign) float ratio;
+@property (readwrite, nonatomic, strong) NSNumber *score;
+@property (readwrite, nonatomic, copy) NSString *name;
+@property (readwrite, nonatomic, strong) NSURL *URL;
+@property (readwrite, nonatomic, copy) NSData *data;
+@property (readwrite, nonatomic, strong) NSDate *date;
+
+// Only settable through its instance variable.
+@property (readonly, nonatomic, assign) NSInteger identifier;
+
+// Not exported into columns.
+@property (readwrite, nonatomic, strong) MTLEmptyTestModel *nested;
+
+@end
+
+@interface MTLSQLiteTestModel : MTLModel <MTLSQLiteSerializing>
+
+// The primary key, stored in the "id" column.
+@property (readwrite, nonatomic, assign) NSInteger identifier;
+
+@property (readwrite, nonatomic, assign) BOOL enabled;
+@property (readwrite, nonatomic, assign) double score;
+@property (readwrite, nonatomic, copy) NSString *name;
+@property (readwrite, nonatomic, strong) NSURL *URL;
+@property (readwrite, nonatomic, copy) NSData *data;
+@property (readwrite, nonatomic, strong) NSDate *date;
+
+// Stored as a comma-separated string through a transformer.
+@property (readwrite, nonatomic, copy) NSArray *tags;
+
+// Stored as is, so only values SQLite supports can be saved.
+@property (readwrite, nonatomic, strong) id payload;
+
+// Not stored.
+@property (readwrite, nonatomic, copy) NSString *note;
+
+@end
+
+@interface MTLDiffingTestModel : MTLModel
+
+@property (readwrite, nonatomic, assign) NSUInteger count;
+@property (readwrite, nonatomic, assign) double ratio;
+@property (readwrite, nonatomic, copy) NSString *name;
+@property (readwrite, nonatomic, strong) MTLDiffingTestModel *child;
+@property (readwrite, nonatomic, copy) NSArray *children;
+
+// Transitory, so it is never compared.
+@property (readwrite, nonatomic, weak) MTLDiffingTestModel *parent;
+
+@end
+
+@interface MTLIdentityTestModel : MTLModel
+
+@property (readwrite, nonatomic, assign) NSUInteger identifier;
+@property (readwrite, nonatomic, copy) NSString *name;
+
++ (instancetype)modelWithIdentifier:(NSUInteger)identifier name:(NSString *)name;
+
+@end
+
+// Returns YES from +instancesAreImmutable.
+@interface MTLImmutableIdentityTestModel : MTLIdentityTestModel
+@end
+
+// Identified by both properties together.
+@interface MTLCompositeIdentityTestModel : MTLModel
+
+@property (readwrite, nonatomic, copy) NSString *domain;
+@property (readwrite, nonatomic, assign) NSInteger code;
+@property (readwrite, nonatomic, copy) NSString *message;
+
+@end
+
+@interface MTLUniquingUserModel : MTLModel <MTLJSONSerializing>
+
+@property (readwrite, nonatomic, copy) NSNumber *identifier;
+@property (readwrite, nonatomic, copy) NSString *login;
+
+@end
+
+@interface MTLUniquingIssueModel : MTLModel <MTLJSONSerializing>
+
+@property (readwrite, nonatomic, copy) NSString *title;
+@property (readwrite, nonatomic, strong) MTLUniquingUserModel *author;
+
+@end
+
+@interface MTLJSONPatchUserModel : MTLModel <MTLJSONSerializing>
+
+@property (readwrite, nonatomic, copy) NSString *name;
+
+@end
+
+@interface MTLJSONPatchTestModel : MTLModel <MTLJSONSerializing>
+
+@property (readwrite, nonatomic, copy) NSString *title;
+
+// This property is a string in JSON.
+@property (readwrite, nonatomic, assign) NSUInteger count;
+
+@property (readwrite, nonatomic, copy) NSArray *labels;
+@property (readwrite, nonatomic, strong) MTLJSONPatchUserModel *owner;
+@property (readwrite, nonatomic, copy) NSArray *members;
+
+// Associated with "location.city" and "location.zip" key paths in JSON.
+@property (readwrite, nonatomic, copy) NSString *city;
+@property (readwrite, nonatomic, copy) NSString *zip;
+
+// Associated with the "latitude" and "longitude" key paths in JSON.
+@property (readwrite, nonatomic, copy) NSDictionary *point;
+
+@end
+
+@interface MTLSparseTestModel : MTLSparseModel <MTLJSONSerializing>
+
+// Stored sparsely.
+@property (readwrite, nonatomic, copy) NSString *name;
+@property (readonly, nonatomic, copy) NSString *title;
+@property (readwrite, nonatomic, assign) NSInteger count;
+@property (readwrite, nonatomic, assign) double ratio;
+@property (readwrite, nonatomic, assign) BOOL flag;
+@property (readwrite, nonatomic, strong) MTLSparseTestModel *child;
+
+// Stored sparsely, and excluded from equality.
+@property (readwrite, nonatomic, copy) NSString *cachedDescription;
+
+// Backed by an instance variable.
+@property (readwrite, nonatomic, copy) NSString *identifier;
+
+@end
+
+@interface MTLSparseSubclassTestModel : MTLSparseTestModel
+
+// Stored sparsely, after the slots of the superclass.
+@property (readwrite, nonatomic, copy) NSString *author;
+
+@end
+
+@interface MTLImmutableTestModel : MTLModel
+
+// Must be shorter than 10 characters.
+@property (readonly, nonatomic, copy) NSString *name;
+
+@property (readonly, nonatomic, assign) NSUInteger count;
+@property (readonly, nonatomic, assign) double ratio;
+@property (readonly, nonatomic, strong) MTLImmutableTestModel *child;
+@property (readonly, nonatomic, copy) NSArray *children;
+
+@end
@@ -576,3 +576,246 @@ static NSUInteger modelVersion = 1;
 }
 
 @end
+
+@implementation MTLInterningTestModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [NSDictionary mtl_identityPropertyMapWithModel:self];
+}
+
++ (NSSet *)JSONPropertyKeysForStringInterning {
+	return [NSSet setWithObjects:@"state", @"labels", nil];
+}
+
+@end
+
+@implementation MTLMemoizingTestModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [NSDictionary mtl_identityPropertyMapWithModel:self];
+}
+
++ (NSSet *)JSONPropertyKeysForTransformerMemoization {
+	return [NSSet setWithObject:@"URL"];
+}
+
+@end
+
+@implementation MTLMessagePackTestModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [NSDictionary mtl_identityPropertyMapWithModel:self];
+}
+
++ (NSValueTransformer *)dateJSONTransformer {
+	NSLocale *locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+	NSTimeZone *timeZone = [NSTimeZone timeZoneForSecondsFromGMT:0];
+
+	return [NSValueTransformer mtl_dateTransformerWithDateFormat:@"yyyy-MM-dd'T'HH:mm:ss'Z'" calendar:nil locale:locale timeZone:timeZone defaultDate:nil];
+}
+
++ (NSValueTransformer *)URLJSONTransformer {
+	return [NSValueTransformer valueTransformerForName:MTLURLValueTransformerName];
+}
+
+@end
+
+@implementation MTLColumnarTestModel
+@end
+
+@implementation MTLSQLiteTestModel
+
++ (NSString *)SQLiteTableName {
+	return @"sqlite_test_models";
+}
+
++ (NSDictionary *)SQLiteColumnNamesByPropertyKey {
+	return @{
+		@"identifier": @"id",
+		@"enabled": @"enabled",
+		@"score": @"score",
+		@"name": @"name",
+		@"URL": @"url",
+		@"data": @"data",
+		@"date": @"date",
+		@"tags": @"tags",
+		@"payload": @"payload",
+	};
+}
+
++ (NSArray *)SQLitePrimaryKeyPropertyKeys {
+	return @[ @"identifier" ];
+}
+
++ (NSValueTransformer *)SQLiteTransformerForKey:(NSString *)key {
+	if (![key isEqual:@"tags"]) return nil;
+
+	return [MTLValueTransformer transformerUsingForwardBlock:^(NSString *string, BOOL *success, NSError **error) {
+		return [string componentsSeparatedByString:@","];
+	} reverseBlock:^(NSArray *tags, BOOL *success, NSError **error) {
+		return [tags componentsJoinedByString:@","];
+	}];
+}
+
+@end
+
+@implementation MTLDiffingTestModel
+@end
+
+@implementation MTLIdentityTestModel
+
++ (NSArray *)identityPropertyKeys {
+	return @[ @"identifier" ];
+}
+
++ (instancetype)modelWithIdentifier:(NSUInteger)identifier name:(NSString *)name {
+	MTLIdentityTestModel *model = [[self alloc] init];
+	model.identifier = identifier;
+	model.name = name;
+
+	return model;
+}
+
+@end
+
+@implementation MTLImmutableIdentityTestModel
+
++ (BOOL)instancesAreImmutable {
+	return YES;
+}
+
+@end
+
+@implementation MTLCompositeIdentityTestModel
+
++ (NSArray *)identityPropertyKeys {
+	return @[ @"domain", @"code" ];
+}
+
+@end
+
+@implementation MTLUniquingUserModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return @{
+		@"identifier": @"id",
+		@"login": @"login",
+	};
+}
+
++ (NSArray *)identityPropertyKeys {
+	return @[ @"identifier" ];
+}
+
+@end
+
+@implementation MTLUniquingIssueModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return @{
+		@"title": @"title",
+		@"author": @"user",
+	};
+}
+
++ (NSValueTransformer *)authorJSONTransformer {
+	return [MTLJSONAdapter dictionaryTransformerWithModelClass:MTLUniquingUserModel.class];
+}
+
+@end
+
+@implementation MTLJSONPatchUserModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return @{
+		@"name": @"name",
+	};
+}
+
+@end
+
+@implementation MTLJSONPatchTestModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return @{
+		@"title": @"title",
+		@"count": @"count",
+		@"labels": @"labels",
+		@"owner": @"owner",
+		@"members": @"members",
+		@"city": @"location.city",
+		@"zip": @"location.zip",
+		@"point": @[ @"latitude", @"longitude" ],
+	};
+}
+
++ (NSValueTransformer *)countJSONTransformer {
+	return [MTLValueTransformer
+		transformerUsingForwardBlock:^(NSString *str, BOOL *success, NSError **error) {
+			return @(str.integerValue);
+		}
+		reverseBlock:^(NSNumber *num, BOOL *success, NSError **error) {
+			return num.stringValue;
+		}];
+}
+
++ (NSValueTransformer *)ownerJSONTransformer {
+	return [MTLJSONAdapter dictionaryTransformerWithModelClass:MTLJSONPatchUserModel.class];
+}
+
++ (NSValueTransformer *)membersJSONTransformer {
+	return [MTLJSONAdapter arrayTransformerWithModelClass:MTLJSONPatchUserModel.class];
+}
+
+@end
+
+@implementation MTLSparseTestModel
+
+@dynamic name;
+@dynamic title;
+@dynamic count;
+@dynamic ratio;
+@dynamic flag;
+@dynamic child;
+@dynamic cachedDescription;
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [NSDictionary mtl_identityPropertyMapWithModel:self];
+}
+
++ (NSValueTransformer *)childJSONTransformer {
+	return [MTLJSONAdapter dictionaryTransformerWithModelClass:MTLSparseTestModel.class];
+}
+
++ (MTLPropertyStorage)storageBehaviorForPropertyWithKey:(NSString *)propertyKey {
+	if ([propertyKey isEqual:@"cachedDescription"]) {
+		return MTLPropertyStorageTransitory;
+	} else {
+		return [super storageBehaviorForPropertyWithKey:propertyKey];
+	}
+}
+
+@end
+
+@implementation MTLSparseSubclassTestModel
+
+@dynamic author;
+
+@end
+
+@implementation MTLImmutableTestModel
+
++ (BOOL)instancesAreImmutable {
+	return YES;
+}
+
+- (BOOL)validateName:(NSString * __autoreleasing *)name error:(NSError * __autoreleasing *)error {
+	if ([*name length] < 10) return YES;
+	if (error != NULL) {
+		*error = [NSError errorWithDomain:MTLTestModelErrorDomain code:MTLTestModelNameTooLong userInfo:nil];
+	}
+
+	return NO;
+}
+
+@end
@@ -0,0 +1,192 @@
+//
+//  MTLTraceSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+#import <pthread.h>
+
+#import "MTLTestModel.h"
+
+// Returns the events for `className`, in the order they were recorded.
+static NSArray *MTLTraceEventsForClass(NSArray *events, NSString *className) {
+	return [events filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"args.class == %@", className]];
+}
+
+// Decodes the JSON dictionary `context` into an MTLTestModel.
+static void *MTLTraceSpecDecode(void *context) {
+	@autoreleasepool {
+		[MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:(__bridge NSDictionary *)context error:NULL];
+	}
+
+	return NULL;
+}
+
+// Decodes `context[@"values"]` into several MTLTestModels, then stores the
+// exported events under "events", and the ID of the thread under "threadID".
+static void *MTLTraceSpecDecodeAndExport(void *context) {
+	@autoreleasepool {
+		NSMutableDictionary *info = (__bridge NSMutableDictionary *)context;
+
+		for (NSUInteger index = 0; index < 4; index++) {
+			[MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:info[@"values"] error:NULL];
+		}
+
+		info[@"threadID"] = @(pthread_mach_thread_np(pthread_self()));
+		info[@"events"] = [MTLTrace chromeTraceEvents];
+	}
+
+	return NULL;
+}
+
+QuickSpecBegin(MTLTraceSpec)
+
+NSDictionary *values = @{
+	@"username": @"foo",
+	@"count": @"5",
+	@"nested": @{ @"name": @"bar" },
+};
+
+beforeEach(^{
+	[MTLTrace reset];
+	[MTLTrace setEnabled:YES];
+});
+
+afterEach(^{
+	[MTLTrace setEnabled:NO];
+	[MTLTrace reset];
+});
+
+it(@"should not record anything while disabled", ^{
+	[MTLTrace setEnabled:NO];
+
+	[MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL];
+	expect([MTLTrace chromeTraceEvents]).to(beEmpty());
+});
+
+it(@"should record nested decode stages", ^{
+	MTLTestModel *model = [MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL];
+	expect(model).notTo(beNil());
+
+	NSArray *events = MTLTraceEventsForClass([MTLTrace chromeTraceEvents], @"MTLTestModel");
+	expect(events).notTo(beEmpty());
+
+	NSDictionary *firstEvent = events.firstObject;
+	NSDictionary *lastEvent = events.lastObject;
+	expect(firstEvent[@"name"]).to(equal(@"decode"));
+	expect(firstEvent[@"ph"]).to(equal(@"B"));
+	expect(firstEvent[@"cat"]).to(equal(@"Mantle"));
+	expect(lastEvent[@"name"]).to(equal(@"decode"));
+	expect(lastEvent[@"ph"]).to(equal(@"E"));
+	expect(lastEvent[@"ts"]).to(beGreaterThanOrEqualTo(firstEvent[@"ts"]));
+
+	NSSet *names = [NSSet setWithArray:[events valueForKey:@"name"]];
+	expect(names).to(contain(@"key path extraction", @"transform", @"model initialization", @"validation"));
+
+	// Every stage which began must have ended, in reverse order.
+	NSMutableArray *stack = [NSMutableArray array];
+	for (NSDictionary *event in events) {
+		if ([event[@"ph"] isEqual:@"B"]) {
+			[stack addObject:event[@"name"]];
+		} else {
+			expect(event[@"name"]).to(equal(stack.lastObject));
+			[stack removeLastObject];
+		}
+	}
+
+	expect(stack).to(beEmpty());
+});
+
+it(@"should record class dispatch", ^{
+	NSDictionary *clusterValues = @{
+		@"flavor": @"chocolate",
+		@"chocolate_bitterness": @"100",
+	};
+
+	[MTLJSONAdapter modelOfClass:MTLClassClusterModel.class fromJSONDictionary:clusterValues error:NULL];
+
+	NSArray *events = [MTLTrace chromeTraceEvents];
+	expect([MTLTraceEventsForClass(events, @"MTLClassClusterModel") valueForKey:@"name"]).to(equal(@[ @"class dispatch", @"class dispatch" ]));
+	expect([MTLTraceEventsForClass(events, @"MTLChocolateClassClusterModel") valueForKey:@"name"]).to(contain(@"decode"));
+});
+
+it(@"should record encode stages", ^{
+	MTLTestModel *model = [MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL];
+	[MTLTrace reset];
+
+	[MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+
+	NSArray *events = MTLTraceEventsForClass([MTLTrace chromeTraceEvents], @"MTLTestModel");
+	expect(events.firstObject[@"name"]).to(equal(@"encode"));
+
+	NSSet *names = [NSSet setWithArray:[events valueForKey:@"name"]];
+	expect(names).to(contain(@"dictionary value", @"reverse transform", @"key path insertion"));
+	expect(names).notTo(contain(@"decode"));
+});
+
+it(@"should record events from multiple threads", ^{
+	dispatch_apply(4, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+		[MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL];
+	});
+
+	NSArray *events = MTLTraceEventsForClass([MTLTrace chromeTraceEvents], @"MTLTestModel");
+	NSPredicate *decodeBegins = [NSPredicate predicateWithFormat:@"name == 'decode' AND ph == 'B'"];
+	expect(@([events filteredArrayUsingPredicate:decodeBegins].count)).to(equal(@4));
+});
+
+it(@"should keep the events of exited threads", ^{
+	pthread_t thread;
+	expect(@(pthread_create(&thread, NULL, MTLTraceSpecDecode, (__bridge void *)values))).to(equal(@0));
+
+	// Joining waits for the thread to exit and free its buffer.
+	pthread_join(thread, NULL);
+
+	NSArray *events = MTLTraceEventsForClass([MTLTrace chromeTraceEvents], @"MTLTestModel");
+	NSPredicate *decodeBegins = [NSPredicate predicateWithFormat:@"name == 'decode' AND ph == 'B'"];
+	expect(@([events filteredArrayUsingPredicate:decodeBegins].count)).to(equal(@1));
+
+	[MTLTrace reset];
+	expect(MTLTraceEventsForClass([MTLTrace chromeTraceEvents], @"MTLTestModel")).to(beEmpty());
+});
+
+it(@"should keep only the configured number of events per thread", ^{
+	NSUInteger eventsPerBuffer = MTLTrace.eventsPerBuffer;
+	expect(@(eventsPerBuffer)).to(equal(@4096));
+
+	[MTLTrace setEventsPerBuffer:16];
+
+	// A new thread creates a buffer with the new capacity.
+	NSMutableDictionary *info = [@{ @"values": values } mutableCopy];
+	pthread_t thread;
+	expect(@(pthread_create(&thread, NULL, MTLTraceSpecDecodeAndExport, (__bridge void *)info))).to(equal(@0));
+	pthread_join(thread, NULL);
+
+	[MTLTrace setEventsPerBuffer:eventsPerBuffer];
+
+	NSArray *events = [info[@"events"] filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"tid == %@", info[@"threadID"]]];
+	expect(@(events.count)).to(beGreaterThan(@0));
+	expect(@(events.count)).to(beLessThanOrEqualTo(@16));
+});
+
+it(@"should write a Chrome trace file", ^{
+	[MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL];
+
+	NSURL *URL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString]];
+
+	NSError *error = nil;
+	BOOL success = [MTLTrace writeChromeTraceToURL:URL error:&error];
+	expect(@(success)).to(beTruthy());
+	expect(error).to(beNil());
+
+	NSDictionary *trace = [NSJSONSerialization JSONObjectWithData:[NSData dataWithContentsOfURL:URL] options:0 error:NULL];
+	expect(trace[@"traceEvents"]).notTo(beEmpty());
+
+	[NSFileManager.defaultManager removeItemAtURL:URL error:NULL];
+});
+
+QuickSpecEnd
@@ -0,0 +1,215 @@
+//
+//  MTLUniquingContextSpec.m
+//  Mantle
+//
+//  Created by agent on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLUniquingContextSpec)
+
+__block MTLUniquingContext *context;
+
+beforeEach(^{
+	context = [[MTLUniquingContext alloc] init];
+});
+
+describe(@"-uniqueModel:", ^{
+	it(@"should return the canonical instance for an identity", ^{
+		MTLIdentityTestModel *first = [MTLIdentityTestModel modelWithIdentifier:1 name:@"one"];
+		MTLIdentityTestModel *duplicate = [first copy];
+
+		expect([context uniqueModel:first]).to(beIdenticalTo(first));
+		expect([context uniqueModel:duplicate]).to(beIdenticalTo(first));
+		expect([context existingModelOfClass:MTLIdentityTestModel.class identity:@1]).to(beIdenticalTo(first));
+	});
+
+	it(@"should merge changes into a copy of the canonical instance", ^{
+		MTLIdentityTestModel *first = [MTLIdentityTestModel modelWithIdentifier:1 name:@"one"];
+		MTLIdentityTestModel *changed = [MTLIdentityTestModel modelWithIdentifier:1 name:@"uno"];
+
+		[context uniqueModel:first];
+
+		MTLIdentityTestModel *merged = [context uniqueModel:changed];
+		expect(merged).notTo(beIdenticalTo(first));
+		expect(merged.name).to(equal(@"uno"));
+		expect(first.name).to(equal(@"one"));
+
+		expect([context existingModelOfClass:MTLIdentityTestModel.class identity:@1]).to(beIdenticalTo(merged));
+		expect([context uniqueModel:[changed copy]]).to(beIdenticalTo(merged));
+	});
+
+	it(@"should not mutate canonical instances of immutable classes", ^{
+		MTLImmutableIdentityTestModel *first = [MTLImmutableIdentityTestModel modelWithIdentifier:1 name:@"one"];
+		MTLImmutableIdentityTestModel *changed = [MTLImmutableIdentityTestModel modelWithIdentifier:1 name:@"uno"];
+
+		expect([first copy]).to(beIdenticalTo(first));
+		[context uniqueModel:first];
+
+		MTLImmutableIdentityTestModel *merged = [context uniqueModel:changed];
+		expect(merged).to(beAKindOf(MTLImmutableIdentityTestModel.class));
+		expect(merged).notTo(beIdenticalTo(first));
+		expect(merged).notTo(beIdenticalTo(changed));
+		expect(merged.name).to(equal(@"uno"));
+		expect(first.name).to(equal(@"one"));
+
+		expect([context existingModelOfClass:MTLImmutableIdentityTestModel.class identity:@1]).to(beIdenticalTo(merged));
+	});
+
+	it(@"should not unique models with a nil identity value", ^{
+		MTLUniquingUserModel *first = [[MTLUniquingUserModel alloc] init];
+		first.login = @"octocat";
+
+		MTLUniquingUserModel *second = [[MTLUniquingUserModel alloc] init];
+		second.login = @"hubot";
+
+		expect([context uniqueModel:first]).to(beIdenticalTo(first));
+		expect([context uniqueModel:second]).to(beIdenticalTo(second));
+		expect(first.login).to(equal(@"octocat"));
+	});
+
+	it(@"should not unique models with a nil value in a composite identity", ^{
+		MTLCompositeIdentityTestModel *first = [[MTLCompositeIdentityTestModel alloc] init];
+		first.code = 404;
+
+		MTLCompositeIdentityTestModel *second = [first copy];
+
+		expect([context uniqueModel:first]).to(beIdenticalTo(first));
+		expect([context uniqueModel:second]).to(beIdenticalTo(second));
+	});
+
+	it(@"should not unique models without identity", ^{
+		MTLEmptyTestModel *model = [[MTLEmptyTestModel alloc] init];
+
+		[context uniqueModel:model];
+		expect([context uniqueModel:[model copy]]).notTo(beIdenticalTo(model));
+	});
+
+	it(@"should not keep canonical instances alive", ^{
+		@autoreleasepool {
+			MTLIdentityTestModel *first = [MTLIdentityTestModel modelWithIdentifier:1 name:@"one"];
+			[context uniqueModel:first];
+		}
+
+		expect([context existingModelOfClass:MTLIdentityTestModel.class identity:@1]).to(beNil());
+
+		MTLIdentityTestModel *second = [MTLIdentityTestModel modelWithIdentifier:1 name:@"two"];
+		expect([context uniqueModel:second]).to(beIdenticalTo(second));
+	});
+
+	it(@"should forget all models", ^{
+		MTLIdentityTestModel *first = [MTLIdentityTestModel modelWithIdentifier:1 name:@"one"];
+		[context uniqueModel:first];
+		[context removeAllModels];
+
+		expect([context existingModelOfClass:MTLIdentityTestModel.class identity:@1]).to(beNil());
+	});
+});
+
+describe(@"MTLJSONAdapter", ^{
+	NSArray *JSONArray = @[
+		@{ @"title": @"first", @"user": @{ @"id": @7, @"login": @"octocat" } },
+		@{ @"title": @"second", @"user": @{ @"id": @7, @"login": @"octocat" } },
+		@{ @"title": @"third", @"user": @{ @"id": @8, @"login": @"hubot" } },
+	];
+
+	it(@"should unique nested models during a decode", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLUniquingIssueModel.class];
+		adapter.uniquingContext = context;
+
+		NSMutableArray *issues = [NSMutableArray array];
+		for (NSDictionary *JSONDictionary in JSONArray) {
+			NSError *error = nil;
+			MTLUniquingIssueModel *issue = [adapter modelFromJSONDictionary:JSONDictionary error:&error];
+			expect(issue).notTo(beNil());
+			expect(error).to(beNil());
+
+			[issues addObject:issue];
+		}
+
+		MTLUniquingIssueModel *first = issues[0];
+		MTLUniquingIssueModel *second = issues[1];
+		MTLUniquingIssueModel *third = issues[2];
+
+		expect(second.author).to(beIdenticalTo(first.author));
+		expect(third.author).notTo(beIdenticalTo(first.author));
+	});
+
+	it(@"should unique models across decodes", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLUniquingUserModel.class];
+		adapter.uniquingContext = context;
+
+		MTLUniquingUserModel *user = [adapter modelFromJSONDictionary:@{ @"id": @7, @"login": @"octocat" } error:NULL];
+		MTLUniquingUserModel *duplicate = [adapter modelFromJSONDictionary:@{ @"id": @7, @"login": @"octocat" } error:NULL];
+		MTLUniquingUserModel *renamed = [adapter modelFromJSONDictionary:@{ @"id": @7, @"login": @"monalisa" } error:NULL];
+
+		expect(duplicate).to(beIdenticalTo(user));
+		expect(renamed.login).to(equal(@"monalisa"));
+		expect(user.login).to(equal(@"octocat"));
+	});
+
+	it(@"should unique nested models when updating a model", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLUniquingIssueModel.class];
+		adapter.uniquingContext = context;
+
+		MTLUniquingIssueModel *first = [adapter modelFromJSONDictionary:JSONArray[0] error:NULL];
+		MTLUniquingIssueModel *third = [adapter modelFromJSONDictionary:JSONArray[2] error:NULL];
+
+		NSError *error = nil;
+		BOOL success = [adapter updateModel:third fromJSONDictionary:@{ @"user": JSONArray[0][@"user"] } error:&error];
+		expect(@(success)).to(beTruthy());
+		expect(error).to(beNil());
+
+		expect(third.author).to(beIdenticalTo(first.author));
+	});
+
+	it(@"should only unique during decodes with a context", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLUniquingIssueModel.class];
+		adapter.uniquingContext = context;
+
+		MTLUniquingIssueModel *first = [adapter modelFromJSONDictionary:JSONArray[0] error:NULL];
+
+		adapter.uniquingContext = nil;
+		MTLUniquingIssueModel *second = [adapter modelFromJSONDictionary:JSONArray[1] error:NULL];
+
+		expect(second.author).notTo(beIdenticalTo(first.author));
+		expect(second.author).to(equal(first.author));
+	});
+
+	it(@"should not unique nested models without a context", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLUniquingIssueModel.class];
+
+		MTLUniquingIssueModel *first = [adapter modelFromJSONDictionary:JSONArray[0] error:NULL];
+		MTLUniquingIssueModel *second = [adapter modelFromJSONDictionary:JSONArray[1] error:NULL];
+
+		expect(second.author).notTo(beIdenticalTo(first.author));
+		expect(second.author).to(equal(first.author));
+	});
+
+	it(@"should unique safely from many threads", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLUniquingIssueModel.class];
+		adapter.uniquingContext = context;
+
+		NSMutableArray *authors = [NSMutableArray array];
+
+		dispatch_apply(8, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+			MTLUniquingIssueModel *issue = [adapter modelFromJSONDictionary:JSONArray[0] error:NULL];
+
+			@synchronized (authors) {
+				[authors addObject:issue.author];
+			}
+		});
+
+		for (MTLUniquingUserModel *author in authors) {
+			expect(author).to(beIdenticalTo(authors.firstObject));
+		}
+	});
+});
+
+QuickSpecEnd
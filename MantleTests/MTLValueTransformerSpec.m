@@ -10,6 +10,18 @@
 #import <Nimble/Nimble.h>
 #import <Quick/Quick.h>
 
+// Uppercases the result of its block.
+@interface MTLUppercasingValueTransformer : MTLValueTransformer
+@end
+
+@implementation MTLUppercasingValueTransformer
+
+- (id)transformedValue:(id)value success:(BOOL *)success error:(NSError **)error {
+	return [[super transformedValue:value success:success error:error] uppercaseString];
+}
+
+@end
+
 QuickSpecBegin(MTLValueTransformerSpec)
 
 it(@"should return a forward transformer with a block", ^{
@@ -52,4 +64,72 @@ it(@"should return a reversible transformer with forward and reverse blocks", ^{
 	expect([transformer reverseTransformedValue:@"foobar"]).to(equal(@"foo"));
 });
 
+describe(@"batch transformation", ^{
+	__block MTLValueTransformer *transformer;
+
+	beforeEach(^{
+		transformer = [MTLValueTransformer
+			transformerUsingForwardBlock:^ id (NSString *str, BOOL *success, NSError **error) {
+				if ([str isEqual:@"nil"]) return nil;
+
+				if (![str isKindOfClass:NSString.class]) {
+					if (error != NULL) *error = [NSError errorWithDomain:@"MTLTestDomain" code:1 userInfo:nil];
+					*success = NO;
+					return nil;
+				}
+
+				return [str stringByAppendingString:@"bar"];
+			}
+			reverseBlock:^(NSString *str, BOOL *success, NSError **error) {
+				return [str substringToIndex:str.length - 3];
+			}];
+	});
+
+	it(@"should transform each value in order", ^{
+		BOOL success = NO;
+		NSError *error = nil;
+
+		NSPointerArray *transformedValues = [transformer transformedValues:@[ @"foo", @"nil", @"baz" ] success:&success error:&error];
+		expect(@(transformedValues.count)).to(equal(@3));
+		expect((__bridge id)[transformedValues pointerAtIndex:0]).to(equal(@"foobar"));
+		expect((__bridge id)[transformedValues pointerAtIndex:1]).to(beNil());
+		expect((__bridge id)[transformedValues pointerAtIndex:2]).to(equal(@"bazbar"));
+		expect(@(success)).to(beTruthy());
+		expect(error).to(beNil());
+	});
+
+	it(@"should reverse transform each value in order", ^{
+		BOOL success = NO;
+
+		expect([transformer reverseTransformedValues:@[ @"foobar", @"bazbar" ] success:&success error:NULL].allObjects).to(equal(@[ @"foo", @"baz" ]));
+		expect(@(success)).to(beTruthy());
+	});
+
+	it(@"should report the index of the first failing value", ^{
+		BOOL success = YES;
+		NSError *error = nil;
+
+		NSArray *values = @[ @"foo", @"bar", @5, @6 ];
+		expect([transformer transformedValues:values success:&success error:&error]).to(beNil());
+		expect(@(success)).to(beFalsy());
+		expect(error.domain).to(equal(MTLTransformerErrorHandlingErrorDomain));
+		expect(error.userInfo[MTLTransformerErrorHandlingIndexErrorKey]).to(equal(@2));
+		expect(error.userInfo[MTLTransformerErrorHandlingInputValueErrorKey]).to(equal(values));
+		expect([error.userInfo[NSUnderlyingErrorKey] domain]).to(equal(@"MTLTestDomain"));
+	});
+
+	it(@"should use overrides of subclasses", ^{
+		MTLUppercasingValueTransformer *uppercasingTransformer = [MTLUppercasingValueTransformer transformerUsingForwardBlock:^(NSString *str, BOOL *success, NSError **error) {
+			return [str stringByAppendingString:@"bar"];
+		}];
+
+		BOOL success = NO;
+		expect([uppercasingTransformer transformedValues:@[ @"foo", @"baz" ] success:&success error:NULL].allObjects).to(equal(@[ @"FOOBAR", @"BAZBAR" ]));
+		expect(@(success)).to(beTruthy());
+
+		NSValueTransformer *arrayTransformer = [NSValueTransformer mtl_arrayMappingTransformerWithTransformer:uppercasingTransformer];
+		expect([arrayTransformer transformedValue:@[ @"foo", @"baz" ]]).to(equal(@[ @"FOOBAR", @"BAZBAR" ]));
+	});
+});
+
 QuickSpecEnd
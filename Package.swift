@@ -21,11 +21,19 @@ let package = Package(
             name: "Mantle",
             dependencies: ["extobjc"],
             path: "Mantle",
-            exclude: ["extobjc"]
+            exclude: ["extobjc"],
+            linkerSettings: [
+                .linkedLibrary("sqlite3")
+            ]
         ),
         .target(
             name: "extobjc",
             path: "Mantle/extobjc"
+        ),
+        .target(
+            name: "MantleBenchmarks",
+            dependencies: ["Mantle"],
+            path: "MantleBenchmarks"
         )
     ]
 )